@@ -21,6 +21,8 @@ in vec4 fs_Pos;
 in vec4 fs_Nor;
 in vec4 fs_Col;
 in vec2 fs_UV;
+flat in vec2 fs_TileOrigin;
+flat in int fs_Tiled;
 in vec4 fs_BiomeWts;  // mountains = 0, hills = 1, forest = 2, islands = 3
 
 flat in int fs_TexIdx;
@@ -114,6 +116,13 @@ vec4 mySmoothStep(vec4 a, vec4 b, float t)
 
 void main()
 {
+    // A greedy-meshed face spans several blocks and its uv counts blocks,
+    // so wrap it back into the face's atlas cell once per block
+    vec2 baseUV = fs_UV;
+    if (fs_Tiled == 1) {
+        baseUV = fs_TileOrigin + fract(fs_UV) * 0.0625;
+    }
+
     vec2 newUV;
     if (fs_UV.x >= 0 && fs_UV.y >= 0) {
         // 0 = no change from base texture at uv coords
@@ -122,8 +131,8 @@ void main()
         // 3 = lava animation
         // 4 = glowing blocks/ doesn't receive shadows
 
-        out_Col = vec4(texture(u_TextureSampler, fs_UV));
-        newUV = fs_UV;
+        out_Col = vec4(texture(u_TextureSampler, baseUV));
+        newUV = baseUV;
 
         if (fs_TexIdx == 1) {
             // mountains = 0, hills = 1, forest = 2, islands = 3
@@ -144,13 +153,13 @@ void main()
                 vec4 col2 = cCol;
                 tintCol = mySmoothStep(col1, col2, (110.f - fs_Pos.y) / 10.f);
             }
-            newUV = fs_UV;
-            out_Col = vec4(texture(u_TextureSampler, fs_UV));
+            newUV = baseUV;
+            out_Col = vec4(texture(u_TextureSampler, baseUV));
             out_Col = color(out_Col, tintCol, 0.6);
         } else if (fs_TexIdx == 2) {
             // water animation
             float uOffset = (0.0625 / 64.f) * float(mod(u_Time, 64));
-            newUV = vec2(fs_UV.x + uOffset, fs_UV.y);
+            newUV = vec2(baseUV.x + uOffset, baseUV.y);
             out_Col = vec4(texture(u_TextureSampler, newUV));
 
             // biome color interpolation (water)
@@ -189,9 +198,9 @@ void main()
             }
 
             if (fbm(fs_Pos.xyz) > 0.5) {
-                newUV = fs_UV + vec2(uOffset, vOffset);
+                newUV = baseUV + vec2(uOffset, vOffset);
             } else {
-                newUV = fs_UV + vec2(vOffset, uOffset);
+                newUV = baseUV + vec2(vOffset, uOffset);
             }
             out_Col = texture(u_TextureSampler, newUV);
         }
@@ -23,18 +23,16 @@ uniform mat4 u_ViewProj;    // The matrix that defines the camera's transformati
 uniform vec4
     u_Color;  // When drawing the cube instance, we'll set our uniform color to represent different block types.
 
-in vec4 vs_Pos;  // The array of vertex positions passed to the shader
-in vec4 vs_Nor;  // The array of vertex normals passed to the shader
-in vec4 vs_Col;  // The array of vertex colors passed to the shader.
-in vec4 vs_UV;
-in vec4 vs_BT;
-in vec4 vs_BWts;
+// One chunk vertex packed into 16 bytes, see Vertex in chunk.h for the layout
+in uvec4 vs_Packed;
 
 out vec4 fs_Pos;
 out vec4
     fs_Nor;  // The array of normals that has been transformed by u_ModelInvTr. This is implicitly passed to the fragment shader.
 out vec4 fs_Col;  // The color of each vertex. This is implicitly passed to the fragment shader.
 out vec2 fs_UV;
+flat out vec2 fs_TileOrigin;  // atlas cell of a tiled (greedy-meshed) face
+flat out int fs_Tiled;
 out vec4 fs_BiomeWts;
 flat out int fs_TexIdx;
 out vec4
@@ -48,17 +46,48 @@ const vec4 lightDir = normalize(
 
                // the geometry in the fragment shader.
 
+// Face normals, indexed by the Direction enum in blocktype.h
+const vec3 normals[10] = vec3[](vec3(1, 0, 0),
+                                vec3(-1, 0, 0),
+                                vec3(0, 1, 0),
+                                vec3(0, -1, 0),
+                                vec3(0, 0, 1),
+                                vec3(0, 0, -1),
+                                vec3(1, 0, 1),
+                                vec3(1, 0, -1),
+                                vec3(-1, 0, -1),
+                                vec3(-1, 0, 1));
+
 void main()
 {
-    fs_Pos = vs_Pos;
-    fs_Nor = vec4(normalize(vec3(vs_Nor)), vs_Nor.w);
-    fs_Col = vs_Col;  // Pass the vertex colors to the fragment shader for interpolation
-    fs_UV = vs_UV.xy;
-    fs_TexIdx = int(vs_BT.x);
-    fs_BiomeWts = vs_BWts;
+    // positions and uvs are fixed point with 8 fractional bits
+    vec4 pos = vec4(float(vs_Packed.x & 0x1FFFu),
+                    float(vs_Packed.y & 0x1FFFFu),
+                    float((vs_Packed.x >> 13) & 0x1FFFu),
+                    256.0)
+               / 256.0;
+    vec4 nor = vec4(normals[(vs_Packed.x >> 26) & 0xFu], 1);
+    bool untextured = ((vs_Packed.x >> 31) & 1u) == 1u;
+    vec2 uv = vec2(float(vs_Packed.z & 0xFFFFu), float(vs_Packed.z >> 16)) / 256.0;
+
+    fs_Pos = pos;
+    fs_Nor = vec4(normalize(vec3(nor)), nor.w);
+    // untextured faces are drawn magenta, and flagged to lambert.frag by a negative uv
+    fs_Col = untextured ? vec4(1, 0, 1, 1) : vec4(0);
+    fs_Tiled = int((vs_Packed.x >> 30) & 1u);
+    fs_TexIdx = int((vs_Packed.y >> 17) & 0x7u);
+    fs_TileOrigin = vec2(float((vs_Packed.y >> 20) & 0xFu), float((vs_Packed.y >> 24) & 0xFu))
+                    / 16.0;
+    // uvs are in atlas cells, or in blocks when the face is tiled
+    fs_UV = untextured ? vec2(-1) : (fs_Tiled == 1 ? uv : uv / 16.0);
+    fs_BiomeWts = vec4(float(vs_Packed.w & 0xFFu),
+                       float((vs_Packed.w >> 8) & 0xFFu),
+                       float((vs_Packed.w >> 16) & 0xFFu),
+                       float(vs_Packed.w >> 24))
+                  / 255.0;
 
     mat3 invTranspose = mat3(u_ModelInvTr);
-    fs_Nor = vec4(invTranspose * vec3(vs_Nor),
+    fs_Nor = vec4(invTranspose * vec3(nor),
                   0);  // Pass the vertex normals to the fragment shader for interpolation.
                        // Transform the geometry's normals by the inverse transpose of the
                        // model matrix. This is necessary to ensure the normals remain
@@ -66,7 +95,7 @@ void main()
                        // the model matrix.
 
     vec4 modelposition
-        = u_Model * vs_Pos;    // Temporarily store the transformed vertex positions for use below
+        = u_Model * pos;       // Temporarily store the transformed vertex positions for use below
 
     fs_LightVec = (lightDir);  // Compute the direction in which the light source lies
 
@@ -33,6 +33,11 @@ RESOURCES += glsl.qrc \
     QMAKE_CXXFLAGS += -Wno-strict-aliasing
     QMAKE_CXXFLAGS += -fno-omit-frame-pointer
 }
+*-clang*|*-g++* {
+    # Terrain noise has to round the same on every build machine, which fused
+    # multiply-adds would change depending on the target
+    QMAKE_CXXFLAGS += -ffp-contract=off
+}
 linux-clang*|linux-g++*|macx-clang*|macx-g++* {
     message("Enabling stack protector")
     QMAKE_CXXFLAGS += -fstack-protector-all
@@ -0,0 +1,771 @@
+#include "benchmarks.h"
+#include "scene/biome.h"
+#include "scene/cavefield.h"
+#include "scene/columnnoisecache.h"
+#include "scene/chunk.h"
+#include "scene/editjournal.h"
+#include "scene/floatlanes.h"
+#include "scene/jobsystem.h"
+#include "scene/mpscqueue.h"
+#include "scene/noisehash.h"
+#include "scene/regionstore.h"
+#include "scene/workers.h"
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QTemporaryDir>
+#include <QThread>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// The seed every benchmark generates its terrain from, so that runs are comparable
+static constexpr uint32_t BENCH_SEED = 277;
+
+struct BenchOptions
+{
+    int producers;
+    uint64_t items;
+    int workers;
+};
+
+static BenchOptions parseOptions(int argc, char* argv[])
+{
+    BenchOptions opts{QThread::idealThreadCount(), 1000000, QThread::idealThreadCount()};
+
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], "--producers") == 0) {
+            opts.producers = std::atoi(argv[i + 1]);
+        } else if (std::strcmp(argv[i], "--items") == 0) {
+            opts.items = std::strtoull(argv[i + 1], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--workers") == 0) {
+            opts.workers = std::atoi(argv[i + 1]);
+        }
+    }
+
+    opts.producers = std::max(opts.producers, 1);
+    opts.workers = std::max(opts.workers, 1);
+    return opts;
+}
+
+// Every producer pushes the values 1..items, so the consumer can check
+// that nothing was lost or duplicated from the sum alone
+static uint64_t expectedSum(int producers, uint64_t items)
+{
+    return producers * (items * (items + 1) / 2);
+}
+
+static void report(const char* name, int producers, uint64_t items, int64_t ns, bool ok)
+{
+    double total = static_cast<double>(producers) * items;
+    std::printf("  %-14s %2d producers  %8.2f ms  %8.2f Mitems/s%s\n",
+                name,
+                producers,
+                ns / 1e6,
+                total / (ns / 1e3),
+                ok ? "" : "  SUM MISMATCH");
+}
+
+// N worker threads hand results to one consumer through an MPSCQueue,
+// as the BDWorkers and VBOWorkers do with Terrain
+static void benchMPSCQueue(int producers, uint64_t items)
+{
+    static MPSCQueue<uint64_t, 1024> queue;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([items]() {
+            for (uint64_t i = 1; i <= items; i++) {
+                queue.push(i);
+            }
+        });
+    }
+
+    uint64_t sum = 0;
+    uint64_t popped = 0;
+    uint64_t total = producers * items;
+    uint64_t value;
+    while (popped < total) {
+        if (queue.tryPop(value)) {
+            sum += value;
+            popped++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    report("MPSCQueue",
+           producers,
+           items,
+           timer.nsecsElapsed(),
+           sum == expectedSum(producers, items));
+}
+
+// The same hand-off through a QMutex-guarded vector that the consumer swaps out,
+// which is how Terrain collected worker results before
+static void benchMutexVector(int producers, uint64_t items)
+{
+    QMutex lock;
+    std::vector<uint64_t> shared;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, items]() {
+            for (uint64_t i = 1; i <= items; i++) {
+                lock.lock();
+                shared.push_back(i);
+                lock.unlock();
+            }
+        });
+    }
+
+    uint64_t sum = 0;
+    uint64_t popped = 0;
+    uint64_t total = producers * items;
+    std::vector<uint64_t> local;
+    while (popped < total) {
+        lock.lock();
+        local.swap(shared);
+        lock.unlock();
+
+        if (local.empty()) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        for (uint64_t value : local) {
+            sum += value;
+        }
+        popped += local.size();
+        local.clear();
+    }
+
+    for (std::thread& t : threads) {
+        t.join();
+    }
+    report("QMutex+vector",
+           producers,
+           items,
+           timer.nsecsElapsed(),
+           sum == expectedSum(producers, items));
+}
+
+// The 16 linked, empty Chunks of the 64 x 64 zone with its lower-left corner at (zoneX, 0),
+// in region file order
+static std::vector<uPtr<Chunk>> makeZone(int zoneX)
+{
+    std::vector<uPtr<Chunk>> chunks;
+    for (int i = 0; i < 16; i++) {
+        chunks.push_back(mkU<Chunk>(nullptr));
+        chunks.back()->setWorldPos(zoneX + 16 * (i % 4), 16 * (i / 4));
+        if (i % 4 > 0) {
+            chunks[i]->linkNeighbor(chunks[i - 1], XNEG);
+        }
+        if (i >= 4) {
+            chunks[i]->linkNeighbor(chunks[i - 4], ZNEG);
+        }
+    }
+    return chunks;
+}
+
+// Generates chunks, a zone made by makeZone, from seed on jobs, as a BDWorker does
+// for a zone that's never been saved
+static void generateChunks(const std::vector<uPtr<Chunk>>& chunks,
+                           int zoneX,
+                           uint32_t seed,
+                           JobSystem& jobs)
+{
+    std::vector<Chunk*> toDo;
+    for (const uPtr<Chunk>& c : chunks) {
+        toDo.push_back(c.get());
+    }
+    BDWorker::restoreOrGenerate(toDo, zoneX, 0, RegionStore::ZonePayloads(), seed, jobs);
+}
+
+// Generates the 16 Chunks of a 64 x 64 zone on a JobSystem with the given number of workers,
+// one task per Chunk as BDWorker does, and returns how long it took in ns
+static int64_t generateZone(int workers, int zoneX)
+{
+    std::vector<uPtr<Chunk>> chunks = makeZone(zoneX);
+
+    JobSystem jobs(workers);
+    QElapsedTimer timer;
+    timer.start();
+    generateChunks(chunks, zoneX, BENCH_SEED, jobs);
+    return timer.nsecsElapsed();
+}
+
+// The serialized Chunks of the zone at (zoneX, 0), generated from seed on a JobSystem
+// with the given number of workers
+static std::vector<std::vector<unsigned char>> serializeZone(int workers, int zoneX, uint32_t seed)
+{
+    std::vector<uPtr<Chunk>> chunks = makeZone(zoneX);
+    JobSystem jobs(workers);
+    generateChunks(chunks, zoneX, seed, jobs);
+
+    std::vector<std::vector<unsigned char>> serialized;
+    for (const uPtr<Chunk>& c : chunks) {
+        serialized.push_back(c->serialize());
+    }
+    return serialized;
+}
+
+// Generates the same zone over and over, on different numbers of workers and after the
+// zones around it, and checks it always comes out the same for a seed and differs between
+// seeds. Its Chunks have to come out the same when generated along with a different zone's
+// too, or the structures reaching across their borders would be cut off.
+static void benchDeterminism(int zoneX, int workers)
+{
+    std::vector<std::vector<unsigned char>> first = serializeZone(1, zoneX, BENCH_SEED);
+
+    bool ok = true;
+    for (int round = 0; round < 4; round++) {
+        // Its neighbors first, so that any structure reaching out of them would show up
+        serializeZone(workers, zoneX - 64, BENCH_SEED);
+        serializeZone(workers, zoneX + 64, BENCH_SEED);
+        ok = ok && serializeZone(workers, zoneX, BENCH_SEED) == first;
+    }
+    bool seedMatters = serializeZone(workers, zoneX, BENCH_SEED + 1) != first;
+
+    // The zone's Chunks, generated as parts of the zones that overlap it along x
+    bool shiftedOk = true;
+    for (int shift = 1; shift < 4; shift++) {
+        std::vector<std::vector<unsigned char>> shifted
+            = serializeZone(workers, zoneX + 16 * shift, BENCH_SEED);
+        for (int i = 0; i < 16; i++) {
+            if (i % 4 + shift < 4) {
+                shiftedOk = shiftedOk && shifted[i] == first[i + shift];
+            }
+        }
+    }
+
+    std::printf("  seed %u on 1 and %d workers: %s  in another zone: %s  another seed: %s\n",
+                static_cast<unsigned>(BENCH_SEED),
+                workers,
+                ok ? "identical" : "MISMATCH",
+                shiftedOk ? "identical" : "MISMATCH",
+                seedMatters ? "different" : "SAME TERRAIN");
+}
+
+// Generates a zone, saves it to a region file, and times reading it back against
+// generating it, checking that every block survives the round trip
+static void benchRegionFile(int zoneX)
+{
+    QTemporaryDir dir;
+    RegionStore regions(dir.path(), BENCH_SEED);
+
+    std::vector<uPtr<Chunk>> generated = makeZone(zoneX);
+    JobSystem jobs(1);
+    QElapsedTimer timer;
+    timer.start();
+    generateChunks(generated, zoneX, BENCH_SEED, jobs);
+    int64_t generateNs = timer.nsecsElapsed();
+
+    RegionStore::ZonePayloads payloads;
+    for (int i = 0; i < 16; i++) {
+        payloads[i] = generated[i]->serialize();
+    }
+    regions.saveChunks(zoneX, 0, std::move(payloads));
+    regions.flush();
+
+    std::vector<uPtr<Chunk>> loaded = makeZone(zoneX);
+    timer.restart();
+    RegionStore::ZonePayloads saved;
+    bool ok = regions.loadZone(zoneX, 0, saved);
+    for (int i = 0; i < 16; i++) {
+        ok = loaded[i]->deserialize(saved[i].data(), saved[i].size()) && ok;
+    }
+    int64_t loadNs = timer.nsecsElapsed();
+
+    for (int i = 0; i < 16 && ok; i++) {
+        const Chunk& a = *generated[i];
+        const Chunk& b = *loaded[i];
+        for (int x = 0; x < 16; x++) {
+            for (int y = 0; y < 256; y++) {
+                for (int z = 0; z < 16; z++) {
+                    ok = ok && a.getBlockAt(x, y, z) == b.getBlockAt(x, y, z);
+                }
+            }
+        }
+    }
+
+    QFile file(regions.zonePath(zoneX, 0));
+    file.open(QIODevice::ReadOnly);
+    std::printf("  generate %8.2f ms  load %8.2f ms  %6.1fx  %6lld KB on disk%s\n",
+                generateNs / 1e6,
+                loadNs / 1e6,
+                static_cast<double>(generateNs) / loadNs,
+                static_cast<long long>(file.size() / 1024),
+                ok ? "" : "  ROUND TRIP MISMATCH");
+}
+
+// Encodes and decodes the Chunks of a generated zone with the block stream codec,
+// reporting its compression ratio and throughput against the palettes Chunks keep in memory
+static void benchChunkCodec(int zoneX)
+{
+    static constexpr int ROUNDS = 20;
+    std::vector<uPtr<Chunk>> chunks = makeZone(zoneX);
+    JobSystem jobs(1);
+    generateChunks(chunks, zoneX, BENCH_SEED, jobs);
+    std::size_t paletteBytes = 0;
+    for (uPtr<Chunk>& c : chunks) {
+        paletteBytes += c->blockMemoryUsage();
+    }
+
+    std::vector<std::vector<unsigned char>> encoded(chunks.size());
+    QElapsedTimer timer;
+    timer.start();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (std::size_t i = 0; i < chunks.size(); i++) {
+            encoded[i].clear();
+            chunks[i]->encodeBlocks(encoded[i]);
+        }
+    }
+    int64_t encodeNs = timer.nsecsElapsed();
+
+    std::vector<uPtr<Chunk>> decoded = makeZone(zoneX);
+    bool ok = true;
+    timer.restart();
+    for (int round = 0; round < ROUNDS; round++) {
+        for (std::size_t i = 0; i < chunks.size(); i++) {
+            const unsigned char* data = encoded[i].data();
+            ok = decoded[i]->decodeBlocks(data, data + encoded[i].size()) && ok;
+        }
+    }
+    int64_t decodeNs = timer.nsecsElapsed();
+
+    std::size_t encodedBytes = 0;
+    for (std::size_t i = 0; i < chunks.size(); i++) {
+        encodedBytes += encoded[i].size();
+        const Chunk& a = *chunks[i];
+        const Chunk& b = *decoded[i];
+        for (int x = 0; x < 16 && ok; x++) {
+            for (int y = 0; y < 256; y++) {
+                for (int z = 0; z < 16; z++) {
+                    ok = ok && a.getBlockAt(x, y, z) == b.getBlockAt(x, y, z);
+                }
+            }
+        }
+    }
+
+    // Reads straight from the packed form, as Chunks far from the player do
+    chunks[5]->packBlocks();
+    ChunkSnapshot snap;
+    timer.restart();
+    chunks[5]->takeSnapshot(snap);
+    int64_t snapshotNs = timer.nsecsElapsed();
+    for (int x = 0; x < 16 && ok; x++) {
+        for (int y = 0; y < 256; y++) {
+            for (int z = 0; z < 16; z++) {
+                ok = ok && snap.getBlockAt(x, y, z) == decoded[5]->getBlockAt(x, y, z);
+            }
+        }
+    }
+
+    double rawMB = double(chunks.size()) * 16 * 256 * 16 * ROUNDS / (1 << 20);
+    std::printf("  %6.1f KB raw  %6.1f KB paletted  %6.1f KB encoded  %6.1fx\n",
+                chunks.size() * 64.0,
+                paletteBytes / 1024.0,
+                encodedBytes / 1024.0,
+                chunks.size() * 65536.0 / encodedBytes);
+    std::printf("  encode %8.1f MB/s  decode %8.1f MB/s  packed snapshot %6.2f ms%s\n",
+                rawMB / (encodeNs / 1e9),
+                rawMB / (decodeNs / 1e9),
+                snapshotNs / 1e6,
+                ok ? "" : "  ROUND TRIP MISMATCH");
+}
+
+// Times calls to f(i) for i in [0, calls) and prints nanoseconds per call. The results
+// are summed into sink so the calls can't be optimized away.
+template<typename F>
+static void timeKernel(const char* name, int calls, float& sink, F f)
+{
+    QElapsedTimer timer;
+    timer.start();
+    float sum = 0.f;
+    for (int i = 0; i < calls; i++) {
+        sum += f(i);
+    }
+    int64_t ns = timer.nsecsElapsed();
+    sink += sum;
+    std::printf("  %-24s %7.2f ns/call\n", name, static_cast<double>(ns) / calls);
+}
+
+// Times each noise kernel and the noise built on them, next to the sin-based hash
+// they replaced
+static void benchNoiseKernels(int calls)
+{
+    float sink = 0.f;
+    // Spreads consecutive calls over the plane, so neither hashing nor the noise built
+    // on it sees the same point twice in a row
+    auto at = [](int i) { return glm::vec2(float(i % 1024) * 1.37f, float(i / 1024) * 0.73f); };
+
+    timeKernel("sin hash (old noise1D)", calls, sink, [&](int i) {
+        glm::vec2 p = at(i);
+        return glm::fract(std::sin(glm::dot(p, glm::vec2(127.1, 311.7))) * 43758.5453);
+    });
+    timeKernel("NoiseHash::hash x", calls, sink, [&](int i) {
+        return NoiseHash::unit(NoiseHash::hash(uint32_t(i), 0u));
+    });
+    timeKernel("NoiseHash::hash x y", calls, sink, [&](int i) {
+        return NoiseHash::unit(NoiseHash::hash(uint32_t(i), uint32_t(i >> 10), 0u));
+    });
+    timeKernel("NoiseHash::hash x y z", calls, sink, [&](int i) {
+        return NoiseHash::unit(NoiseHash::hash(uint32_t(i), uint32_t(i >> 10), 7u, 0u));
+    });
+    timeKernel("noise1D(float)", calls, sink, [&](int i) {
+        return Biome::noise1D(at(i).x, BENCH_SEED);
+    });
+    timeKernel("noise1D(vec2)", calls, sink, [&](int i) {
+        return Biome::noise1D(at(i), BENCH_SEED);
+    });
+    timeKernel("noise1D(vec3)", calls, sink, [&](int i) {
+        return Biome::noise1D(glm::vec3(at(i), 64.f), BENCH_SEED);
+    });
+    timeKernel("noise2D", calls, sink, [&](int i) { return Biome::noise2D(at(i), BENCH_SEED).x; });
+    timeKernel("noise3D", calls, sink, [&](int i) {
+        return Biome::noise3D(glm::vec3(at(i), 64.f), BENCH_SEED).x;
+    });
+    timeKernel("perlin1", calls, sink, [&](int i) {
+        return Biome::perlin1(at(i) / 32.f, BENCH_SEED);
+    });
+    timeKernel("perlin2", calls, sink, [&](int i) {
+        return Biome::perlin2(at(i) / 32.f, BENCH_SEED);
+    });
+    timeKernel("perlin3D", calls, sink, [&](int i) {
+        return Biome::perlin3D(glm::vec3(at(i), 64.f) * 0.06f, BENCH_SEED);
+    });
+    timeKernel("worley", calls, sink, [&](int i) {
+        return Biome::worley(at(i) / 256.f, BENCH_SEED);
+    });
+    timeKernel("voronoi", calls, sink, [&](int i) {
+        return Biome::voronoi(at(i), 5, BENCH_SEED).x;
+    });
+    timeKernel("fbm(vec2)", calls, sink, [&](int i) {
+        return Biome::fbm(at(i) / 237.f, BENCH_SEED);
+    });
+    timeKernel("fbm(float)", calls, sink, [&](int i) {
+        return Biome::fbm(at(i).x / 237.f, BENCH_SEED);
+    });
+    std::printf("  (checksum %g)\n", sink);
+}
+
+// Times the 2D noise helperCreate needs for each Chunk's columns, one point at a time
+// against the batch grids, and checks the grids match the scalar noise bit for bit
+static void benchNoiseGrid(int chunks)
+{
+    using NoiseGrid = void (*)(glm::vec2, int, int, float*, uint32_t);
+    using NoiseAt = float (*)(glm::vec2, uint32_t);
+    static const NoiseGrid grids[] = {Biome::mountainsGrid,
+                                      Biome::hillsGrid,
+                                      Biome::forestGrid,
+                                      Biome::islandsGrid};
+    static const NoiseAt scalars[] = {Biome::mountains,
+                                      Biome::hills,
+                                      Biome::forest,
+                                      Biome::islands};
+    static const float fbmScales[] = {1.f, 237.f, 189.f};
+
+    std::vector<float> scalar;
+    scalar.reserve(chunks * 256 * 7);
+    QElapsedTimer timer;
+    timer.start();
+    for (int c = 0; c < chunks; c++) {
+        for (int z = 0; z < 16; z++) {
+            for (int x = 0; x < 16; x++) {
+                glm::vec2 p(16 * c + x, z);
+                for (NoiseAt noise : scalars) {
+                    scalar.push_back(noise(p, BENCH_SEED));
+                }
+                for (float scale : fbmScales) {
+                    scalar.push_back(Biome::fbm(p / scale, BENCH_SEED));
+                }
+            }
+        }
+    }
+    int64_t scalarNs = timer.nsecsElapsed();
+
+    std::vector<float> grid(chunks * 256 * 7);
+    timer.restart();
+    for (int c = 0; c < chunks; c++) {
+        glm::vec2 origin(16 * c, 0);
+        float* out = &grid[c * 256 * 7];
+        for (NoiseGrid noise : grids) {
+            noise(origin, 16, 16, out, BENCH_SEED);
+            out += 256;
+        }
+        for (float scale : fbmScales) {
+            Biome::fbmGrid(origin, 16, 16, scale, out, BENCH_SEED);
+            out += 256;
+        }
+    }
+    int64_t gridNs = timer.nsecsElapsed();
+
+    // The scalar results are point by point, the grid ones noise by noise
+    bool ok = true;
+    for (int c = 0; c < chunks; c++) {
+        for (int i = 0; i < 256; i++) {
+            for (int n = 0; n < 7; n++) {
+                float a = scalar[(c * 256 + i) * 7 + n];
+                float b = grid[(c * 7 + n) * 256 + i];
+                ok = ok && std::memcmp(&a, &b, sizeof(float)) == 0;
+            }
+        }
+    }
+
+    std::printf("  scalar %6.2f ms/chunk  grid %6.2f ms/chunk  %5.2fx%s\n",
+                scalarNs / 1e6 / chunks,
+                gridNs / 1e6 / chunks,
+                static_cast<double>(scalarNs) / gridNs,
+                ok ? "" : "  MISMATCH");
+}
+
+// Times the cave density for a row of Chunks at each CaveQuality, and measures how far
+// the interpolated density strays from the full-resolution one and how many blocks it
+// carves differently
+static void benchCaveField(int chunks)
+{
+    static const CaveQuality qualities[] = {CaveQuality::FULL,
+                                            CaveQuality::MEDIUM,
+                                            CaveQuality::COARSE};
+    static const char* names[] = {"full", "medium", "coarse"};
+
+    std::vector<CaveField> full;
+    int64_t fullNs = 0;
+    for (int q = 0; q < 3; q++) {
+        std::vector<CaveField> fields;
+        fields.reserve(chunks);
+        QElapsedTimer timer;
+        timer.start();
+        for (int c = 0; c < chunks; c++) {
+            fields.emplace_back(16 * c, -16 * c, BENCH_SEED, qualities[q], nullptr);
+        }
+        int64_t ns = timer.nsecsElapsed();
+        if (q == 0) {
+            full = std::move(fields);
+            fullNs = ns;
+            std::printf("  %-6s  %7.2f ms/chunk\n", names[q], ns / 1e6 / chunks);
+            continue;
+        }
+
+        double errorSum = 0.0;
+        float maxError = 0.f;
+        int64_t blocks = 0;
+        int64_t caveBlocks = 0;
+        int64_t misplaced = 0;
+        for (int c = 0; c < chunks; c++) {
+            for (int y = CaveField::MIN_Y; y <= CaveField::MAX_Y; y++) {
+                for (int z = 0; z < 16; z++) {
+                    for (int x = 0; x < 16; x++) {
+                        float error = std::abs(fields[c].densityAt(x, y, z)
+                                               - full[c].densityAt(x, y, z));
+                        errorSum += error;
+                        maxError = std::max(maxError, error);
+                        blocks++;
+                        caveBlocks += full[c].isCave(x, y, z);
+                        misplaced += fields[c].isCave(x, y, z) != full[c].isCave(x, y, z);
+                    }
+                }
+            }
+        }
+        std::printf("  %-6s  %7.2f ms/chunk  %5.1fx  density error mean %.4f max %.4f  "
+                    "%5.2f%% of blocks carved differently (caves are %5.2f%%)\n",
+                    names[q],
+                    ns / 1e6 / chunks,
+                    static_cast<double>(fullNs) / ns,
+                    errorSum / blocks,
+                    maxError,
+                    100.0 * misplaced / blocks,
+                    100.0 * caveBlocks / blocks);
+    }
+}
+
+// Builds the cave density for a square of Chunks with and without a ColumnNoiseCache,
+// checking the cache changes nothing and reporting how often neighbors hit it
+static void benchColumnNoiseCache(int side)
+{
+    static const CaveQuality qualities[] = {CaveQuality::MEDIUM, CaveQuality::COARSE};
+    static const char* names[] = {"medium", "coarse"};
+
+    for (int q = 0; q < 2; q++) {
+        ColumnNoiseCache cache(16384);
+        int64_t ns[2];
+        std::vector<CaveField> fields[2];
+        for (int cached = 0; cached <= 1; cached++) {
+            QElapsedTimer timer;
+            timer.start();
+            for (int c = 0; c < side * side; c++) {
+                fields[cached].emplace_back(16 * (c % side),
+                                            16 * (c / side) + 4096,
+                                            BENCH_SEED,
+                                            qualities[q],
+                                            cached ? &cache : nullptr);
+            }
+            ns[cached] = timer.nsecsElapsed();
+        }
+
+        bool ok = true;
+        for (int c = 0; c < side * side && ok; c++) {
+            for (int y = CaveField::MIN_Y; y <= CaveField::MAX_Y; y++) {
+                for (int z = 0; z < 16; z++) {
+                    for (int x = 0; x < 16; x++) {
+                        ok = ok
+                             && fields[0][c].densityAt(x, y, z) == fields[1][c].densityAt(x, y, z);
+                    }
+                }
+            }
+        }
+
+        uint64_t lookups = cache.hits() + cache.misses();
+        std::printf("  %-6s  uncached %6.2f ms/chunk  cached %6.2f ms/chunk  %5.2fx  "
+                    "%llu hits %llu misses (%4.1f%%)%s\n",
+                    names[q],
+                    ns[0] / 1e6 / (side * side),
+                    ns[1] / 1e6 / (side * side),
+                    static_cast<double>(ns[0]) / ns[1],
+                    static_cast<unsigned long long>(cache.hits()),
+                    static_cast<unsigned long long>(cache.misses()),
+                    100.0 * cache.hits() / lookups,
+                    ok ? "" : "  MISMATCH");
+    }
+
+    ColumnNoiseCache& shared = ColumnNoiseCache::instance();
+    std::printf("  shared cache after the runs above: %llu hits %llu misses, %zu entries\n",
+                static_cast<unsigned long long>(shared.hits()),
+                static_cast<unsigned long long>(shared.misses()),
+                shared.size());
+}
+
+// Records edits scattered over a zone, then times rebuilding the zone from generation
+// plus the journal, and checks the journal's size grows with the edits alone
+static void benchEditJournal(int zoneX, int edits)
+{
+    QTemporaryDir dir;
+    QString path = dir.filePath("edits.journal");
+
+    JobSystem jobs(1);
+    std::vector<uPtr<Chunk>> edited = makeZone(zoneX);
+    generateChunks(edited, zoneX, BENCH_SEED, jobs);
+    {
+        EditJournal journal(path);
+        uint32_t state = 1;
+        for (int i = 0; i < edits; i++) {
+            state = state * 1664525u + 1013904223u;
+            int x = state % 64;
+            int y = 64 + (state >> 8) % 128;
+            int z = (state >> 16) % 64;
+            BlockType t = (state >> 24) % 2 ? EMPTY : STONE;
+            journal.record(zoneX + x, y, z, t);
+            edited[x / 16 + 4 * (z / 16)]->setBlockAt(x % 16, y, z % 16, t);
+        }
+    }
+
+    std::vector<uPtr<Chunk>> rebuilt = makeZone(zoneX);
+    QElapsedTimer timer;
+    timer.start();
+    EditJournal journal(path);
+    int64_t readNs = timer.nsecsElapsed();
+    generateChunks(rebuilt, zoneX, BENCH_SEED, jobs);
+    timer.restart();
+    for (uPtr<Chunk>& c : rebuilt) {
+        journal.replay(c.get());
+    }
+    int64_t replayNs = timer.nsecsElapsed();
+
+    bool ok = true;
+    for (int i = 0; i < 16 && ok; i++) {
+        const Chunk& a = *edited[i];
+        const Chunk& b = *rebuilt[i];
+        for (int x = 0; x < 16; x++) {
+            for (int y = 0; y < 256; y++) {
+                for (int z = 0; z < 16; z++) {
+                    ok = ok && a.getBlockAt(x, y, z) == b.getBlockAt(x, y, z);
+                }
+            }
+        }
+    }
+
+    QFile file(path);
+    file.open(QIODevice::ReadOnly);
+    std::printf("  %6d edits  read %8.2f ms  replay %8.2f ms  %6lld KB on disk%s\n",
+                edits,
+                readNs / 1e6,
+                replayNs / 1e6,
+                static_cast<long long>(file.size() / 1024),
+                ok ? "" : "  REPLAY MISMATCH");
+}
+
+int runBenchmarks(int argc, char* argv[])
+{
+    BenchOptions opts = parseOptions(argc, argv);
+
+    std::printf("Completion queue stress test, %llu items per producer\n",
+                static_cast<unsigned long long>(opts.items));
+    // Double the producer count each round, finishing with the requested count
+    for (int producers = 1;; producers = std::min(producers * 2, opts.producers)) {
+        benchMPSCQueue(producers, opts.items);
+        benchMutexVector(producers, opts.items);
+        if (producers == opts.producers) {
+            break;
+        }
+    }
+
+    std::printf("Zone generation on the work-stealing JobSystem\n");
+    int64_t serialNs = 0;
+    for (int workers = 1;; workers = std::min(workers * 2, opts.workers)) {
+        // A different zone each round, so no round reuses another's generation
+        int64_t ns = generateZone(workers, 64 * workers);
+        if (workers == 1) {
+            serialNs = ns;
+        }
+        std::printf("  %2d workers  %8.2f ms  %5.2fx\n",
+                    workers,
+                    ns / 1e6,
+                    static_cast<double>(serialNs) / ns);
+        if (workers == opts.workers) {
+            break;
+        }
+    }
+
+    std::printf("Zone generation from a seed\n");
+    benchDeterminism(256, opts.workers);
+
+    std::printf("Noise kernels\n");
+    benchNoiseKernels(1 << 20);
+
+    std::printf("Column noise for Chunk generation, %d lanes\n", FloatLanes::COUNT);
+    benchNoiseGrid(64);
+
+    std::printf("Cave density against the full-resolution noise\n");
+    benchCaveField(16);
+
+    std::printf("Cave lattice shared between neighboring Chunks\n");
+    benchColumnNoiseCache(8);
+
+    std::printf("Zone region file against generation\n");
+    benchRegionFile(-64);
+
+    std::printf("Block stream codec on a generated zone\n");
+    benchChunkCodec(-192);
+
+    std::printf("Zone rebuilt from generation and the edit journal\n");
+    for (int edits = 100; edits <= 100000; edits *= 10) {
+        benchEditJournal(-128, edits);
+    }
+
+    return 0;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+// Microbenchmarks for the engine's hot paths, run with `MiniMinecraft --bench`
+// instead of opening the game window. Results are printed to stdout.
+// Options:
+//   --producers N   most producer threads for the queue stress test (default: core count)
+//   --items N       items pushed by each producer (default: 1000000)
+//   --workers N     most JobSystem workers for the zone generation test (default: core count)
+int runBenchmarks(int argc, char* argv[]);
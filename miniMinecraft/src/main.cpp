@@ -1,8 +1,13 @@
 #include <mainwindow.h>
+#include "benchmarks.h"
+#include "scene/jobsystem.h"
+#include "scene/terrain.h"
 
 #include <QApplication>
 #include <QSurfaceFormat>
 #include <QDebug>
+#include <cstdlib>
+#include <cstring>
 
 void debugFormatVersion()
 {
@@ -20,6 +25,29 @@ void debugFormatVersion()
 
 int main(int argc, char* argv[])
 {
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--bench") == 0) {
+            return runBenchmarks(argc, argv);
+        }
+        // How many threads generate and mesh terrain (default: one per core, less one)
+        if (std::strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+            JobSystem::setDefaultWorkerCount(std::atoi(argv[i + 1]));
+        }
+        // How many MB of Chunks to keep before evicting the least recently used zones
+        if (std::strcmp(argv[i], "--memory-budget") == 0 && i + 1 < argc) {
+            Terrain::setDefaultMemoryBudget(std::size_t(std::atoi(argv[i + 1])) << 20);
+        }
+        // Where the world is saved (default: ./world); an empty path doesn't save it
+        if (std::strcmp(argv[i], "--world") == 0 && i + 1 < argc) {
+            Terrain::setDefaultWorldDirectory(argv[i + 1]);
+        }
+        // The seed a new world is generated from (default: a random one).
+        // A saved world keeps the seed it was created with.
+        if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            Terrain::setDefaultSeed(uint32_t(std::strtoul(argv[i + 1], nullptr, 10)));
+        }
+    }
+
     QApplication a(argc, argv);
 
     // Set OpenGL 4.0 and, optionally, 4-sample multisampling
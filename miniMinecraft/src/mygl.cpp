@@ -38,13 +38,13 @@ MyGL::MyGL(QWidget* parent)
     setCursor(Qt::BlankCursor);  // Make the cursor invisible
 
     for (int i = 0; i < 10; i++) {
-        uPtr<Mob> newMob = mkU<Mob>(this);
+        uPtr<Mob> newMob = mkU<Mob>(this, m_terrain.mobRng(m_mobs.size()));
         newMob->m_inputs.isPig = true;
         m_mobs.push_back(std::move(newMob));
     }
 
     for (int i = 0; i < 8; i++) {
-        uPtr<Mob> newMob = mkU<Mob>(this);
+        uPtr<Mob> newMob = mkU<Mob>(this, m_terrain.mobRng(m_mobs.size()));
         newMob->m_inputs.isZombie = true;
         m_mobs.push_back(std::move(newMob));
     }
@@ -188,7 +188,7 @@ void MyGL::tick()
         m_progLiquid.setGeometryColor(glm::vec4(0.f, 0.f, 0.f, 1.f));
     }
 
-    m_terrain.multithreadedWork(m_player.m_position, prevPlayerPos, dT);
+    m_terrain.multithreadedWork(m_player.m_position, prevPlayerPos, m_player.m_forward, dT);
     update();               // Calls paintGL() as part of a larger QOpenGLWidget pipeline
     sendPlayerDataToGUI();  // Updates the info in the secondary window displaying
                             // player data
@@ -310,7 +310,13 @@ void MyGL::renderTerrain()
     int x = 16 * xFloor;
     int z = 16 * zFloor;
 
-    m_terrain.draw(x - 1024, x + 1024, z - 1024, z + 1024, &m_progLambert, m_mobs);
+    m_terrain.draw(x - 1024,
+                   x + 1024,
+                   z - 1024,
+                   z + 1024,
+                   m_player.mcr_camera->getViewProj(),
+                   &m_progLambert,
+                   m_mobs);
 }
 
 void MyGL::keyPressEvent(QKeyEvent* e)
@@ -353,6 +359,24 @@ void MyGL::keyPressEvent(QKeyEvent* e)
         m_player.m_inputs.flightMode = !m_player.m_inputs.flightMode;
     }
 
+    // Terrain streaming: [ and ] shrink and grow the radius, - and = the lookahead
+    StreamingController& streaming = m_terrain.streaming();
+    if (e->key() == Qt::Key_BracketLeft) {
+        streaming.setRadius(streaming.getRadius() - 1);
+    }
+
+    if (e->key() == Qt::Key_BracketRight) {
+        streaming.setRadius(streaming.getRadius() + 1);
+    }
+
+    if (e->key() == Qt::Key_Minus) {
+        streaming.setLookahead(streaming.getLookahead() - 0.5f);
+    }
+
+    if (e->key() == Qt::Key_Equal) {
+        streaming.setLookahead(streaming.getLookahead() + 0.5f);
+    }
+
     if (m_player.m_inputs.flightMode) {
         if (e->key() == Qt::Key_Q) {
             m_player.m_inputs.qPressed = true;
@@ -1,34 +1,35 @@
 #include "biome.h"
+#include "floatlanes.h"
+#include "noisehash.h"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
-#include <random>
+#include <vector>
 
 Biome::Biome() {}
 
-int Biome::getRandomIntInRange(int min, int max)
-{
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<> distr(min, max);
-
-    return distr(gen);
-}
+// Salts the world seed is mixed with for each kind of noise below, so that they don't
+// repeat one another at the same point
+static constexpr uint32_t SALT_NOISE_1D = 0x00000000u;
+static constexpr uint32_t SALT_NOISE_2D = 0x68E31DA4u;
+static constexpr uint32_t SALT_NOISE_3D = 0xB5297A4Du;
 
-float Biome::noise1D(float x)
+float Biome::noise1D(float x, uint32_t seed)
 {
-    return glm::fract(std::pow(x, 4) / 4.f);
+    return NoiseHash::unit(NoiseHash::hash(NoiseHash::bits(x), seed ^ SALT_NOISE_1D));
 }
 
-float Biome::interpNoise(float x)
+float Biome::interpNoise(float x, uint32_t seed)
 {
     int intX = int(floor(x));
     float fractX = glm::fract(x);
 
-    float v1 = noise1D(intX);
-    float v2 = noise1D(intX + 1);
+    float v1 = noise1D(intX, seed);
+    float v2 = noise1D(intX + 1, seed);
     return glm::mix(v1, v2, fractX);
 }
 
-float Biome::fbm(float x)
+float Biome::fbm(float x, uint32_t seed)
 {
     float total = 0;
     float persistence = 0.5f;
@@ -36,7 +37,7 @@ float Biome::fbm(float x)
     float freq = 2.f;
     float amp = 0.5f;
     for (int i = 1; i <= octaves; i++) {
-        total += interpNoise(x * freq) * amp;
+        total += interpNoise(x * freq, seed) * amp;
 
         freq *= 2.f;
         amp *= persistence;
@@ -44,42 +45,52 @@ float Biome::fbm(float x)
     return total;
 }
 
-float Biome::noise1D(glm::vec2 p)
+float Biome::noise1D(glm::vec2 p, uint32_t seed)
 {
-    return glm::fract(sin(glm::dot(p, glm::vec2(127.1, 311.7))) * 43758.5453);
+    return NoiseHash::unit(NoiseHash::hash(NoiseHash::bits(p.x),
+                                           NoiseHash::bits(p.y),
+                                           seed ^ SALT_NOISE_1D));
 }
 
-glm::vec2 Biome::noise2D(glm::vec2 p)
+glm::vec2 Biome::noise2D(glm::vec2 p, uint32_t seed)
 {
-    float x = glm::fract(43758.5453 * glm::sin(glm::dot(p, glm::vec2(127.1, 311.7))));
-    float y = glm::fract(43758.5453 * glm::sin(glm::dot(p, glm::vec2(269.5, 183.3))));
-    return glm::vec2(x, y);
+    uint32_t h = NoiseHash::hash(NoiseHash::bits(p.x),
+                                 NoiseHash::bits(p.y),
+                                 seed ^ SALT_NOISE_2D);
+    return glm::vec2(NoiseHash::unit(h), NoiseHash::unit(NoiseHash::next(h)));
 }
 
-float Biome::noise1D(glm::vec3 p)
+float Biome::noise1D(glm::vec3 p, uint32_t seed)
 {
-    return glm::fract(sin(glm::dot(p, glm::vec3(127.1, 311.7, 191.999))) * 43758.5453);
+    return NoiseHash::unit(NoiseHash::hash(NoiseHash::bits(p.x),
+                                           NoiseHash::bits(p.y),
+                                           NoiseHash::bits(p.z),
+                                           seed ^ SALT_NOISE_1D));
 }
 
-glm::vec3 Biome::noise3D(glm::vec2 p)
+glm::vec3 Biome::noise3D(glm::vec3 p, uint32_t seed)
 {
-    float x = glm::fract(43758.5453 * glm::sin(glm::dot(p, glm::vec2(127.1, 311.7))));
-    float y = glm::fract(43758.5453 * glm::sin(glm::dot(p, glm::vec2(269.5, 183.3))));
-    float z = glm::fract(43758.5453 * glm::sin(glm::dot(p, glm::vec2(420.6, 631.2))));
-    return glm::vec3(x, y, z);
+    uint32_t h = NoiseHash::hash(NoiseHash::bits(p.x),
+                                 NoiseHash::bits(p.y),
+                                 NoiseHash::bits(p.z),
+                                 seed ^ SALT_NOISE_3D);
+    uint32_t h2 = NoiseHash::next(h);
+    return glm::vec3(NoiseHash::unit(h),
+                     NoiseHash::unit(h2),
+                     NoiseHash::unit(NoiseHash::next(h2)));
 }
 
-float Biome::interpNoise(float x, float y)
+float Biome::interpNoise(float x, float y, uint32_t seed)
 {
     int intX = int(floor(x));
     float fractX = glm::fract(x);
     int intY = int(floor(y));
     float fractY = glm::fract(y);
 
-    float v1 = noise1D(glm::vec2(intX, intY));
-    float v2 = noise1D(glm::vec2(intX + 1, intY));
-    float v3 = noise1D(glm::vec2(intX, intY + 1));
-    float v4 = noise1D(glm::vec2(intX + 1, intY + 1));
+    float v1 = noise1D(glm::vec2(intX, intY), seed);
+    float v2 = noise1D(glm::vec2(intX + 1, intY), seed);
+    float v3 = noise1D(glm::vec2(intX, intY + 1), seed);
+    float v4 = noise1D(glm::vec2(intX + 1, intY + 1), seed);
 
     // mix is a glsl fn that returns a lin interp btwn 2 vals based on some t s.t. 0<t<1
     float i1 = glm::mix(v1, v2, fractX);
@@ -87,7 +98,7 @@ float Biome::interpNoise(float x, float y)
     return glm::mix(i1, i2, fractY);
 }
 
-float Biome::fbm(const glm::vec2 uv)
+float Biome::fbm(const glm::vec2 uv, uint32_t seed)
 {
     float total = 0;
     float persistence = 0.5f;
@@ -95,14 +106,14 @@ float Biome::fbm(const glm::vec2 uv)
     float freq = 2.f;
     float amp = 0.5f;
     for (int i = 1; i <= octaves; i++) {
-        total += interpNoise(uv.x * freq, uv.y * freq) * amp;
+        total += interpNoise(uv.x * freq, uv.y * freq, seed) * amp;
         freq *= 2.f;
         amp *= persistence;
     }
     return total;
 }
 
-float Biome::worley(glm::vec2 uv)
+float Biome::worley(glm::vec2 uv, uint32_t seed)
 {
     uv *= 10;  // Now the space is 10x10 instead of 1x1. Change this to any number you want.
     glm::vec2 uvInt = glm::floor(uv);
@@ -112,8 +123,8 @@ float Biome::worley(glm::vec2 uv)
         for (int x = -1; x <= 1; ++x) {
             glm::vec2 neighbor = glm::vec2(float(x),
                                            float(y));  // Direction in which neighbor cell lies
-            glm::vec2 point = noise2D(
-                uvInt + neighbor);  // Get the Voronoi centerpoint for the neighboring cell
+            // Get the Voronoi centerpoint for the neighboring cell
+            glm::vec2 point = noise2D(uvInt + neighbor, seed);
             glm::vec2 diff
                 = neighbor + point
                   - uvFract;  // Distance between fragment coord and neighbor’s Voronoi point
@@ -124,22 +135,41 @@ float Biome::worley(glm::vec2 uv)
     return minDist;
 }
 
-glm::vec2 Biome::voronoi(glm::vec2 uv, int scale)
+glm::vec2 Biome::voronoi(glm::vec2 uv, int scale, uint32_t seed)
+{
+    return voronoi(uv, voronoiJitter(uv, seed), scale);
+}
+
+glm::vec2 Biome::voronoiJitter(glm::vec2 uv, uint32_t seed)
 {
-    glm::vec2 offset = noise2D(uv / 217.f);  // Get the Voronoi centerpoint for this cell
+    return noise2D(uv / 217.f, seed);  // Get the Voronoi centerpoint for this cell
+}
+
+glm::vec2 Biome::voronoi(glm::vec2 uv, glm::vec2 jitter, int scale)
+{
+    glm::vec2 offset = jitter;
     offset *= scale;
     return glm::floor(uv + offset);
 }
 
-float Biome::surflet1(glm::vec2 P, glm::vec2 gridPoint)
+// surflet1's falloff along one axis. Shared with perlinGrid, which has to round it the same way.
+// The powers are multiplied out rather than left to pow, which isn't rounded the same way
+// by every C library.
+static float surflet1Falloff(float dist)
+{
+    float dist3 = dist * dist * dist;
+    float dist4 = dist3 * dist;
+    float dist5 = dist4 * dist;
+    return 1 - 6 * dist5 + 15 * dist4 - 10 * dist3;
+}
+
+float Biome::surflet1(glm::vec2 P, glm::vec2 gridPoint, uint32_t seed)
 {
     // Compute falloff function by converting linear distance to a polynomial
-    float distX = abs(P.x - gridPoint.x);
-    float distY = abs(P.y - gridPoint.y);
-    float tX = 1 - 6 * pow(distX, 5.f) + 15 * pow(distX, 4.f) - 10 * pow(distX, 3.f);
-    float tY = 1 - 6 * pow(distY, 5.f) + 15 * pow(distY, 4.f) - 10 * pow(distY, 3.f);
+    float tX = surflet1Falloff(abs(P.x - gridPoint.x));
+    float tY = surflet1Falloff(abs(P.y - gridPoint.y));
     // Get the random vector for the grid point
-    glm::vec2 gradient = 2.f * noise2D(gridPoint) - glm::vec2(1.f);
+    glm::vec2 gradient = 2.f * noise2D(gridPoint, seed) - glm::vec2(1.f);
     // Get the vector from the grid point to P
     glm::vec2 diff = P - gridPoint;
     // Get the value of our height field by dotting grid->P with our gradient
@@ -148,15 +178,17 @@ float Biome::surflet1(glm::vec2 P, glm::vec2 gridPoint)
     return height * tX * tY;
 }
 
-float Biome::surflet2(glm::vec2 P, glm::vec2 gridPoint)
+float Biome::surflet2(glm::vec2 P, glm::vec2 gridPoint, uint32_t seed)
 {
     // Compute falloff function by converting linear distance to a polynomial
     float distX = abs(P.x - gridPoint.x);
     float distY = abs(P.y - gridPoint.y);
-    float tX = 1 - 3 * pow(distX, 4.f) + 14 * pow(distX, 3.f) - 12 * pow(distX, 4.f);
-    float tY = 1 - 3 * pow(distY, 4.f) + 14 * pow(distY, 3.f) - 12 * pow(distY, 4.f);
+    float distX3 = distX * distX * distX;
+    float distY3 = distY * distY * distY;
+    float tX = 1 - 3 * (distX3 * distX) + 14 * distX3 - 12 * (distX3 * distX);
+    float tY = 1 - 3 * (distY3 * distY) + 14 * distY3 - 12 * (distY3 * distY);
     // Get the random vector for the grid point
-    glm::vec2 gradient = 2.f * noise2D(gridPoint) - glm::vec2(1.f);
+    glm::vec2 gradient = 2.f * noise2D(gridPoint, seed) - glm::vec2(1.f);
     // Get the vector from the grid point to P
     glm::vec2 diff = P - gridPoint;
     // Get the value of our height field by dotting grid->P with our gradient
@@ -165,68 +197,59 @@ float Biome::surflet2(glm::vec2 P, glm::vec2 gridPoint)
     return height * tX * tY;
 }
 
-float Biome::perlin1(glm::vec2 uv)
+float Biome::perlin1(glm::vec2 uv, uint32_t seed)
 {
     float surfletSum = 0.f;
     // Iterate over the four integer corners surrounding uv
     for (int dx = 0; dx <= 1; ++dx) {
         for (int dy = 0; dy <= 1; ++dy) {
-            surfletSum += surflet1(uv, glm::floor(uv) + glm::vec2(dx, dy));
+            surfletSum += surflet1(uv, glm::floor(uv) + glm::vec2(dx, dy), seed);
         }
     }
     return surfletSum;
 }
 
-float Biome::perlin2(glm::vec2 uv)
+float Biome::perlin2(glm::vec2 uv, uint32_t seed)
 {
     float surfletSum = 0.f;
     // Iterate over the four integer corners surrounding uv
     for (int dx = 0; dx <= 1; ++dx) {
         for (int dy = 0; dy <= 1; ++dy) {
-            surfletSum += surflet2(uv, glm::floor(uv) + glm::vec2(dx, dy));
+            surfletSum += surflet2(uv, glm::floor(uv) + glm::vec2(dx, dy), seed);
         }
     }
     return surfletSum;
 }
 
-float Biome::surflet3D(glm::vec3 P, glm::vec3 gridPoint)
+float Biome::surflet3D(glm::vec3 P, glm::vec3 gridPoint, uint32_t seed)
 {
     glm::vec3 dist = glm::abs(P - gridPoint);
-    glm::vec3 t = glm::vec3(1.f)
-                  - 6.f * glm::vec3(pow(dist.x, 5.f), pow(dist.y, 5.f), pow(dist.z, 5.f))
-                  + 15.f * glm::vec3(pow(dist.x, 4.f), pow(dist.y, 4.f), pow(dist.z, 4.f))
-                  - 10.f * glm::vec3(pow(dist.x, 3.f), pow(dist.y, 3.f), pow(dist.z, 3.f));
-    glm::vec3 gradient = Biome::noise3D(glm::vec2(gridPoint)) * 2.f - glm::vec3(1.f, 1.f, 1.f);
+    glm::vec3 t = glm::vec3(surflet1Falloff(dist.x),
+                            surflet1Falloff(dist.y),
+                            surflet1Falloff(dist.z));
+    glm::vec3 gradient = Biome::noise3D(gridPoint, seed) * 2.f - glm::vec3(1.f, 1.f, 1.f);
     glm::vec3 diff = P - gridPoint;
     float height = glm::dot(diff, gradient);
     return height * t.x * t.y * t.z;
 }
 
-float Biome::perlin3D(glm::vec3 p)
+float Biome::perlin3D(glm::vec3 p, uint32_t seed)
 {
     float surfletSum = 0.f;
     // Iterate over the four integer corners surrounding uv
     for (int dx = 0; dx <= 1; ++dx) {
         for (int dy = 0; dy <= 1; ++dy) {
             for (int dz = 0; dz <= 1; ++dz) {
-                surfletSum += surflet3D(p, glm::floor(p) + (glm::vec3(dx, dy, dz)));
+                surfletSum += surflet3D(p, glm::floor(p) + (glm::vec3(dx, dy, dz)), seed);
             }
         }
     }
     return surfletSum;
 }
 
-float Biome::hills(glm::vec2 xz)
+// The height of the hills once their octaves are summed, shared with hillsGrid
+static float shapeHills(float h)
 {
-    float h = 0;
-    float freq = 200.f;
-    float dF = 0.5;
-
-    for (int i = 0; i < 4; ++i) {
-        h += perlin1(xz / freq);
-        freq *= dF;
-    }
-
     float flatten = 2.f;
     float sharpen = 1.25f;
     float max = -0.25f;
@@ -245,17 +268,35 @@ float Biome::hills(glm::vec2 xz)
     return floor(160.f + (h * 50.f));
 }
 
-float Biome::mountains(glm::vec2 xz)
+float Biome::hills(glm::vec2 xz, uint32_t seed)
+{
+    float h = 0;
+    float freq = 200.f;
+    float dF = 0.5;
+
+    for (int i = 0; i < 4; ++i) {
+        h += perlin1(xz / freq, seed);
+        freq *= dF;
+    }
+    return shapeHills(h);
+}
+
+// One octave of mountains, shared with mountainsGrid
+static float mountainRidge(float h1)
+{
+    h1 = 1. - abs(h1);
+    h1 = h1 * std::sqrt(std::sqrt(h1));  // h1 to the power 1.25, with correctly rounded sqrts
+    return h1;
+}
+
+float Biome::mountains(glm::vec2 xz, uint32_t seed)
 {
     float h = 0;
     float amp = 0.5;
     float freq = 175.f;
 
     for (int i = 0; i < 4; ++i) {
-        float h1 = perlin1(xz / freq);
-        h1 = 1. - abs(h1);
-        h1 = pow(h1, 1.25);
-        h += h1 * amp;
+        h += mountainRidge(perlin1(xz / freq, seed)) * amp;
 
         amp *= 0.5;
         freq *= 0.5;
@@ -263,7 +304,7 @@ float Biome::mountains(glm::vec2 xz)
     return floor(150.f + h * 100.f);
 }
 
-float Biome::forest(glm::vec2 xz)
+float Biome::forest(glm::vec2 xz, uint32_t seed)
 {
     float h = 0;
 
@@ -271,26 +312,16 @@ float Biome::forest(glm::vec2 xz)
     float freq = 90.f;
 
     for (int i = 0; i < 4; ++i) {
-        h += amp * perlin1(xz / freq);
+        h += amp * perlin1(xz / freq, seed);
         freq *= 0.5;
         amp *= 0.5;
     }
     return floor(100.f + h * 20) - 20;
 }
 
-float Biome::islands(glm::vec2 xz)
+// The height of the islands once their octaves are summed, shared with islandsGrid
+static float shapeIslands(float h)
 {
-    float h = 0;
-
-    float amp = 0.5;
-    float freq = 200.f;
-
-    for (int i = 0; i < 4; ++i) {
-        h += amp * perlin1(xz / freq);
-        freq *= 0.25;
-        amp *= 0.25;
-    }
-
     h = (h + 1.f) / 2.f;  // remap to 0-1
 
     float bar = 0.25f;
@@ -303,12 +334,303 @@ float Biome::islands(glm::vec2 xz)
     return floor(128.f - h * 100);
 }
 
-float Biome::blendTerrain(glm::vec2 uv, float h1, float h2)
+float Biome::islands(glm::vec2 xz, uint32_t seed)
+{
+    float h = 0;
+
+    float amp = 0.5;
+    float freq = 200.f;
+
+    for (int i = 0; i < 4; ++i) {
+        h += amp * perlin1(xz / freq, seed);
+        freq *= 0.25;
+        amp *= 0.25;
+    }
+    return shapeIslands(h);
+}
+
+float Biome::blendTerrain(glm::vec2 uv, float h1, float h2, uint32_t seed)
 {
-    double p = perlin1(uv);
+    double p = perlin1(uv, seed);
     float heightMix = glm::smoothstep(0.25, 0.75, p);
 
     // perform linear interpolation
     float height = ((1 - heightMix) * h1) + (heightMix * h2);
     return height;
 }
+
+// Rounds count up to a whole number of FloatLanes
+static int paddedCount(int count)
+{
+    return (count + FloatLanes::COUNT - 1) / FloatLanes::COUNT * FloatLanes::COUNT;
+}
+
+// Sorts and dedups the lattice coordinates in corners, replacing each with its index
+// among them. Returns the distinct coordinates.
+template<typename T>
+static std::vector<T> indexLattice(std::vector<T>& corners, std::vector<int>& indices)
+{
+    std::vector<T> lattice = corners;
+    std::sort(lattice.begin(), lattice.end());
+    lattice.erase(std::unique(lattice.begin(), lattice.end()), lattice.end());
+    indices.resize(corners.size());
+    for (std::size_t i = 0; i < corners.size(); i++) {
+        indices[i] = std::lower_bound(lattice.begin(), lattice.end(), corners[i]) - lattice.begin();
+    }
+    return lattice;
+}
+
+// What perlin1 works out along one axis for each of count points (origin + i) / scale:
+// for both corners of the point's cell, the corner's index in lattice, the offset of the
+// point from it and surflet1's falloff
+struct SurfletAxis
+{
+    std::vector<float> lattice;
+    std::vector<int> corner[2];
+    std::vector<float> diff[2];
+    std::vector<float> falloff[2];
+
+    SurfletAxis(float origin, int count, float scale)
+    {
+        std::vector<float> corners[2];
+        for (int c = 0; c <= 1; c++) {
+            diff[c].resize(count);
+            falloff[c].resize(count);
+            corners[c].resize(count);
+        }
+        for (int i = 0; i < count; i++) {
+            float p = (origin + float(i)) / scale;
+            for (int c = 0; c <= 1; c++) {
+                corners[c][i] = glm::floor(p) + float(c);
+                diff[c][i] = p - corners[c][i];
+                falloff[c][i] = surflet1Falloff(abs(diff[c][i]));
+            }
+        }
+
+        std::vector<float> all = corners[0];
+        all.insert(all.end(), corners[1].begin(), corners[1].end());
+        std::vector<int> indices;
+        lattice = indexLattice(all, indices);
+        corner[0].assign(indices.begin(), indices.begin() + count);
+        corner[1].assign(indices.begin() + count, indices.end());
+    }
+};
+
+void Biome::perlinGrid(glm::vec2 origin,
+                       int width,
+                       int depth,
+                       float scale,
+                       float* out,
+                       uint32_t seed)
+{
+    // The lanes run along x, so rows are padded out to a whole number of them
+    int paddedWidth = paddedCount(width);
+    SurfletAxis xs(origin.x, paddedWidth, scale);
+    SurfletAxis zs(origin.y, depth, scale);
+
+    // One gradient per lattice point, rather than one per point per corner
+    std::size_t latticeWidth = xs.lattice.size();
+    std::vector<float> gradX(latticeWidth * zs.lattice.size());
+    std::vector<float> gradZ(gradX.size());
+    for (std::size_t z = 0; z < zs.lattice.size(); z++) {
+        for (std::size_t x = 0; x < latticeWidth; x++) {
+            glm::vec2 gradient = 2.f * noise2D(glm::vec2(xs.lattice[x], zs.lattice[z]), seed)
+                                 - glm::vec2(1.f);
+            gradX[x + latticeWidth * z] = gradient.x;
+            gradZ[x + latticeWidth * z] = gradient.y;
+        }
+    }
+
+    // The same sums in the same order as perlin1 and surflet1
+    std::vector<float> row(paddedWidth);
+    for (int z = 0; z < depth; z++) {
+        for (int x = 0; x < paddedWidth; x += FloatLanes::COUNT) {
+            FloatLanes sum = FloatLanes::broadcast(0.f);
+            for (int dx = 0; dx <= 1; ++dx) {
+                for (int dy = 0; dy <= 1; ++dy) {
+                    std::size_t latticeRow = latticeWidth * zs.corner[dy][z];
+                    const int* corners = &xs.corner[dx][x];
+                    FloatLanes height = FloatLanes::load(&xs.diff[dx][x])
+                                            * FloatLanes::gather(&gradX[latticeRow], corners)
+                                        + FloatLanes::broadcast(zs.diff[dy][z])
+                                              * FloatLanes::gather(&gradZ[latticeRow], corners);
+                    sum = sum
+                          + height * FloatLanes::load(&xs.falloff[dx][x])
+                                * FloatLanes::broadcast(zs.falloff[dy][z]);
+                }
+            }
+            sum.store(&row[x]);
+        }
+        std::copy(row.begin(), row.begin() + width, out + width * z);
+    }
+}
+
+// What one octave of fbm works out along one axis for each of count points
+// (origin + i) / scale * freq: the index in lattice of the two lattice points it's
+// interpolated between, and how far it is from the first. A point that's on a lattice
+// point doesn't need the second, and gets the first's index for both.
+struct InterpAxis
+{
+    std::vector<int> lattice;
+    std::vector<int> corner[2];
+    std::vector<float> fract;
+
+    InterpAxis(float origin, int count, float scale, float freq)
+        : fract(count)
+    {
+        std::vector<int> corners;
+        for (int i = 0; i < count; i++) {
+            float p = (origin + float(i)) / scale * freq;
+            int cell = int(floor(p));
+            fract[i] = glm::fract(p);
+            corners.push_back(cell);
+            corners.push_back(fract[i] == 0.f ? cell : cell + 1);
+        }
+
+        std::vector<int> indices;
+        lattice = indexLattice(corners, indices);
+        corner[0].resize(count);
+        corner[1].resize(count);
+        for (int i = 0; i < count; i++) {
+            corner[0][i] = indices[2 * i];
+            corner[1][i] = indices[2 * i + 1];
+        }
+    }
+};
+
+void Biome::fbmGrid(glm::vec2 origin,
+                    int width,
+                    int depth,
+                    float scale,
+                    float* out,
+                    uint32_t seed)
+{
+    int paddedWidth = paddedCount(width);
+    std::vector<float> total(paddedWidth * depth, 0.f);
+    std::vector<float> hashes;
+
+    float persistence = 0.5f;
+    int octaves = 8;
+    float freq = 2.f;
+    float amp = 0.5f;
+    for (int i = 1; i <= octaves; i++) {
+        InterpAxis xs(origin.x, paddedWidth, scale, freq);
+        InterpAxis zs(origin.y, depth, scale, freq);
+
+        std::size_t latticeWidth = xs.lattice.size();
+        hashes.resize(latticeWidth * zs.lattice.size());
+        for (std::size_t z = 0; z < zs.lattice.size(); z++) {
+            for (std::size_t x = 0; x < latticeWidth; x++) {
+                hashes[x + latticeWidth * z] = noise1D(glm::vec2(xs.lattice[x], zs.lattice[z]),
+                                                       seed);
+            }
+        }
+
+        // The same mixes in the same order as interpNoise, with glm::mix written out
+        FloatLanes octaveAmp = FloatLanes::broadcast(amp);
+        for (int z = 0; z < depth; z++) {
+            const float* row0 = &hashes[latticeWidth * zs.corner[0][z]];
+            const float* row1 = &hashes[latticeWidth * zs.corner[1][z]];
+            FloatLanes fractZ = FloatLanes::broadcast(zs.fract[z]);
+            for (int x = 0; x < paddedWidth; x += FloatLanes::COUNT) {
+                FloatLanes fractX = FloatLanes::load(&xs.fract[x]);
+                FloatLanes v1 = FloatLanes::gather(row0, &xs.corner[0][x]);
+                FloatLanes v2 = FloatLanes::gather(row0, &xs.corner[1][x]);
+                FloatLanes v3 = FloatLanes::gather(row1, &xs.corner[0][x]);
+                FloatLanes v4 = FloatLanes::gather(row1, &xs.corner[1][x]);
+                FloatLanes i1 = v1 + fractX * (v2 - v1);
+                FloatLanes i2 = v3 + fractX * (v4 - v3);
+                float* t = &total[paddedWidth * z + x];
+                (FloatLanes::load(t) + (i1 + fractZ * (i2 - i1)) * octaveAmp).store(t);
+            }
+        }
+
+        freq *= 2.f;
+        amp *= persistence;
+    }
+
+    for (int z = 0; z < depth; z++) {
+        std::copy(total.begin() + paddedWidth * z,
+                  total.begin() + paddedWidth * z + width,
+                  out + width * z);
+    }
+}
+
+void Biome::hillsGrid(glm::vec2 origin, int width, int depth, float* out, uint32_t seed)
+{
+    std::vector<float> h(width * depth, 0.f);
+    std::vector<float> octave(h.size());
+    float freq = 200.f;
+    float dF = 0.5;
+
+    for (int i = 0; i < 4; ++i) {
+        perlinGrid(origin, width, depth, freq, octave.data(), seed);
+        for (std::size_t j = 0; j < h.size(); j++) {
+            h[j] += octave[j];
+        }
+        freq *= dF;
+    }
+    for (std::size_t j = 0; j < h.size(); j++) {
+        out[j] = shapeHills(h[j]);
+    }
+}
+
+void Biome::mountainsGrid(glm::vec2 origin, int width, int depth, float* out, uint32_t seed)
+{
+    std::vector<float> h(width * depth, 0.f);
+    std::vector<float> octave(h.size());
+    float amp = 0.5;
+    float freq = 175.f;
+
+    for (int i = 0; i < 4; ++i) {
+        perlinGrid(origin, width, depth, freq, octave.data(), seed);
+        for (std::size_t j = 0; j < h.size(); j++) {
+            h[j] += mountainRidge(octave[j]) * amp;
+        }
+        amp *= 0.5;
+        freq *= 0.5;
+    }
+    for (std::size_t j = 0; j < h.size(); j++) {
+        out[j] = floor(150.f + h[j] * 100.f);
+    }
+}
+
+void Biome::forestGrid(glm::vec2 origin, int width, int depth, float* out, uint32_t seed)
+{
+    std::vector<float> h(width * depth, 0.f);
+    std::vector<float> octave(h.size());
+    float amp = 0.5;
+    float freq = 90.f;
+
+    for (int i = 0; i < 4; ++i) {
+        perlinGrid(origin, width, depth, freq, octave.data(), seed);
+        for (std::size_t j = 0; j < h.size(); j++) {
+            h[j] += amp * octave[j];
+        }
+        freq *= 0.5;
+        amp *= 0.5;
+    }
+    for (std::size_t j = 0; j < h.size(); j++) {
+        out[j] = floor(100.f + h[j] * 20) - 20;
+    }
+}
+
+void Biome::islandsGrid(glm::vec2 origin, int width, int depth, float* out, uint32_t seed)
+{
+    std::vector<float> h(width * depth, 0.f);
+    std::vector<float> octave(h.size());
+    float amp = 0.5;
+    float freq = 200.f;
+
+    for (int i = 0; i < 4; ++i) {
+        perlinGrid(origin, width, depth, freq, octave.data(), seed);
+        for (std::size_t j = 0; j < h.size(); j++) {
+            h[j] += amp * octave[j];
+        }
+        freq *= 0.25;
+        amp *= 0.25;
+    }
+    for (std::size_t j = 0; j < h.size(); j++) {
+        out[j] = shapeIslands(h[j]);
+    }
+}
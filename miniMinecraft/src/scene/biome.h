@@ -1,38 +1,68 @@
 #pragma once
 #include "glm_includes.h"
+#include <cstdint>
 
 class Biome
 {
 public:
     Biome();
 
-    static int getRandomIntInRange(int min, int max);
+    // Every noise function takes the world's seed, and is a pure function of it and
+    // its position, so a world comes out the same every time it's generated from a seed.
 
-    static float noise1D(float x);
-    static float noise1D(glm::vec2 p);
-    static float noise1D(glm::vec3 p);
-    static glm::vec2 noise2D(glm::vec2 p);
-    static glm::vec3 noise3D(glm::vec2 p);
-    static float interpNoise(float x, float y);
-    static float interpNoise(float);
+    static float noise1D(float x, uint32_t seed);
+    static float noise1D(glm::vec2 p, uint32_t seed);
+    static float noise1D(glm::vec3 p, uint32_t seed);
+    static glm::vec2 noise2D(glm::vec2 p, uint32_t seed);
+    static glm::vec3 noise3D(glm::vec3 p, uint32_t seed);
+    static float interpNoise(float x, float y, uint32_t seed);
+    static float interpNoise(float x, uint32_t seed);
 
-    static float fbm(float x);
-    static float fbm(const glm::vec2 uv);  // range 0 to 1
-    static float worley(glm::vec2 uv);     // range 0 to 1
-    static glm::vec2 voronoi(glm::vec2 uv, int scale);
+    static float fbm(float x, uint32_t seed);
+    static float fbm(const glm::vec2 uv, uint32_t seed);  // range 0 to 1
+    static float worley(glm::vec2 uv, uint32_t seed);     // range 0 to 1
+    static glm::vec2 voronoi(glm::vec2 uv, int scale, uint32_t seed);
+    // voronoi takes the same jitter at uv whatever its scale, so callers that need several
+    // scales at one point can work it out once and pass it to the second overload
+    static glm::vec2 voronoiJitter(glm::vec2 uv, uint32_t seed);
+    static glm::vec2 voronoi(glm::vec2 uv, glm::vec2 jitter, int scale);
 
-    static float surflet1(glm::vec2 P, glm::vec2 gridPoint);
-    static float surflet2(glm::vec2 P, glm::vec2 gridPoint);
-    static float surflet3D(glm::vec3 P, glm::vec3 gridPoint);
+    static float surflet1(glm::vec2 P, glm::vec2 gridPoint, uint32_t seed);
+    static float surflet2(glm::vec2 P, glm::vec2 gridPoint, uint32_t seed);
+    static float surflet3D(glm::vec3 P, glm::vec3 gridPoint, uint32_t seed);
 
-    static float perlin1(glm::vec2 uv);  // range -1 to 1
-    static float perlin2(glm::vec2 uv);
-    static float perlin3D(glm::vec3 p);
+    static float perlin1(glm::vec2 uv, uint32_t seed);  // range -1 to 1
+    static float perlin2(glm::vec2 uv, uint32_t seed);
+    static float perlin3D(glm::vec3 p, uint32_t seed);
 
-    static float hills(glm::vec2 p);
-    static float mountains(glm::vec2 p);
-    static float forest(glm::vec2 p);
-    static float islands(glm::vec2 p);
+    static float hills(glm::vec2 p, uint32_t seed);
+    static float mountains(glm::vec2 p, uint32_t seed);
+    static float forest(glm::vec2 p, uint32_t seed);
+    static float islands(glm::vec2 p, uint32_t seed);
 
-    static float blendTerrain(glm::vec2 uv, float h1, float h2);
+    static float blendTerrain(glm::vec2 uv, float h1, float h2, uint32_t seed);
+
+    // Batch versions of the functions above, for a width x depth grid of points one block
+    // apart starting at origin. They write the result for origin + (x, z) to
+    // out[x + width * z], and give bit-identical results to calling the scalar function
+    // on each point, so terrain doesn't change with how it's generated.
+    // The hashes and falloffs are worked out once per lattice point or grid line
+    // and shared between the points that use them, and the rest runs on SIMD lanes.
+    // perlinGrid and fbmGrid give perlin1(p / scale) and fbm(p / scale)
+    static void perlinGrid(glm::vec2 origin,
+                           int width,
+                           int depth,
+                           float scale,
+                           float* out,
+                           uint32_t seed);
+    static void fbmGrid(glm::vec2 origin,
+                        int width,
+                        int depth,
+                        float scale,
+                        float* out,
+                        uint32_t seed);
+    static void hillsGrid(glm::vec2 origin, int width, int depth, float* out, uint32_t seed);
+    static void mountainsGrid(glm::vec2 origin, int width, int depth, float* out, uint32_t seed);
+    static void forestGrid(glm::vec2 origin, int width, int depth, float* out, uint32_t seed);
+    static void islandsGrid(glm::vec2 origin, int width, int depth, float* out, uint32_t seed);
 };
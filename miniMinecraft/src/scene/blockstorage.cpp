@@ -0,0 +1,202 @@
+#include "blockstorage.h"
+#include <algorithm>
+#include <array>
+
+PalettedSection::PalettedSection()
+    : m_uniform(EMPTY)
+    , m_bits(0)
+    , m_palette()
+    , m_words()
+{}
+
+int PalettedSection::toIndex(int x, int y, int z)
+{
+    return x + SIZE * y + SIZE * SIZE * z;
+}
+
+unsigned char PalettedSection::bitsForPaletteSize(std::size_t n)
+{
+    if (n <= 1) {
+        return 0;
+    } else if (n <= 2) {
+        return 1;
+    } else if (n <= 4) {
+        return 2;
+    } else if (n <= 16) {
+        return 4;
+    }
+    return 8;
+}
+
+unsigned int PalettedSection::getIndex(int i) const
+{
+    unsigned int bit = static_cast<unsigned int>(i) * m_bits;
+    uint64_t mask = (uint64_t(1) << m_bits) - 1;
+    return static_cast<unsigned int>((m_words[bit >> 6] >> (bit & 63)) & mask);
+}
+
+void PalettedSection::setIndex(int i, unsigned int paletteIdx)
+{
+    unsigned int bit = static_cast<unsigned int>(i) * m_bits;
+    uint64_t mask = (uint64_t(1) << m_bits) - 1;
+    uint64_t& word = m_words[bit >> 6];
+    word = (word & ~(mask << (bit & 63))) | ((uint64_t(paletteIdx) & mask) << (bit & 63));
+}
+
+BlockType PalettedSection::get(int x, int y, int z) const
+{
+    if (m_bits == 0) {
+        return m_uniform;
+    }
+
+    unsigned int idx = getIndex(toIndex(x, y, z));
+    return m_bits == 8 ? static_cast<BlockType>(idx) : m_palette[idx];
+}
+
+void PalettedSection::set(int x, int y, int z, BlockType t)
+{
+    int i = toIndex(x, y, z);
+
+    if (m_bits == 0) {
+        if (t == m_uniform) {
+            return;
+        }
+        repack(1, {m_uniform, t});
+        setIndex(i, 1);
+        return;
+    }
+
+    if (m_bits == 8) {
+        setIndex(i, t);
+        return;
+    }
+
+    auto it = std::find(m_palette.begin(), m_palette.end(), t);
+    if (it != m_palette.end()) {
+        setIndex(i, static_cast<unsigned int>(it - m_palette.begin()));
+        return;
+    }
+
+    // New BlockType for this section: append it to the palette,
+    // widening the indices first if the palette is already full
+    if (m_palette.size() >= (std::size_t(1) << m_bits)) {
+        std::vector<BlockType> palette = m_palette;
+        palette.push_back(t);
+        repack(bitsForPaletteSize(palette.size()), palette);
+
+        if (m_bits == 8) {
+            setIndex(i, t);
+            return;
+        }
+    } else {
+        m_palette.push_back(t);
+    }
+    setIndex(i, static_cast<unsigned int>(m_palette.size() - 1));
+}
+
+void PalettedSection::fill(BlockType t)
+{
+    m_uniform = t;
+    m_bits = 0;
+    std::vector<BlockType>().swap(m_palette);
+    std::vector<uint64_t>().swap(m_words);
+}
+
+void PalettedSection::compact()
+{
+    if (m_bits == 0) {
+        return;
+    }
+
+    // Collect the BlockTypes that are actually still in use
+    std::array<bool, 256> used{};
+    std::vector<BlockType> palette;
+    for (int i = 0; i < VOLUME; i++) {
+        unsigned int idx = getIndex(i);
+        BlockType t = m_bits == 8 ? static_cast<BlockType>(idx) : m_palette[idx];
+        if (!used[t]) {
+            used[t] = true;
+            palette.push_back(t);
+        }
+    }
+
+    if (palette.size() == 1) {
+        fill(palette[0]);
+        return;
+    }
+
+    unsigned char bits = bitsForPaletteSize(palette.size());
+    if (bits != m_bits || palette.size() != m_palette.size()) {
+        repack(bits, palette);
+    }
+}
+
+void PalettedSection::repack(unsigned char bits, std::vector<BlockType> palette)
+{
+    // Decode every block with the current encoding
+    std::array<BlockType, VOLUME> blocks;
+    if (m_bits == 0) {
+        blocks.fill(m_uniform);
+    } else {
+        for (int i = 0; i < VOLUME; i++) {
+            unsigned int idx = getIndex(i);
+            blocks[i] = m_bits == 8 ? static_cast<BlockType>(idx) : m_palette[idx];
+        }
+    }
+
+    pack(blocks, bits, std::move(palette));
+}
+
+void PalettedSection::assign(const std::array<BlockType, VOLUME>& blocks)
+{
+    std::array<bool, 256> used{};
+    std::vector<BlockType> palette;
+    for (BlockType t : blocks) {
+        if (!used[t]) {
+            used[t] = true;
+            palette.push_back(t);
+        }
+    }
+    unsigned char bits = bitsForPaletteSize(palette.size());
+    pack(blocks, bits, std::move(palette));
+}
+
+void PalettedSection::pack(const std::array<BlockType, VOLUME>& blocks,
+                           unsigned char bits,
+                           std::vector<BlockType> palette)
+{
+    if (bits == 0) {
+        fill(palette.empty() ? m_uniform : palette[0]);
+        return;
+    }
+
+    // Reverse lookup from BlockType to its new palette index
+    std::array<unsigned char, 256> lookup{};
+    if (bits < 8) {
+        for (std::size_t p = 0; p < palette.size(); p++) {
+            lookup[palette[p]] = static_cast<unsigned char>(p);
+        }
+    } else {
+        palette.clear();
+    }
+
+    m_bits = bits;
+    m_palette = std::move(palette);
+    m_palette.shrink_to_fit();
+    m_words.assign(VOLUME * m_bits / 64, 0);
+
+    for (int i = 0; i < VOLUME; i++) {
+        setIndex(i, m_bits == 8 ? static_cast<unsigned int>(blocks[i]) : lookup[blocks[i]]);
+    }
+}
+
+bool PalettedSection::isUniform() const
+{
+    return m_bits == 0;
+}
+
+std::size_t PalettedSection::memoryUsage() const
+{
+    return sizeof(PalettedSection) + m_palette.capacity() * sizeof(BlockType)
+           + m_words.capacity() * sizeof(uint64_t);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include "blocktype.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Palette-compressed block storage for one 16 x 16 x 16 section of a Chunk.
+// Rather than spending a full byte on every block, each block is stored as an
+// index into a small palette of the distinct BlockTypes found in the section.
+// The indices are packed into 64-bit words using the smallest bit width that can
+// address the palette:
+//   1 block type      -> 0 bits (the section is just the one BlockType byte)
+//   2 block types     -> 1 bit
+//   3 - 4 block types -> 2 bits
+//   5 - 16 types      -> 4 bits
+//   17+ types         -> 8 bits, and the BlockType is stored directly (no palette)
+// All widths divide 64 evenly, so an index never straddles two words.
+class PalettedSection
+{
+public:
+    static constexpr int SIZE = 16;
+    static constexpr int VOLUME = SIZE * SIZE * SIZE;
+
+    PalettedSection();
+
+    // Coordinates are local to the section, in the range [0, 16)
+    BlockType get(int x, int y, int z) const;
+    void set(int x, int y, int z, BlockType t);
+
+    // Sets every block of the section to t, releasing any packed data
+    void fill(BlockType t);
+    // Replaces every block of the section, indexed as by toIndex, packing them
+    // at the smallest bit width that fits
+    void assign(const std::array<BlockType, VOLUME>& blocks);
+
+    // Drops palette entries that are no longer referenced and shrinks the
+    // bit width to match. Call after a batch of writes (e.g. terrain generation).
+    void compact();
+
+    bool isUniform() const;
+    // Approximate heap + inline bytes used by this section
+    std::size_t memoryUsage() const;
+
+    // Index of (x, y, z) within a section, x fastest, then y, then z
+    static int toIndex(int x, int y, int z);
+
+private:
+    BlockType m_uniform;  // the only BlockType in the section when m_bits == 0
+    unsigned char m_bits;
+    std::vector<BlockType> m_palette;  // empty when m_bits is 0 or 8
+    std::vector<uint64_t> m_words;
+
+    unsigned int getIndex(int i) const;
+    void setIndex(int i, unsigned int paletteIdx);
+    // Re-packs every block at the given bit width using the given palette
+    void repack(unsigned char bits, std::vector<BlockType> palette);
+    // Packs blocks at the given bit width using the given palette, which has to hold them all
+    void pack(const std::array<BlockType, VOLUME>& blocks,
+              unsigned char bits,
+              std::vector<BlockType> palette);
+    static unsigned char bitsForPaletteSize(std::size_t n);
+};
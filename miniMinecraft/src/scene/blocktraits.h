@@ -0,0 +1,425 @@
+#pragma once
+#include "blocktype.h"
+#include <array>
+#include <cstdint>
+
+// Every per-BlockType property that meshing and collision need to query,
+// packed into one bitmask per BlockType. The table is built at compile time
+// from the lists below, so each query is a single indexed load instead of a hash probe.
+// Query it through BlockTraits rather than reading the table directly.
+namespace BlockTraitTable
+{
+
+enum Flag : uint16_t {
+    HPLANE = 1 << 0,       // flat horizontal quad, e.g. lily pads
+    CROSS2 = 1 << 1,       // two diagonal quads, e.g. tall grass
+    CROSS4 = 1 << 2,       // four axis-aligned quads, e.g. wheat
+    PARTIAL_X = 1 << 3,    // doesn't fill its cell along x
+    PARTIAL_Y = 1 << 4,    // doesn't fill its cell along y
+    PARTIAL_Z = 1 << 5,    // doesn't fill its cell along z
+    FULL_CUBE = 1 << 6,    // fills its whole cell
+    TRANSPARENT = 1 << 7,  // can be seen through
+    COLLIDABLE = 1 << 8,   // entities can't move through it
+};
+
+constexpr BlockType hPlane[] = {LILY_PAD, LOTUS_1, LOTUS_2, RICE_01, RICE_02};
+
+constexpr BlockType cross2[] = {TALL_GRASS,
+                                LOTUS_1,
+                                LOTUS_2,
+                                RICE_1,
+                                RICE_2,
+                                RICE_3,
+                                RICE_4,
+                                RICE_5,
+                                RICE_6,
+                                RICE_01,
+                                RICE_02,
+                                BAMBOO_2,
+                                BAMBOO_3,
+                                BONSAI_TREE,
+                                MAGNOLIA_IKEBANA,
+                                LOTUS_IKEBANA,
+                                GREEN_HYDRANGEA_IKEBANA,
+                                CHRYSANTHEMUM_IKEBANA,
+                                CHERRY_BLOSSOM_IKEBANA,
+                                BLUE_HYDRANGEA_IKEBANA,
+                                TULIP_IKEBANA,
+                                DAFFODIL_IKEBANA,
+                                PLUM_BLOSSOM_IKEBANA,
+                                MAGNOLIA_BUD_IKEBANA,
+                                POPPY_IKEBANA,
+                                MAPLE_IKEBANA,
+                                ONCIDIUM_IKEBANA,
+                                GHOST_LILY,
+                                GHOST_WEED,
+                                CORAL_1,
+                                CORAL_2,
+                                CORAL_3,
+                                CORAL_4,
+                                KELP_1,
+                                KELP_2};
+
+constexpr BlockType cross4[] = {WHEAT_1,
+                                WHEAT_2,
+                                WHEAT_3,
+                                WHEAT_4,
+                                WHEAT_5,
+                                WHEAT_6,
+                                WHEAT_7,
+                                WHEAT_8,
+                                SEA_GRASS};
+
+constexpr BlockType partialX[] = {CEDAR_WINDOW_X,
+                                  TEAK_WINDOW_X,
+                                  CHERRY_WINDOW_X,
+                                  MAPLE_WINDOW_X,
+                                  PINE_WINDOW_X,
+                                  WISTERIA_WINDOW_X,
+                                  PAPER_LANTERN,
+                                  WOOD_LANTERN,
+                                  PAINTING_1_XP,
+                                  PAINTING_2_XP,
+                                  PAINTING_3_XP,
+                                  PAINTING_4_XP,
+                                  PAINTING_5_XP,
+                                  PAINTING_6L_XP,
+                                  PAINTING_6R_XP,
+                                  PAINTING_7T_XP,
+                                  PAINTING_7B_XP,
+                                  PAINTING_1_XN,
+                                  PAINTING_2_XN,
+                                  PAINTING_3_XN,
+                                  PAINTING_4_XN,
+                                  PAINTING_5_XN,
+                                  PAINTING_6L_XN,
+                                  PAINTING_6R_XN,
+                                  PAINTING_7T_XN,
+                                  PAINTING_7B_XN,
+                                  BAMBOO_1,
+                                  BAMBOO_2,
+                                  BAMBOO_3,
+                                  BONSAI_TREE,
+                                  MAGNOLIA_IKEBANA,
+                                  LOTUS_IKEBANA,
+                                  GREEN_HYDRANGEA_IKEBANA,
+                                  CHRYSANTHEMUM_IKEBANA,
+                                  CHERRY_BLOSSOM_IKEBANA,
+                                  BLUE_HYDRANGEA_IKEBANA,
+                                  TULIP_IKEBANA,
+                                  DAFFODIL_IKEBANA,
+                                  PLUM_BLOSSOM_IKEBANA,
+                                  MAGNOLIA_BUD_IKEBANA,
+                                  POPPY_IKEBANA,
+                                  MAPLE_IKEBANA,
+                                  ONCIDIUM_IKEBANA};
+
+constexpr BlockType partialY[] = {WATER,
+                                  LAVA,
+                                  SNOW_1,
+                                  SNOW_2,
+                                  SNOW_3,
+                                  SNOW_4,
+                                  SNOW_5,
+                                  SNOW_6,
+                                  SNOW_7,
+                                  CEDAR_PLANKS_1,
+                                  TEAK_PLANKS_1,
+                                  CHERRY_PLANKS_1,
+                                  MAPLE_PLANKS_1,
+                                  PINE_PLANKS_1,
+                                  WISTERIA_PLANKS_1,
+                                  CEDAR_PLANKS_2,
+                                  TEAK_PLANKS_2,
+                                  CHERRY_PLANKS_2,
+                                  MAPLE_PLANKS_2,
+                                  PINE_PLANKS_2,
+                                  WISTERIA_PLANKS_2,
+                                  ROOF_TILES_1,
+                                  ROOF_TILES_2,
+                                  STRAW_1,
+                                  STRAW_2,
+                                  TILLED_DIRT,
+                                  PATH,
+                                  IRRIGATED_SOIL,
+                                  TATAMI_XL,
+                                  TATAMI_XR,
+                                  TATAMI_ZT,
+                                  TATAMI_ZB,
+                                  PAPER_LANTERN,
+                                  BONSAI_TREE,
+                                  MAGNOLIA_IKEBANA,
+                                  LOTUS_IKEBANA,
+                                  GREEN_HYDRANGEA_IKEBANA,
+                                  CHRYSANTHEMUM_IKEBANA,
+                                  CHERRY_BLOSSOM_IKEBANA,
+                                  BLUE_HYDRANGEA_IKEBANA,
+                                  TULIP_IKEBANA,
+                                  DAFFODIL_IKEBANA,
+                                  PLUM_BLOSSOM_IKEBANA,
+                                  MAGNOLIA_BUD_IKEBANA,
+                                  POPPY_IKEBANA,
+                                  MAPLE_IKEBANA,
+                                  ONCIDIUM_IKEBANA,
+                                  CLOTH_1,
+                                  CLOTH_2,
+                                  CLOTH_3,
+                                  CLOTH_4,
+                                  CLOTH_5,
+                                  CLOTH_6,
+                                  CLOTH_7};
+
+constexpr BlockType partialZ[] = {CEDAR_WINDOW_Z,
+                                  TEAK_WINDOW_Z,
+                                  CHERRY_WINDOW_Z,
+                                  MAPLE_WINDOW_Z,
+                                  PINE_WINDOW_Z,
+                                  WISTERIA_WINDOW_Z,
+                                  PAPER_LANTERN,
+                                  WOOD_LANTERN,
+                                  PAINTING_1_ZP,
+                                  PAINTING_2_ZP,
+                                  PAINTING_3_ZP,
+                                  PAINTING_4_ZP,
+                                  PAINTING_5_ZP,
+                                  PAINTING_6L_ZP,
+                                  PAINTING_6R_ZP,
+                                  PAINTING_7T_ZP,
+                                  PAINTING_7B_ZP,
+                                  PAINTING_1_ZN,
+                                  PAINTING_2_ZN,
+                                  PAINTING_3_ZN,
+                                  PAINTING_4_ZN,
+                                  PAINTING_5_ZN,
+                                  PAINTING_6L_ZN,
+                                  PAINTING_6R_ZN,
+                                  PAINTING_7T_ZN,
+                                  PAINTING_7B_ZN,
+                                  BAMBOO_1,
+                                  BAMBOO_2,
+                                  BAMBOO_3,
+                                  BONSAI_TREE,
+                                  MAGNOLIA_IKEBANA,
+                                  LOTUS_IKEBANA,
+                                  GREEN_HYDRANGEA_IKEBANA,
+                                  CHRYSANTHEMUM_IKEBANA,
+                                  CHERRY_BLOSSOM_IKEBANA,
+                                  BLUE_HYDRANGEA_IKEBANA,
+                                  TULIP_IKEBANA,
+                                  DAFFODIL_IKEBANA,
+                                  PLUM_BLOSSOM_IKEBANA,
+                                  MAGNOLIA_BUD_IKEBANA,
+                                  POPPY_IKEBANA,
+                                  MAPLE_IKEBANA,
+                                  ONCIDIUM_IKEBANA};
+
+constexpr BlockType fullCube[] = {GRASS,
+                                  DIRT,
+                                  STONE,
+                                  COBBLESTONE,
+                                  MOSS_STONE,
+                                  SAND,
+                                  BEDROCK,
+                                  SNOW_8,
+                                  ICE,
+                                  CEDAR_WOOD_X,
+                                  TEAK_WOOD_X,
+                                  CHERRY_WOOD_X,
+                                  MAPLE_WOOD_X,
+                                  PINE_WOOD_X,
+                                  WISTERIA_WOOD_X,
+                                  CEDAR_WOOD_Y,
+                                  TEAK_WOOD_Y,
+                                  CHERRY_WOOD_Y,
+                                  MAPLE_WOOD_Y,
+                                  PINE_WOOD_Y,
+                                  WISTERIA_WOOD_Y,
+                                  CEDAR_WOOD_Z,
+                                  TEAK_WOOD_Z,
+                                  CHERRY_WOOD_Z,
+                                  MAPLE_WOOD_Z,
+                                  PINE_WOOD_Z,
+                                  WISTERIA_WOOD_Z,
+                                  CEDAR_LEAVES,
+                                  TEAK_LEAVES,
+                                  CHERRY_BLOSSOMS_1,
+                                  CHERRY_BLOSSOMS_2,
+                                  CHERRY_BLOSSOMS_3,
+                                  CHERRY_BLOSSOMS_4,
+                                  MAPLE_LEAVES_1,
+                                  MAPLE_LEAVES_2,
+                                  MAPLE_LEAVES_3,
+                                  PINE_LEAVES,
+                                  WISTERIA_BLOSSOMS_1,
+                                  WISTERIA_BLOSSOMS_2,
+                                  WISTERIA_BLOSSOMS_3,
+                                  CEDAR_PLANKS,
+                                  TEAK_PLANKS,
+                                  CHERRY_PLANKS,
+                                  MAPLE_PLANKS,
+                                  PINE_PLANKS,
+                                  WISTERIA_PLANKS,
+                                  RED_PAINTED_WOOD,
+                                  BLACK_PAINTED_WOOD,
+                                  PLASTER,
+                                  ROOF_TILES,
+                                  STRAW,
+                                  CLOTH_8};
+
+constexpr BlockType transparent[] = {WATER,
+                                     ICE,
+                                     TALL_GRASS,
+                                     CEDAR_LEAVES,
+                                     TEAK_LEAVES,
+                                     CHERRY_BLOSSOMS_1,
+                                     CHERRY_BLOSSOMS_2,
+                                     CHERRY_BLOSSOMS_3,
+                                     CHERRY_BLOSSOMS_4,
+                                     MAPLE_LEAVES_1,
+                                     MAPLE_LEAVES_2,
+                                     MAPLE_LEAVES_3,
+                                     PINE_LEAVES,
+                                     WISTERIA_BLOSSOMS_1,
+                                     WISTERIA_BLOSSOMS_2,
+                                     WISTERIA_BLOSSOMS_3,
+                                     CEDAR_WINDOW_X,
+                                     TEAK_WINDOW_X,
+                                     CHERRY_WINDOW_X,
+                                     MAPLE_WINDOW_X,
+                                     PINE_WINDOW_X,
+                                     WISTERIA_WINDOW_X,
+                                     CEDAR_WINDOW_Z,
+                                     TEAK_WINDOW_Z,
+                                     CHERRY_WINDOW_Z,
+                                     MAPLE_WINDOW_Z,
+                                     PINE_WINDOW_Z,
+                                     WISTERIA_WINDOW_Z,
+                                     LILY_PAD,
+                                     LOTUS_1,
+                                     LOTUS_2,
+                                     WHEAT_1,
+                                     WHEAT_2,
+                                     WHEAT_3,
+                                     WHEAT_4,
+                                     WHEAT_5,
+                                     WHEAT_6,
+                                     WHEAT_7,
+                                     WHEAT_8,
+                                     RICE_1,
+                                     RICE_2,
+                                     RICE_3,
+                                     RICE_4,
+                                     RICE_5,
+                                     RICE_6,
+                                     GHOST_LILY,
+                                     GHOST_WEED,
+                                     CORAL_1,
+                                     CORAL_2,
+                                     CORAL_3,
+                                     CORAL_4,
+                                     KELP_1,
+                                     KELP_2,
+                                     SEA_GRASS};
+
+template<std::size_t N>
+constexpr void mark(std::array<uint16_t, 256>& t, const BlockType (&list)[N], uint16_t f)
+{
+    for (std::size_t i = 0; i < N; i++) {
+        t[list[i]] |= f;
+    }
+}
+
+constexpr std::array<uint16_t, 256> build()
+{
+    std::array<uint16_t, 256> t{};
+
+    mark(t, hPlane, HPLANE);
+    mark(t, cross2, CROSS2);
+    mark(t, cross4, CROSS4);
+    mark(t, partialX, PARTIAL_X);
+    mark(t, partialY, PARTIAL_Y);
+    mark(t, partialZ, PARTIAL_Z);
+    mark(t, fullCube, FULL_CUBE);
+    mark(t, transparent, TRANSPARENT);
+
+    // Plants and liquids can be walked (or swum) through
+    for (int i = 0; i < 256; i++) {
+        BlockType bt = static_cast<BlockType>(i);
+        if (bt != EMPTY && bt != WATER && bt != LAVA && (t[i] & (HPLANE | CROSS2 | CROSS4)) == 0) {
+            t[i] |= COLLIDABLE;
+        }
+    }
+
+    return t;
+}
+
+inline constexpr std::array<uint16_t, 256> table = build();
+
+}  // namespace BlockTraitTable
+
+class BlockTraits
+{
+public:
+    static constexpr uint16_t flags(BlockType bt)
+    {
+        return BlockTraitTable::table[bt];
+    }
+
+    // true if bt has any of the BlockTraitTable::Flag bits in f
+    static constexpr bool has(BlockType bt, uint16_t f)
+    {
+        return (BlockTraitTable::table[bt] & f) != 0;
+    }
+
+    static constexpr bool isHPlane(BlockType bt)
+    {
+        return has(bt, BlockTraitTable::HPLANE);
+    }
+
+    static constexpr bool isCross2(BlockType bt)
+    {
+        return has(bt, BlockTraitTable::CROSS2);
+    }
+
+    static constexpr bool isCross4(BlockType bt)
+    {
+        return has(bt, BlockTraitTable::CROSS4);
+    }
+
+    static constexpr bool isPartialX(BlockType bt)
+    {
+        return has(bt, BlockTraitTable::PARTIAL_X);
+    }
+
+    static constexpr bool isPartialY(BlockType bt)
+    {
+        return has(bt, BlockTraitTable::PARTIAL_Y);
+    }
+
+    static constexpr bool isPartialZ(BlockType bt)
+    {
+        return has(bt, BlockTraitTable::PARTIAL_Z);
+    }
+
+    static constexpr bool isFullCube(BlockType bt)
+    {
+        return has(bt, BlockTraitTable::FULL_CUBE);
+    }
+
+    static constexpr bool isTransparent(BlockType bt)
+    {
+        return has(bt, BlockTraitTable::TRANSPARENT);
+    }
+
+    // Full cube that can't be seen through, so it hides any face pressed against it
+    static constexpr bool isOpaqueCube(BlockType bt)
+    {
+        return (flags(bt) & (BlockTraitTable::FULL_CUBE | BlockTraitTable::TRANSPARENT))
+               == BlockTraitTable::FULL_CUBE;
+    }
+
+    static constexpr bool isCollidable(BlockType bt)
+    {
+        return has(bt, BlockTraitTable::COLLIDABLE);
+    }
+};
@@ -0,0 +1,212 @@
+#pragma once
+
+// C++ 11 allows us to define the size of an enum. This lets us use only one byte
+// of memory to store our different block types. By default, the size of a C++ enum
+// is that of an int (so, usually four bytes). This *does* limit us to only 256 different
+// block types, but in the scope of this project we'll never get anywhere near that many.
+enum BlockType : unsigned char {
+    GRASS,
+    DIRT,
+    STONE,
+    COBBLESTONE,
+    MOSS_STONE,
+    SAND,
+    TALL_GRASS,
+    WATER,
+    LAVA,
+    BEDROCK,
+    SNOW_1,
+    SNOW_2,
+    SNOW_3,
+    SNOW_4,
+    SNOW_5,
+    SNOW_6,
+    SNOW_7,
+    SNOW_8,
+    ICE,
+    RED_PAINTED_WOOD,
+    BLACK_PAINTED_WOOD,
+    PLASTER,
+    ROOF_TILES_1,
+    ROOF_TILES_2,
+    ROOF_TILES,
+    STRAW_1,
+    STRAW_2,
+    STRAW,
+    CEDAR_WOOD_X,
+    TEAK_WOOD_X,
+    CHERRY_WOOD_X,
+    MAPLE_WOOD_X,
+    PINE_WOOD_X,
+    WISTERIA_WOOD_X,
+    CEDAR_WOOD_Y,
+    TEAK_WOOD_Y,
+    CHERRY_WOOD_Y,
+    MAPLE_WOOD_Y,
+    PINE_WOOD_Y,
+    WISTERIA_WOOD_Y,
+    CEDAR_WOOD_Z,
+    TEAK_WOOD_Z,
+    CHERRY_WOOD_Z,
+    MAPLE_WOOD_Z,
+    PINE_WOOD_Z,
+    WISTERIA_WOOD_Z,
+    CEDAR_LEAVES,
+    TEAK_LEAVES,
+    CHERRY_BLOSSOMS_1,
+    CHERRY_BLOSSOMS_2,
+    CHERRY_BLOSSOMS_3,
+    CHERRY_BLOSSOMS_4,
+    MAPLE_LEAVES_1,
+    MAPLE_LEAVES_2,
+    MAPLE_LEAVES_3,
+    PINE_LEAVES,
+    WISTERIA_BLOSSOMS_1,
+    WISTERIA_BLOSSOMS_2,
+    WISTERIA_BLOSSOMS_3,
+    CEDAR_PLANKS,
+    TEAK_PLANKS,
+    CHERRY_PLANKS,
+    MAPLE_PLANKS,
+    PINE_PLANKS,
+    WISTERIA_PLANKS,
+    CEDAR_PLANKS_1,
+    TEAK_PLANKS_1,
+    CHERRY_PLANKS_1,
+    MAPLE_PLANKS_1,
+    PINE_PLANKS_1,
+    WISTERIA_PLANKS_1,
+    CEDAR_PLANKS_2,
+    TEAK_PLANKS_2,
+    CHERRY_PLANKS_2,
+    MAPLE_PLANKS_2,
+    PINE_PLANKS_2,
+    WISTERIA_PLANKS_2,
+    CEDAR_WINDOW_X,
+    TEAK_WINDOW_X,
+    CHERRY_WINDOW_X,
+    MAPLE_WINDOW_X,
+    PINE_WINDOW_X,
+    WISTERIA_WINDOW_X,
+    CEDAR_WINDOW_Z,
+    TEAK_WINDOW_Z,
+    CHERRY_WINDOW_Z,
+    MAPLE_WINDOW_Z,
+    PINE_WINDOW_Z,
+    WISTERIA_WINDOW_Z,
+    LILY_PAD,
+    LOTUS_1,
+    LOTUS_2,
+    TILLED_DIRT,
+    IRRIGATED_SOIL,
+    PATH,
+    WHEAT_1,
+    WHEAT_2,
+    WHEAT_3,
+    WHEAT_4,
+    WHEAT_5,
+    WHEAT_6,
+    WHEAT_7,
+    WHEAT_8,
+    RICE_1,
+    RICE_2,
+    RICE_3,
+    RICE_4,
+    RICE_5,
+    RICE_6,
+    RICE_01,
+    RICE_02,
+    BAMBOO_1,
+    BAMBOO_2,
+    BAMBOO_3,
+    TATAMI_XL,
+    TATAMI_XR,
+    TATAMI_ZT,
+    TATAMI_ZB,
+    PAPER_LANTERN,
+    WOOD_LANTERN,
+    CLOTH_1,
+    CLOTH_2,
+    CLOTH_3,
+    CLOTH_4,
+    CLOTH_5,
+    CLOTH_6,
+    CLOTH_7,
+    CLOTH_8,
+    PAINTING_1_XP,
+    PAINTING_2_XP,
+    PAINTING_3_XP,
+    PAINTING_4_XP,
+    PAINTING_5_XP,
+    PAINTING_6L_XP,
+    PAINTING_6R_XP,
+    PAINTING_7T_XP,
+    PAINTING_7B_XP,
+    PAINTING_1_XN,
+    PAINTING_2_XN,
+    PAINTING_3_XN,
+    PAINTING_4_XN,
+    PAINTING_5_XN,
+    PAINTING_6L_XN,
+    PAINTING_6R_XN,
+    PAINTING_7T_XN,
+    PAINTING_7B_XN,
+    PAINTING_1_ZP,
+    PAINTING_2_ZP,
+    PAINTING_3_ZP,
+    PAINTING_4_ZP,
+    PAINTING_5_ZP,
+    PAINTING_6L_ZP,
+    PAINTING_6R_ZP,
+    PAINTING_7T_ZP,
+    PAINTING_7B_ZP,
+    PAINTING_1_ZN,
+    PAINTING_2_ZN,
+    PAINTING_3_ZN,
+    PAINTING_4_ZN,
+    PAINTING_5_ZN,
+    PAINTING_6L_ZN,
+    PAINTING_6R_ZN,
+    PAINTING_7T_ZN,
+    PAINTING_7B_ZN,
+    BONSAI_TREE,
+    MAGNOLIA_IKEBANA,
+    LOTUS_IKEBANA,
+    GREEN_HYDRANGEA_IKEBANA,
+    CHRYSANTHEMUM_IKEBANA,
+    CHERRY_BLOSSOM_IKEBANA,
+    BLUE_HYDRANGEA_IKEBANA,
+    TULIP_IKEBANA,
+    DAFFODIL_IKEBANA,
+    PLUM_BLOSSOM_IKEBANA,
+    MAGNOLIA_BUD_IKEBANA,
+    POPPY_IKEBANA,
+    MAPLE_IKEBANA,
+    ONCIDIUM_IKEBANA,
+    GHOST_LILY,
+    GHOST_WEED,
+    CORAL_1,
+    CORAL_2,
+    CORAL_3,
+    CORAL_4,
+    KELP_1,
+    KELP_2,
+    SEA_GRASS,
+    EMPTY
+};
+
+enum BiomeEnum : unsigned char { MOUNTAINS, HILLS, FOREST, ISLANDS, CAVES };
+
+// The six cardinal directions in 3D space + diagonals (rotated 45 degrees)
+enum Direction : unsigned char {
+    XPOS,
+    XNEG,
+    YPOS,
+    YNEG,
+    ZPOS,
+    ZNEG,
+    XPOS_ZPOS,
+    XPOS_ZNEG,
+    XNEG_ZNEG,
+    XNEG_ZPOS
+};
@@ -0,0 +1,1457 @@
+#pragma once
+#include "blocktype.h"
+#include <array>
+
+// Texture atlas lookup for every (BlockType, Direction) face.
+// Faces are listed by hand below and baked at compile time into a dense
+// [BlockType][Direction] table, so emitting a vertex costs one indexed load.
+struct FaceUV
+{
+    unsigned char texFlag;  // passed to the shader as vs_BT, selects special shading
+    unsigned char u;        // bottom-left cell of the face in the 16 x 16 texture atlas
+    unsigned char v;
+    unsigned char flags;    // BlockUVTable::Flag bits
+};
+
+namespace BlockUVTable
+{
+
+enum Flag : unsigned char {
+    VALID = 1 << 0,       // the face has a texture at all
+    SWAP_UV = 1 << 1,     // rotate the texture 90 degrees by swapping u and v (sideways logs)
+    DOUBLE_RES = 1 << 2,  // texture spans 2 x 2 atlas cells (32 x 32 paintings)
+    TRIPLE_RES = 1 << 3,  // texture spans 3 x 3 atlas cells (48 x 48 paintings)
+    MIRROR_U = 1 << 4,    // flip u across the double-res texture, for paintings facing XNEG / ZNEG
+};
+
+constexpr int NUM_DIRECTIONS = 10;
+
+struct Entry
+{
+    BlockType bt;
+    Direction dir;
+    unsigned char texFlag;
+    unsigned char u;
+    unsigned char v;
+};
+
+struct Face
+{
+    BlockType bt;
+    Direction dir;
+};
+
+// maps blocktype and direction to texture flag and uv coord
+constexpr Entry entries[] = {
+    {GRASS, XPOS, 1, 0, 11},
+    {GRASS, XNEG, 1, 0, 11},
+    {GRASS, ZPOS, 1, 0, 11},
+    {GRASS, ZNEG, 1, 0, 11},
+    {GRASS, YPOS, 1, 0, 11},
+    {GRASS, YNEG, 1, 0, 11},
+
+    {DIRT, XPOS, 0, 0, 13},
+    {DIRT, XNEG, 0, 0, 13},
+    {DIRT, ZPOS, 0, 0, 13},
+    {DIRT, ZNEG, 0, 0, 13},
+    {DIRT, YPOS, 0, 0, 13},
+    {DIRT, YNEG, 0, 0, 13},
+
+    {STONE, XPOS, 0, 1, 15},
+    {STONE, XNEG, 0, 1, 15},
+    {STONE, ZPOS, 0, 1, 15},
+    {STONE, ZNEG, 0, 1, 15},
+    {STONE, YPOS, 0, 1, 15},
+    {STONE, YNEG, 0, 1, 15},
+
+    {COBBLESTONE, XPOS, 0, 0, 15},
+    {COBBLESTONE, XNEG, 0, 0, 15},
+    {COBBLESTONE, ZPOS, 0, 0, 15},
+    {COBBLESTONE, ZNEG, 0, 0, 15},
+    {COBBLESTONE, YPOS, 0, 0, 15},
+    {COBBLESTONE, YNEG, 0, 0, 15},
+
+    {MOSS_STONE, XPOS, 0, 3, 15},
+    {MOSS_STONE, XNEG, 0, 3, 15},
+    {MOSS_STONE, ZPOS, 0, 3, 15},
+    {MOSS_STONE, ZNEG, 0, 3, 15},
+    {MOSS_STONE, YPOS, 0, 3, 15},
+    {MOSS_STONE, YNEG, 0, 3, 15},
+
+    {SAND, XPOS, 0, 0, 14},
+    {SAND, XNEG, 0, 0, 14},
+    {SAND, ZPOS, 0, 0, 14},
+    {SAND, ZNEG, 0, 0, 14},
+    {SAND, YPOS, 0, 0, 14},
+    {SAND, YNEG, 0, 0, 14},
+
+    {TALL_GRASS, XPOS_ZPOS, 1, 0, 10},
+    {TALL_GRASS, XPOS_ZNEG, 1, 0, 10},
+    {TALL_GRASS, XNEG_ZPOS, 1, 0, 10},
+    {TALL_GRASS, XNEG_ZNEG, 1, 0, 10},
+
+    {WATER, XPOS, 2, 13, 3},
+    {WATER, XNEG, 2, 13, 3},
+    {WATER, ZPOS, 2, 13, 3},
+    {WATER, ZNEG, 2, 13, 3},
+    {WATER, YPOS, 2, 13, 3},
+    {WATER, YNEG, 2, 13, 3},
+
+    {LAVA, XPOS, 3, 14, 0},
+    {LAVA, XNEG, 3, 14, 0},
+    {LAVA, ZPOS, 3, 14, 0},
+    {LAVA, ZNEG, 3, 14, 0},
+    {LAVA, YPOS, 3, 14, 0},
+    {LAVA, YNEG, 3, 14, 0},
+
+    {BEDROCK, XPOS, 0, 2, 15},
+    {BEDROCK, XNEG, 0, 2, 15},
+    {BEDROCK, ZPOS, 0, 2, 15},
+    {BEDROCK, ZNEG, 0, 2, 15},
+    {BEDROCK, YPOS, 0, 2, 15},
+    {BEDROCK, YNEG, 0, 2, 15},
+
+    {SNOW_1, XPOS, 0, 1, 14},
+    {SNOW_1, XNEG, 0, 1, 14},
+    {SNOW_1, ZPOS, 0, 1, 14},
+    {SNOW_1, ZNEG, 0, 1, 14},
+    {SNOW_1, YPOS, 0, 1, 14},
+    {SNOW_1, YNEG, 0, 1, 14},
+
+    {SNOW_2, XPOS, 0, 1, 14},
+    {SNOW_2, XNEG, 0, 1, 14},
+    {SNOW_2, ZPOS, 0, 1, 14},
+    {SNOW_2, ZNEG, 0, 1, 14},
+    {SNOW_2, YPOS, 0, 1, 14},
+    {SNOW_2, YNEG, 0, 1, 14},
+
+    {SNOW_3, XPOS, 0, 1, 14},
+    {SNOW_3, XNEG, 0, 1, 14},
+    {SNOW_3, ZPOS, 0, 1, 14},
+    {SNOW_3, ZNEG, 0, 1, 14},
+    {SNOW_3, YPOS, 0, 1, 14},
+    {SNOW_3, YNEG, 0, 1, 14},
+
+    {SNOW_4, XPOS, 0, 1, 14},
+    {SNOW_4, XNEG, 0, 1, 14},
+    {SNOW_4, ZPOS, 0, 1, 14},
+    {SNOW_4, ZNEG, 0, 1, 14},
+    {SNOW_4, YPOS, 0, 1, 14},
+    {SNOW_4, YNEG, 0, 1, 14},
+
+    {SNOW_5, XPOS, 0, 1, 14},
+    {SNOW_5, XNEG, 0, 1, 14},
+    {SNOW_5, ZPOS, 0, 1, 14},
+    {SNOW_5, ZNEG, 0, 1, 14},
+    {SNOW_5, YPOS, 0, 1, 14},
+    {SNOW_5, YNEG, 0, 1, 14},
+
+    {SNOW_6, XPOS, 0, 1, 14},
+    {SNOW_6, XNEG, 0, 1, 14},
+    {SNOW_6, ZPOS, 0, 1, 14},
+    {SNOW_6, ZNEG, 0, 1, 14},
+    {SNOW_6, YPOS, 0, 1, 14},
+    {SNOW_6, YNEG, 0, 1, 14},
+
+    {SNOW_7, XPOS, 0, 1, 14},
+    {SNOW_7, XNEG, 0, 1, 14},
+    {SNOW_7, ZPOS, 0, 1, 14},
+    {SNOW_7, ZNEG, 0, 1, 14},
+    {SNOW_7, YPOS, 0, 1, 14},
+    {SNOW_7, YNEG, 0, 1, 14},
+
+    {SNOW_8, XPOS, 0, 1, 14},
+    {SNOW_8, XNEG, 0, 1, 14},
+    {SNOW_8, ZPOS, 0, 1, 14},
+    {SNOW_8, ZNEG, 0, 1, 14},
+    {SNOW_8, YPOS, 0, 1, 14},
+    {SNOW_8, YNEG, 0, 1, 14},
+
+    {ICE, XPOS, 0, 2, 14},
+    {ICE, XNEG, 0, 2, 14},
+    {ICE, ZPOS, 0, 2, 14},
+    {ICE, ZNEG, 0, 2, 14},
+    {ICE, YPOS, 0, 2, 14},
+    {ICE, YNEG, 0, 2, 14},
+
+    {CEDAR_WOOD_X, XPOS, 0, 5, 12},
+    {CEDAR_WOOD_X, XNEG, 0, 5, 12},
+    {CEDAR_WOOD_X, ZPOS, 0, 5, 13},
+    {CEDAR_WOOD_X, ZNEG, 0, 5, 13},
+    {CEDAR_WOOD_X, YPOS, 0, 5, 13},
+    {CEDAR_WOOD_X, YNEG, 0, 5, 13},
+
+    {TEAK_WOOD_X, XPOS, 0, 6, 12},
+    {TEAK_WOOD_X, XNEG, 0, 6, 12},
+    {TEAK_WOOD_X, ZPOS, 0, 6, 13},
+    {TEAK_WOOD_X, ZNEG, 0, 6, 13},
+    {TEAK_WOOD_X, YPOS, 0, 6, 13},
+    {TEAK_WOOD_X, YNEG, 0, 6, 13},
+
+    {CHERRY_WOOD_X, XPOS, 0, 7, 12},
+    {CHERRY_WOOD_X, XNEG, 0, 7, 12},
+    {CHERRY_WOOD_X, ZPOS, 0, 7, 13},
+    {CHERRY_WOOD_X, ZNEG, 0, 7, 13},
+    {CHERRY_WOOD_X, YPOS, 0, 7, 13},
+    {CHERRY_WOOD_X, YNEG, 0, 7, 13},
+
+    {MAPLE_WOOD_X, XPOS, 0, 8, 12},
+    {MAPLE_WOOD_X, XNEG, 0, 8, 12},
+    {MAPLE_WOOD_X, ZPOS, 0, 8, 13},
+    {MAPLE_WOOD_X, ZNEG, 0, 8, 13},
+    {MAPLE_WOOD_X, YPOS, 0, 8, 13},
+    {MAPLE_WOOD_X, YNEG, 0, 8, 13},
+
+    {PINE_WOOD_X, XPOS, 0, 9, 13},
+    {PINE_WOOD_X, XNEG, 0, 9, 13},
+    {PINE_WOOD_X, ZPOS, 0, 9, 13},
+    {PINE_WOOD_X, ZNEG, 0, 9, 13},
+    {PINE_WOOD_X, YPOS, 0, 9, 13},
+    {PINE_WOOD_X, YNEG, 0, 9, 13},
+
+    {WISTERIA_WOOD_X, XPOS, 0, 10, 12},
+    {WISTERIA_WOOD_X, XNEG, 0, 10, 12},
+    {WISTERIA_WOOD_X, ZPOS, 0, 10, 13},
+    {WISTERIA_WOOD_X, ZNEG, 0, 10, 13},
+    {WISTERIA_WOOD_X, YPOS, 0, 10, 13},
+    {WISTERIA_WOOD_X, YNEG, 0, 10, 13},
+
+    {CEDAR_WOOD_Y, XPOS, 0, 5, 13},
+    {CEDAR_WOOD_Y, XNEG, 0, 5, 13},
+    {CEDAR_WOOD_Y, ZPOS, 0, 5, 13},
+    {CEDAR_WOOD_Y, ZNEG, 0, 5, 13},
+    {CEDAR_WOOD_Y, YPOS, 0, 5, 12},
+    {CEDAR_WOOD_Y, YNEG, 0, 5, 12},
+
+    {TEAK_WOOD_Y, XPOS, 0, 6, 13},
+    {TEAK_WOOD_Y, XNEG, 0, 6, 13},
+    {TEAK_WOOD_Y, ZPOS, 0, 6, 13},
+    {TEAK_WOOD_Y, ZNEG, 0, 6, 13},
+    {TEAK_WOOD_Y, YPOS, 0, 6, 12},
+    {TEAK_WOOD_Y, YNEG, 0, 6, 12},
+
+    {CHERRY_WOOD_Y, XPOS, 0, 7, 13},
+    {CHERRY_WOOD_Y, XNEG, 0, 7, 13},
+    {CHERRY_WOOD_Y, ZPOS, 0, 7, 13},
+    {CHERRY_WOOD_Y, ZNEG, 0, 7, 13},
+    {CHERRY_WOOD_Y, YPOS, 0, 7, 12},
+    {CHERRY_WOOD_Y, YNEG, 0, 7, 12},
+
+    {MAPLE_WOOD_Y, XPOS, 0, 8, 13},
+    {MAPLE_WOOD_Y, XNEG, 0, 8, 13},
+    {MAPLE_WOOD_Y, ZPOS, 0, 8, 13},
+    {MAPLE_WOOD_Y, ZNEG, 0, 8, 13},
+    {MAPLE_WOOD_Y, YPOS, 0, 8, 12},
+    {MAPLE_WOOD_Y, YNEG, 0, 8, 12},
+
+    {PINE_WOOD_Y, XPOS, 0, 9, 13},
+    {PINE_WOOD_Y, XNEG, 0, 9, 13},
+    {PINE_WOOD_Y, ZPOS, 0, 9, 13},
+    {PINE_WOOD_Y, ZNEG, 0, 9, 13},
+    {PINE_WOOD_Y, YPOS, 0, 9, 12},
+    {PINE_WOOD_Y, YNEG, 0, 9, 12},
+
+    {WISTERIA_WOOD_Y, XPOS, 0, 10, 13},
+    {WISTERIA_WOOD_Y, XNEG, 0, 10, 13},
+    {WISTERIA_WOOD_Y, ZPOS, 0, 10, 13},
+    {WISTERIA_WOOD_Y, ZNEG, 0, 10, 13},
+    {WISTERIA_WOOD_Y, YPOS, 0, 10, 12},
+    {WISTERIA_WOOD_Y, YNEG, 0, 10, 12},
+
+    {CEDAR_WOOD_Z, XPOS, 0, 5, 13},
+    {CEDAR_WOOD_Z, XNEG, 0, 5, 13},
+    {CEDAR_WOOD_Z, ZPOS, 0, 5, 12},
+    {CEDAR_WOOD_Z, ZNEG, 0, 5, 12},
+    {CEDAR_WOOD_Z, YPOS, 0, 5, 13},
+    {CEDAR_WOOD_Z, YNEG, 0, 5, 13},
+
+    {TEAK_WOOD_Z, XPOS, 0, 6, 13},
+    {TEAK_WOOD_Z, XNEG, 0, 6, 13},
+    {TEAK_WOOD_Z, ZPOS, 0, 6, 12},
+    {TEAK_WOOD_Z, ZNEG, 0, 6, 12},
+    {TEAK_WOOD_Z, YPOS, 0, 6, 13},
+    {TEAK_WOOD_Z, YNEG, 0, 6, 13},
+
+    {CHERRY_WOOD_Z, XPOS, 0, 7, 13},
+    {CHERRY_WOOD_Z, XNEG, 0, 7, 13},
+    {CHERRY_WOOD_Z, ZPOS, 0, 7, 12},
+    {CHERRY_WOOD_Z, ZNEG, 0, 7, 12},
+    {CHERRY_WOOD_Z, YPOS, 0, 7, 13},
+    {CHERRY_WOOD_Z, YNEG, 0, 7, 13},
+
+    {MAPLE_WOOD_Z, XPOS, 0, 8, 13},
+    {MAPLE_WOOD_Z, XNEG, 0, 8, 13},
+    {MAPLE_WOOD_Z, ZPOS, 0, 8, 12},
+    {MAPLE_WOOD_Z, ZNEG, 0, 8, 12},
+    {MAPLE_WOOD_Z, YPOS, 0, 8, 13},
+    {MAPLE_WOOD_Z, YNEG, 0, 8, 13},
+
+    {PINE_WOOD_Z, XPOS, 0, 9, 13},
+    {PINE_WOOD_Z, XNEG, 0, 9, 13},
+    {PINE_WOOD_Z, ZPOS, 0, 9, 12},
+    {PINE_WOOD_Z, ZNEG, 0, 9, 12},
+    {PINE_WOOD_Z, YPOS, 0, 9, 13},
+    {PINE_WOOD_Z, YNEG, 0, 9, 13},
+
+    {WISTERIA_WOOD_Z, XPOS, 0, 10, 13},
+    {WISTERIA_WOOD_Z, XNEG, 0, 10, 13},
+    {WISTERIA_WOOD_Z, ZPOS, 0, 10, 12},
+    {WISTERIA_WOOD_Z, ZNEG, 0, 10, 12},
+    {WISTERIA_WOOD_Z, YPOS, 0, 10, 13},
+    {WISTERIA_WOOD_Z, YNEG, 0, 10, 13},
+
+    {CEDAR_LEAVES, XPOS, 0, 5, 11},
+    {CEDAR_LEAVES, XNEG, 0, 5, 11},
+    {CEDAR_LEAVES, ZPOS, 0, 5, 11},
+    {CEDAR_LEAVES, ZNEG, 0, 5, 11},
+    {CEDAR_LEAVES, YPOS, 0, 5, 11},
+    {CEDAR_LEAVES, YNEG, 0, 5, 11},
+
+    {TEAK_LEAVES, XPOS, 0, 6, 11},
+    {TEAK_LEAVES, XNEG, 0, 6, 11},
+    {TEAK_LEAVES, ZPOS, 0, 6, 11},
+    {TEAK_LEAVES, ZNEG, 0, 6, 11},
+    {TEAK_LEAVES, YPOS, 0, 6, 11},
+    {TEAK_LEAVES, YNEG, 0, 6, 11},
+
+    {CHERRY_BLOSSOMS_1, XPOS, 0, 7, 8},
+    {CHERRY_BLOSSOMS_1, XNEG, 0, 7, 8},
+    {CHERRY_BLOSSOMS_1, ZPOS, 0, 7, 8},
+    {CHERRY_BLOSSOMS_1, ZNEG, 0, 7, 8},
+    {CHERRY_BLOSSOMS_1, YPOS, 0, 7, 8},
+    {CHERRY_BLOSSOMS_1, YNEG, 0, 7, 8},
+
+    {CHERRY_BLOSSOMS_2, XPOS, 0, 7, 9},
+    {CHERRY_BLOSSOMS_2, XNEG, 0, 7, 9},
+    {CHERRY_BLOSSOMS_2, ZPOS, 0, 7, 9},
+    {CHERRY_BLOSSOMS_2, ZNEG, 0, 7, 9},
+    {CHERRY_BLOSSOMS_2, YPOS, 0, 7, 9},
+    {CHERRY_BLOSSOMS_2, YNEG, 0, 7, 9},
+
+    {CHERRY_BLOSSOMS_3, XPOS, 0, 7, 10},
+    {CHERRY_BLOSSOMS_3, XNEG, 0, 7, 10},
+    {CHERRY_BLOSSOMS_3, ZPOS, 0, 7, 10},
+    {CHERRY_BLOSSOMS_3, ZNEG, 0, 7, 10},
+    {CHERRY_BLOSSOMS_3, YPOS, 0, 7, 10},
+    {CHERRY_BLOSSOMS_3, YNEG, 0, 7, 10},
+
+    {CHERRY_BLOSSOMS_4, XPOS, 0, 7, 11},
+    {CHERRY_BLOSSOMS_4, XNEG, 0, 7, 11},
+    {CHERRY_BLOSSOMS_4, ZPOS, 0, 7, 11},
+    {CHERRY_BLOSSOMS_4, ZNEG, 0, 7, 11},
+    {CHERRY_BLOSSOMS_4, YPOS, 0, 7, 11},
+    {CHERRY_BLOSSOMS_4, YNEG, 0, 7, 11},
+
+    {MAPLE_LEAVES_1, XPOS, 0, 8, 9},
+    {MAPLE_LEAVES_1, XNEG, 0, 8, 9},
+    {MAPLE_LEAVES_1, ZPOS, 0, 8, 9},
+    {MAPLE_LEAVES_1, ZNEG, 0, 8, 9},
+    {MAPLE_LEAVES_1, YPOS, 0, 8, 9},
+    {MAPLE_LEAVES_1, YNEG, 0, 8, 9},
+
+    {MAPLE_LEAVES_2, XPOS, 0, 8, 10},
+    {MAPLE_LEAVES_2, XNEG, 0, 8, 10},
+    {MAPLE_LEAVES_2, ZPOS, 0, 8, 10},
+    {MAPLE_LEAVES_2, ZNEG, 0, 8, 10},
+    {MAPLE_LEAVES_2, YPOS, 0, 8, 10},
+    {MAPLE_LEAVES_2, YNEG, 0, 8, 10},
+
+    {MAPLE_LEAVES_3, XPOS, 0, 8, 11},
+    {MAPLE_LEAVES_3, XNEG, 0, 8, 11},
+    {MAPLE_LEAVES_3, ZPOS, 0, 8, 11},
+    {MAPLE_LEAVES_3, ZNEG, 0, 8, 11},
+    {MAPLE_LEAVES_3, YPOS, 0, 8, 11},
+    {MAPLE_LEAVES_3, YNEG, 0, 8, 11},
+
+    {PINE_LEAVES, XPOS, 0, 9, 11},
+    {PINE_LEAVES, XNEG, 0, 9, 11},
+    {PINE_LEAVES, ZPOS, 0, 9, 11},
+    {PINE_LEAVES, ZNEG, 0, 9, 11},
+    {PINE_LEAVES, YPOS, 0, 9, 11},
+    {PINE_LEAVES, YNEG, 0, 9, 11},
+
+    {WISTERIA_BLOSSOMS_1, XPOS, 4, 10, 9},
+    {WISTERIA_BLOSSOMS_1, XNEG, 4, 10, 9},
+    {WISTERIA_BLOSSOMS_1, ZPOS, 4, 10, 9},
+    {WISTERIA_BLOSSOMS_1, ZNEG, 4, 10, 9},
+    {WISTERIA_BLOSSOMS_1, YPOS, 4, 10, 9},
+    {WISTERIA_BLOSSOMS_1, YNEG, 4, 10, 9},
+
+    {WISTERIA_BLOSSOMS_2, XPOS, 4, 10, 10},
+    {WISTERIA_BLOSSOMS_2, XNEG, 4, 10, 10},
+    {WISTERIA_BLOSSOMS_2, ZPOS, 4, 10, 10},
+    {WISTERIA_BLOSSOMS_2, ZNEG, 4, 10, 10},
+    {WISTERIA_BLOSSOMS_2, YPOS, 4, 10, 10},
+    {WISTERIA_BLOSSOMS_2, YNEG, 4, 10, 10},
+
+    {WISTERIA_BLOSSOMS_3, XPOS, 4, 10, 11},
+    {WISTERIA_BLOSSOMS_3, XNEG, 4, 10, 11},
+    {WISTERIA_BLOSSOMS_3, ZPOS, 4, 10, 11},
+    {WISTERIA_BLOSSOMS_3, ZNEG, 4, 10, 11},
+    {WISTERIA_BLOSSOMS_3, YPOS, 4, 10, 11},
+    {WISTERIA_BLOSSOMS_3, YNEG, 4, 10, 11},
+
+    {CEDAR_PLANKS, XPOS, 0, 5, 15},
+    {CEDAR_PLANKS, XNEG, 0, 5, 15},
+    {CEDAR_PLANKS, ZPOS, 0, 5, 15},
+    {CEDAR_PLANKS, ZNEG, 0, 5, 15},
+    {CEDAR_PLANKS, YPOS, 0, 5, 15},
+    {CEDAR_PLANKS, YNEG, 0, 5, 15},
+
+    {TEAK_PLANKS, XPOS, 0, 6, 15},
+    {TEAK_PLANKS, XNEG, 0, 6, 15},
+    {TEAK_PLANKS, ZPOS, 0, 6, 15},
+    {TEAK_PLANKS, ZNEG, 0, 6, 15},
+    {TEAK_PLANKS, YPOS, 0, 6, 15},
+    {TEAK_PLANKS, YNEG, 0, 6, 15},
+
+    {CHERRY_PLANKS, XPOS, 0, 7, 15},
+    {CHERRY_PLANKS, XNEG, 0, 7, 15},
+    {CHERRY_PLANKS, ZPOS, 0, 7, 15},
+    {CHERRY_PLANKS, ZNEG, 0, 7, 15},
+    {CHERRY_PLANKS, YPOS, 0, 7, 15},
+    {CHERRY_PLANKS, YNEG, 0, 7, 15},
+
+    {MAPLE_PLANKS, XPOS, 0, 8, 15},
+    {MAPLE_PLANKS, XNEG, 0, 8, 15},
+    {MAPLE_PLANKS, ZPOS, 0, 8, 15},
+    {MAPLE_PLANKS, ZNEG, 0, 8, 15},
+    {MAPLE_PLANKS, YPOS, 0, 8, 15},
+    {MAPLE_PLANKS, YNEG, 0, 8, 15},
+
+    {PINE_PLANKS, XPOS, 0, 9, 15},
+    {PINE_PLANKS, XNEG, 0, 9, 15},
+    {PINE_PLANKS, ZPOS, 0, 9, 15},
+    {PINE_PLANKS, ZNEG, 0, 9, 15},
+    {PINE_PLANKS, YPOS, 0, 9, 15},
+    {PINE_PLANKS, YNEG, 0, 9, 15},
+
+    {WISTERIA_PLANKS, XPOS, 0, 10, 15},
+    {WISTERIA_PLANKS, XNEG, 0, 10, 15},
+    {WISTERIA_PLANKS, ZPOS, 0, 10, 15},
+    {WISTERIA_PLANKS, ZNEG, 0, 10, 15},
+    {WISTERIA_PLANKS, YPOS, 0, 10, 15},
+    {WISTERIA_PLANKS, YNEG, 0, 10, 15},
+
+    {CEDAR_PLANKS_1, XPOS, 0, 5, 15},
+    {CEDAR_PLANKS_1, XNEG, 0, 5, 15},
+    {CEDAR_PLANKS_1, ZPOS, 0, 5, 15},
+    {CEDAR_PLANKS_1, ZNEG, 0, 5, 15},
+    {CEDAR_PLANKS_1, YPOS, 0, 5, 15},
+    {CEDAR_PLANKS_1, YNEG, 0, 5, 15},
+
+    {TEAK_PLANKS_1, XPOS, 0, 6, 15},
+    {TEAK_PLANKS_1, XNEG, 0, 6, 15},
+    {TEAK_PLANKS_1, ZPOS, 0, 6, 15},
+    {TEAK_PLANKS_1, ZNEG, 0, 6, 15},
+    {TEAK_PLANKS_1, YPOS, 0, 6, 15},
+    {TEAK_PLANKS_1, YNEG, 0, 6, 15},
+
+    {CHERRY_PLANKS_1, XPOS, 0, 7, 15},
+    {CHERRY_PLANKS_1, XNEG, 0, 7, 15},
+    {CHERRY_PLANKS_1, ZPOS, 0, 7, 15},
+    {CHERRY_PLANKS_1, ZNEG, 0, 7, 15},
+    {CHERRY_PLANKS_1, YPOS, 0, 7, 15},
+    {CHERRY_PLANKS_1, YNEG, 0, 7, 15},
+
+    {MAPLE_PLANKS_1, XPOS, 0, 8, 15},
+    {MAPLE_PLANKS_1, XNEG, 0, 8, 15},
+    {MAPLE_PLANKS_1, ZPOS, 0, 8, 15},
+    {MAPLE_PLANKS_1, ZNEG, 0, 8, 15},
+    {MAPLE_PLANKS_1, YPOS, 0, 8, 15},
+    {MAPLE_PLANKS_1, YNEG, 0, 8, 15},
+
+    {PINE_PLANKS_1, XPOS, 0, 9, 15},
+    {PINE_PLANKS_1, XNEG, 0, 9, 15},
+    {PINE_PLANKS_1, ZPOS, 0, 9, 15},
+    {PINE_PLANKS_1, ZNEG, 0, 9, 15},
+    {PINE_PLANKS_1, YPOS, 0, 9, 15},
+    {PINE_PLANKS_1, YNEG, 0, 9, 15},
+
+    {WISTERIA_PLANKS_1, XPOS, 0, 10, 15},
+    {WISTERIA_PLANKS_1, XNEG, 0, 10, 15},
+    {WISTERIA_PLANKS_1, ZPOS, 0, 10, 15},
+    {WISTERIA_PLANKS_1, ZNEG, 0, 10, 15},
+    {WISTERIA_PLANKS_1, YPOS, 0, 10, 15},
+    {WISTERIA_PLANKS_1, YNEG, 0, 10, 15},
+
+    {CEDAR_PLANKS_2, XPOS, 0, 5, 15},
+    {CEDAR_PLANKS_2, XNEG, 0, 5, 15},
+    {CEDAR_PLANKS_2, ZPOS, 0, 5, 15},
+    {CEDAR_PLANKS_2, ZNEG, 0, 5, 15},
+    {CEDAR_PLANKS_2, YPOS, 0, 5, 15},
+    {CEDAR_PLANKS_2, YNEG, 0, 5, 15},
+
+    {TEAK_PLANKS_2, XPOS, 0, 6, 15},
+    {TEAK_PLANKS_2, XNEG, 0, 6, 15},
+    {TEAK_PLANKS_2, ZPOS, 0, 6, 15},
+    {TEAK_PLANKS_2, ZNEG, 0, 6, 15},
+    {TEAK_PLANKS_2, YPOS, 0, 6, 15},
+    {TEAK_PLANKS_2, YNEG, 0, 6, 15},
+
+    {CHERRY_PLANKS_2, XPOS, 0, 7, 15},
+    {CHERRY_PLANKS_2, XNEG, 0, 7, 15},
+    {CHERRY_PLANKS_2, ZPOS, 0, 7, 15},
+    {CHERRY_PLANKS_2, ZNEG, 0, 7, 15},
+    {CHERRY_PLANKS_2, YPOS, 0, 7, 15},
+    {CHERRY_PLANKS_2, YNEG, 0, 7, 15},
+
+    {MAPLE_PLANKS_2, XPOS, 0, 8, 15},
+    {MAPLE_PLANKS_2, XNEG, 0, 8, 15},
+    {MAPLE_PLANKS_2, ZPOS, 0, 8, 15},
+    {MAPLE_PLANKS_2, ZNEG, 0, 8, 15},
+    {MAPLE_PLANKS_2, YPOS, 0, 8, 15},
+    {MAPLE_PLANKS_2, YNEG, 0, 8, 15},
+
+    {PINE_PLANKS_2, XPOS, 0, 9, 15},
+    {PINE_PLANKS_2, XNEG, 0, 9, 15},
+    {PINE_PLANKS_2, ZPOS, 0, 9, 15},
+    {PINE_PLANKS_2, ZNEG, 0, 9, 15},
+    {PINE_PLANKS_2, YPOS, 0, 9, 15},
+    {PINE_PLANKS_2, YNEG, 0, 9, 15},
+
+    {WISTERIA_PLANKS_2, XPOS, 0, 10, 15},
+    {WISTERIA_PLANKS_2, XNEG, 0, 10, 15},
+    {WISTERIA_PLANKS_2, ZPOS, 0, 10, 15},
+    {WISTERIA_PLANKS_2, ZNEG, 0, 10, 15},
+    {WISTERIA_PLANKS_2, YPOS, 0, 10, 15},
+    {WISTERIA_PLANKS_2, YNEG, 0, 10, 15},
+
+    {CEDAR_WINDOW_X, XPOS, 0, 5, 14},
+    {CEDAR_WINDOW_X, XNEG, 0, 5, 14},
+    {CEDAR_WINDOW_X, ZPOS, 0, 5, 15},
+    {CEDAR_WINDOW_X, ZNEG, 0, 5, 15},
+    {CEDAR_WINDOW_X, YPOS, 0, 5, 15},
+    {CEDAR_WINDOW_X, YNEG, 0, 5, 15},
+
+    {TEAK_WINDOW_X, XPOS, 0, 6, 14},
+    {TEAK_WINDOW_X, XNEG, 0, 6, 14},
+    {TEAK_WINDOW_X, ZPOS, 0, 6, 15},
+    {TEAK_WINDOW_X, ZNEG, 0, 6, 15},
+    {TEAK_WINDOW_X, YPOS, 0, 6, 15},
+    {TEAK_WINDOW_X, YNEG, 0, 6, 15},
+
+    {CHERRY_WINDOW_X, XPOS, 0, 7, 14},
+    {CHERRY_WINDOW_X, XNEG, 0, 7, 14},
+    {CHERRY_WINDOW_X, ZPOS, 0, 7, 15},
+    {CHERRY_WINDOW_X, ZNEG, 0, 7, 15},
+    {CHERRY_WINDOW_X, YPOS, 0, 7, 15},
+    {CHERRY_WINDOW_X, YNEG, 0, 7, 15},
+
+    {MAPLE_WINDOW_X, XPOS, 0, 8, 14},
+    {MAPLE_WINDOW_X, XNEG, 0, 8, 14},
+    {MAPLE_WINDOW_X, ZPOS, 0, 8, 15},
+    {MAPLE_WINDOW_X, ZNEG, 0, 8, 15},
+    {MAPLE_WINDOW_X, YPOS, 0, 8, 15},
+    {MAPLE_WINDOW_X, YNEG, 0, 8, 15},
+
+    {PINE_WINDOW_X, XPOS, 0, 9, 14},
+    {PINE_WINDOW_X, XNEG, 0, 9, 14},
+    {PINE_WINDOW_X, ZPOS, 0, 9, 15},
+    {PINE_WINDOW_X, ZNEG, 0, 9, 15},
+    {PINE_WINDOW_X, YPOS, 0, 9, 15},
+    {PINE_WINDOW_X, YNEG, 0, 9, 15},
+
+    {WISTERIA_WINDOW_X, XPOS, 0, 10, 14},
+    {WISTERIA_WINDOW_X, XNEG, 0, 10, 14},
+    {WISTERIA_WINDOW_X, ZPOS, 0, 10, 15},
+    {WISTERIA_WINDOW_X, ZNEG, 0, 10, 15},
+    {WISTERIA_WINDOW_X, YPOS, 0, 10, 15},
+    {WISTERIA_WINDOW_X, YNEG, 0, 10, 15},
+
+    {CEDAR_WINDOW_Z, XPOS, 0, 5, 15},
+    {CEDAR_WINDOW_Z, XNEG, 0, 5, 15},
+    {CEDAR_WINDOW_Z, ZPOS, 0, 5, 14},
+    {CEDAR_WINDOW_Z, ZNEG, 0, 5, 14},
+    {CEDAR_WINDOW_Z, YPOS, 0, 5, 15},
+    {CEDAR_WINDOW_Z, YNEG, 0, 5, 15},
+
+    {TEAK_WINDOW_Z, XPOS, 0, 6, 15},
+    {TEAK_WINDOW_Z, XNEG, 0, 6, 15},
+    {TEAK_WINDOW_Z, ZPOS, 0, 6, 14},
+    {TEAK_WINDOW_Z, ZNEG, 0, 6, 14},
+    {TEAK_WINDOW_Z, YPOS, 0, 6, 15},
+    {TEAK_WINDOW_Z, YNEG, 0, 6, 15},
+
+    {CHERRY_WINDOW_Z, XPOS, 0, 7, 15},
+    {CHERRY_WINDOW_Z, XNEG, 0, 7, 15},
+    {CHERRY_WINDOW_Z, ZPOS, 0, 7, 14},
+    {CHERRY_WINDOW_Z, ZNEG, 0, 7, 14},
+    {CHERRY_WINDOW_Z, YPOS, 0, 7, 15},
+    {CHERRY_WINDOW_Z, YNEG, 0, 7, 15},
+
+    {MAPLE_WINDOW_Z, XPOS, 0, 8, 15},
+    {MAPLE_WINDOW_Z, XNEG, 0, 8, 15},
+    {MAPLE_WINDOW_Z, ZPOS, 0, 8, 14},
+    {MAPLE_WINDOW_Z, ZNEG, 0, 8, 14},
+    {MAPLE_WINDOW_Z, YPOS, 0, 8, 15},
+    {MAPLE_WINDOW_Z, YNEG, 0, 8, 15},
+
+    {PINE_WINDOW_Z, XPOS, 0, 9, 15},
+    {PINE_WINDOW_Z, XNEG, 0, 9, 15},
+    {PINE_WINDOW_Z, ZPOS, 0, 9, 14},
+    {PINE_WINDOW_Z, ZNEG, 0, 9, 14},
+    {PINE_WINDOW_Z, YPOS, 0, 9, 15},
+    {PINE_WINDOW_Z, YNEG, 0, 9, 15},
+
+    {WISTERIA_WINDOW_Z, XPOS, 0, 10, 15},
+    {WISTERIA_WINDOW_Z, XNEG, 0, 10, 15},
+    {WISTERIA_WINDOW_Z, ZPOS, 0, 10, 14},
+    {WISTERIA_WINDOW_Z, ZNEG, 0, 10, 14},
+    {WISTERIA_WINDOW_Z, YPOS, 0, 10, 15},
+    {WISTERIA_WINDOW_Z, YNEG, 0, 10, 15},
+
+    {RED_PAINTED_WOOD, XPOS, 0, 4, 14},
+    {RED_PAINTED_WOOD, XNEG, 0, 4, 14},
+    {RED_PAINTED_WOOD, ZPOS, 0, 4, 14},
+    {RED_PAINTED_WOOD, ZNEG, 0, 4, 14},
+    {RED_PAINTED_WOOD, YPOS, 0, 4, 14},
+    {RED_PAINTED_WOOD, YNEG, 0, 4, 14},
+
+    {BLACK_PAINTED_WOOD, XPOS, 0, 4, 15},
+    {BLACK_PAINTED_WOOD, XNEG, 0, 4, 15},
+    {BLACK_PAINTED_WOOD, ZPOS, 0, 4, 15},
+    {BLACK_PAINTED_WOOD, ZNEG, 0, 4, 15},
+    {BLACK_PAINTED_WOOD, YPOS, 0, 4, 15},
+    {BLACK_PAINTED_WOOD, YNEG, 0, 4, 15},
+
+    {PLASTER, XPOS, 0, 11, 12},
+    {PLASTER, XNEG, 0, 11, 12},
+    {PLASTER, ZPOS, 0, 11, 12},
+    {PLASTER, ZNEG, 0, 11, 12},
+    {PLASTER, YPOS, 0, 11, 12},
+    {PLASTER, YNEG, 0, 11, 12},
+
+    {ROOF_TILES_1, XPOS, 0, 11, 15},
+    {ROOF_TILES_1, XNEG, 0, 11, 15},
+    {ROOF_TILES_1, ZPOS, 0, 11, 15},
+    {ROOF_TILES_1, ZNEG, 0, 11, 15},
+    {ROOF_TILES_1, YPOS, 0, 11, 15},
+    {ROOF_TILES_1, YNEG, 0, 11, 15},
+
+    {ROOF_TILES_2, XPOS, 0, 11, 15},
+    {ROOF_TILES_2, XNEG, 0, 11, 15},
+    {ROOF_TILES_2, ZPOS, 0, 11, 15},
+    {ROOF_TILES_2, ZNEG, 0, 11, 15},
+    {ROOF_TILES_2, YPOS, 0, 11, 15},
+    {ROOF_TILES_2, YNEG, 0, 11, 15},
+
+    {ROOF_TILES, XPOS, 0, 11, 15},
+    {ROOF_TILES, XNEG, 0, 11, 15},
+    {ROOF_TILES, ZPOS, 0, 11, 15},
+    {ROOF_TILES, ZNEG, 0, 11, 15},
+    {ROOF_TILES, YPOS, 0, 11, 15},
+    {ROOF_TILES, YNEG, 0, 11, 15},
+
+    {STRAW_1, XPOS, 0, 11, 13},
+    {STRAW_1, XNEG, 0, 11, 13},
+    {STRAW_1, ZPOS, 0, 11, 14},
+    {STRAW_1, ZNEG, 0, 11, 14},
+    {STRAW_1, YPOS, 0, 11, 13},
+    {STRAW_1, YNEG, 0, 11, 13},
+
+    {STRAW_2, XPOS, 0, 11, 13},
+    {STRAW_2, XNEG, 0, 11, 13},
+    {STRAW_2, ZPOS, 0, 11, 14},
+    {STRAW_2, ZNEG, 0, 11, 14},
+    {STRAW_2, YPOS, 0, 11, 13},
+    {STRAW_2, YNEG, 0, 11, 13},
+
+    {STRAW, XPOS, 0, 11, 13},
+    {STRAW, XNEG, 0, 11, 13},
+    {STRAW, ZPOS, 0, 11, 14},
+    {STRAW, ZNEG, 0, 11, 14},
+    {STRAW, YPOS, 0, 11, 13},
+    {STRAW, YNEG, 0, 11, 13},
+
+    {LILY_PAD, YPOS, 0, 0, 9},
+    {LILY_PAD, YNEG, 0, 0, 9},
+
+    {LOTUS_1, YPOS, 0, 0, 9},
+    {LOTUS_1, YNEG, 0, 0, 9},
+    {LOTUS_1, XPOS_ZPOS, 0, 1, 9},
+    {LOTUS_1, XPOS_ZNEG, 0, 1, 9},
+    {LOTUS_1, XNEG_ZPOS, 0, 1, 9},
+    {LOTUS_1, XNEG_ZNEG, 0, 1, 9},
+
+    {LOTUS_2, YPOS, 0, 0, 9},
+    {LOTUS_2, YNEG, 0, 0, 9},
+    {LOTUS_2, XPOS_ZPOS, 0, 1, 10},
+    {LOTUS_2, XPOS_ZNEG, 0, 1, 10},
+    {LOTUS_2, XNEG_ZPOS, 0, 1, 10},
+    {LOTUS_2, XNEG_ZNEG, 0, 1, 10},
+
+    {TILLED_DIRT, XPOS, 0, 0, 13},
+    {TILLED_DIRT, XNEG, 0, 0, 13},
+    {TILLED_DIRT, ZPOS, 0, 0, 13},
+    {TILLED_DIRT, ZNEG, 0, 0, 13},
+    {TILLED_DIRT, YPOS, 0, 0, 8},
+    {TILLED_DIRT, YNEG, 0, 0, 13},
+
+    {IRRIGATED_SOIL, XPOS, 0, 0, 13},
+    {IRRIGATED_SOIL, XNEG, 0, 0, 13},
+    {IRRIGATED_SOIL, ZPOS, 0, 0, 13},
+    {IRRIGATED_SOIL, ZNEG, 0, 0, 13},
+    {IRRIGATED_SOIL, YPOS, 0, 2, 8},
+    {IRRIGATED_SOIL, YNEG, 0, 0, 13},
+
+    {PATH, XPOS, 0, 0, 13},
+    {PATH, XNEG, 0, 0, 13},
+    {PATH, ZPOS, 0, 0, 13},
+    {PATH, ZNEG, 0, 0, 13},
+    {PATH, YPOS, 0, 1, 8},
+    {PATH, YNEG, 0, 0, 13},
+
+    {WHEAT_1, XPOS, 0, 0, 7},
+    {WHEAT_1, XNEG, 0, 0, 7},
+    {WHEAT_1, ZPOS, 0, 0, 7},
+    {WHEAT_1, ZNEG, 0, 0, 7},
+
+    {WHEAT_2, XPOS, 0, 1, 7},
+    {WHEAT_2, XNEG, 0, 1, 7},
+    {WHEAT_2, ZPOS, 0, 1, 7},
+    {WHEAT_2, ZNEG, 0, 1, 7},
+
+    {WHEAT_3, XPOS, 0, 2, 7},
+    {WHEAT_3, XNEG, 0, 2, 7},
+    {WHEAT_3, ZPOS, 0, 2, 7},
+    {WHEAT_3, ZNEG, 0, 2, 7},
+
+    {WHEAT_4, XPOS, 0, 3, 7},
+    {WHEAT_4, XNEG, 0, 3, 7},
+    {WHEAT_4, ZPOS, 0, 3, 7},
+    {WHEAT_4, ZNEG, 0, 3, 7},
+
+    {WHEAT_5, XPOS, 0, 4, 7},
+    {WHEAT_5, XNEG, 0, 4, 7},
+    {WHEAT_5, ZPOS, 0, 4, 7},
+    {WHEAT_5, ZNEG, 0, 4, 7},
+
+    {WHEAT_6, XPOS, 0, 5, 7},
+    {WHEAT_6, XNEG, 0, 5, 7},
+    {WHEAT_6, ZPOS, 0, 5, 7},
+    {WHEAT_6, ZNEG, 0, 5, 7},
+
+    {WHEAT_7, XPOS, 0, 6, 7},
+    {WHEAT_7, XNEG, 0, 6, 7},
+    {WHEAT_7, ZPOS, 0, 6, 7},
+    {WHEAT_7, ZNEG, 0, 6, 7},
+
+    {WHEAT_8, XPOS, 0, 7, 7},
+    {WHEAT_8, XNEG, 0, 7, 7},
+    {WHEAT_8, ZPOS, 0, 7, 7},
+    {WHEAT_8, ZNEG, 0, 7, 7},
+
+    {RICE_1, XPOS_ZPOS, 0, 0, 6},
+    {RICE_1, XPOS_ZNEG, 0, 0, 6},
+    {RICE_1, XNEG_ZPOS, 0, 0, 6},
+    {RICE_1, XNEG_ZNEG, 0, 0, 6},
+
+    {RICE_2, XPOS_ZPOS, 0, 1, 6},
+    {RICE_2, XPOS_ZNEG, 0, 1, 6},
+    {RICE_2, XNEG_ZPOS, 0, 1, 6},
+    {RICE_2, XNEG_ZNEG, 0, 1, 6},
+
+    {RICE_3, XPOS_ZPOS, 0, 2, 6},
+    {RICE_3, XPOS_ZNEG, 0, 2, 6},
+    {RICE_3, XNEG_ZPOS, 0, 2, 6},
+    {RICE_3, XNEG_ZNEG, 0, 2, 6},
+
+    {RICE_4, XPOS_ZPOS, 0, 3, 6},
+    {RICE_4, XPOS_ZNEG, 0, 3, 6},
+    {RICE_4, XNEG_ZPOS, 0, 3, 6},
+    {RICE_4, XNEG_ZNEG, 0, 3, 6},
+
+    {RICE_5, XPOS_ZPOS, 0, 4, 6},
+    {RICE_5, XPOS_ZNEG, 0, 4, 6},
+    {RICE_5, XNEG_ZPOS, 0, 4, 6},
+    {RICE_5, XNEG_ZNEG, 0, 4, 6},
+
+    {RICE_6, XPOS_ZPOS, 0, 5, 6},
+    {RICE_6, XPOS_ZNEG, 0, 5, 6},
+    {RICE_6, XNEG_ZPOS, 0, 5, 6},
+    {RICE_6, XNEG_ZNEG, 0, 5, 6},
+
+    {RICE_01, XPOS_ZPOS, 0, 6, 6},
+    {RICE_01, XPOS_ZNEG, 0, 6, 6},
+    {RICE_01, XNEG_ZPOS, 0, 6, 6},
+    {RICE_01, XNEG_ZNEG, 0, 6, 6},
+    {RICE_01, YPOS, 2, 13, 3},
+
+    {RICE_02, XPOS_ZPOS, 0, 7, 6},
+    {RICE_02, XPOS_ZNEG, 0, 7, 6},
+    {RICE_02, XNEG_ZPOS, 0, 7, 6},
+    {RICE_02, XNEG_ZNEG, 0, 7, 6},
+    {RICE_02, YPOS, 2, 13, 3},
+
+    {BAMBOO_1, XPOS, 0, 12, 13},
+    {BAMBOO_1, XNEG, 0, 12, 13},
+    {BAMBOO_1, ZPOS, 0, 12, 13},
+    {BAMBOO_1, ZNEG, 0, 12, 13},
+    {BAMBOO_1, YPOS, 0, 12, 12},
+    {BAMBOO_1, YNEG, 0, 12, 12},
+
+    {BAMBOO_2, XPOS, 0, 12, 13},
+    {BAMBOO_2, XNEG, 0, 12, 13},
+    {BAMBOO_2, ZPOS, 0, 12, 13},
+    {BAMBOO_2, ZNEG, 0, 12, 13},
+    {BAMBOO_2, YPOS, 0, 12, 12},
+    {BAMBOO_2, YNEG, 0, 12, 12},
+    {BAMBOO_2, XPOS_ZPOS, 0, 12, 14},
+    {BAMBOO_2, XPOS_ZNEG, 0, 12, 14},
+    {BAMBOO_2, XNEG_ZPOS, 0, 12, 14},
+    {BAMBOO_2, XNEG_ZNEG, 0, 12, 14},
+
+    {BAMBOO_3, XPOS, 0, 12, 13},
+    {BAMBOO_3, XNEG, 0, 12, 13},
+    {BAMBOO_3, ZPOS, 0, 12, 13},
+    {BAMBOO_3, ZNEG, 0, 12, 13},
+    {BAMBOO_3, YPOS, 0, 12, 12},
+    {BAMBOO_3, YNEG, 0, 12, 12},
+    {BAMBOO_3, XPOS_ZPOS, 0, 12, 15},
+    {BAMBOO_3, XPOS_ZNEG, 0, 12, 15},
+    {BAMBOO_3, XNEG_ZPOS, 0, 12, 15},
+    {BAMBOO_3, XNEG_ZNEG, 0, 12, 15},
+
+    {TATAMI_XL, XPOS, 0, 12, 11},
+    {TATAMI_XL, XNEG, 0, 12, 11},
+    {TATAMI_XL, ZPOS, 0, 12, 11},
+    {TATAMI_XL, ZNEG, 0, 11, 11},
+    {TATAMI_XL, YPOS, 0, 12, 11},
+    {TATAMI_XL, YNEG, 0, 12, 11},
+
+    {TATAMI_XR, XPOS, 0, 12, 11},
+    {TATAMI_XR, XNEG, 0, 12, 10},
+    {TATAMI_XR, ZPOS, 0, 11, 11},
+    {TATAMI_XR, ZNEG, 0, 12, 10},
+    {TATAMI_XR, YPOS, 0, 12, 10},
+    {TATAMI_XR, YNEG, 0, 12, 10},
+
+    {TATAMI_ZT, XPOS, 0, 11, 11},
+    {TATAMI_ZT, XNEG, 0, 11, 10},
+    {TATAMI_ZT, ZPOS, 0, 11, 10},
+    {TATAMI_ZT, ZNEG, 0, 11, 10},
+    {TATAMI_ZT, YPOS, 0, 11, 11},
+    {TATAMI_ZT, YNEG, 0, 11, 11},
+
+    {TATAMI_ZB, XPOS, 0, 11, 10},
+    {TATAMI_ZB, XNEG, 0, 11, 11},
+    {TATAMI_ZB, ZPOS, 0, 11, 10},
+    {TATAMI_ZB, ZNEG, 0, 11, 10},
+    {TATAMI_ZB, YPOS, 0, 11, 10},
+    {TATAMI_ZB, YNEG, 0, 11, 10},
+
+    {CLOTH_1, XPOS, 0, 12, 9},
+    {CLOTH_1, XNEG, 0, 12, 9},
+    {CLOTH_1, ZPOS, 0, 12, 9},
+    {CLOTH_1, ZNEG, 0, 12, 9},
+    {CLOTH_1, YPOS, 0, 12, 9},
+    {CLOTH_1, YNEG, 0, 12, 9},
+
+    {CLOTH_2, XPOS, 0, 12, 9},
+    {CLOTH_2, XNEG, 0, 12, 9},
+    {CLOTH_2, ZPOS, 0, 12, 9},
+    {CLOTH_2, ZNEG, 0, 12, 9},
+    {CLOTH_2, YPOS, 0, 12, 9},
+    {CLOTH_2, YNEG, 0, 12, 9},
+
+    {CLOTH_3, XPOS, 0, 12, 9},
+    {CLOTH_3, XNEG, 0, 12, 9},
+    {CLOTH_3, ZPOS, 0, 12, 9},
+    {CLOTH_3, ZNEG, 0, 12, 9},
+    {CLOTH_3, YPOS, 0, 12, 9},
+    {CLOTH_3, YNEG, 0, 12, 9},
+
+    {CLOTH_4, XPOS, 0, 12, 9},
+    {CLOTH_4, XNEG, 0, 12, 9},
+    {CLOTH_4, ZPOS, 0, 12, 9},
+    {CLOTH_4, ZNEG, 0, 12, 9},
+    {CLOTH_4, YPOS, 0, 12, 9},
+    {CLOTH_4, YNEG, 0, 12, 9},
+
+    {CLOTH_5, XPOS, 0, 12, 9},
+    {CLOTH_5, XNEG, 0, 12, 9},
+    {CLOTH_5, ZPOS, 0, 12, 9},
+    {CLOTH_5, ZNEG, 0, 12, 9},
+    {CLOTH_5, YPOS, 0, 12, 9},
+    {CLOTH_5, YNEG, 0, 12, 9},
+
+    {CLOTH_6, XPOS, 0, 12, 9},
+    {CLOTH_6, XNEG, 0, 12, 9},
+    {CLOTH_6, ZPOS, 0, 12, 9},
+    {CLOTH_6, ZNEG, 0, 12, 9},
+    {CLOTH_6, YPOS, 0, 12, 9},
+    {CLOTH_6, YNEG, 0, 12, 9},
+
+    {CLOTH_7, XPOS, 0, 12, 9},
+    {CLOTH_7, XNEG, 0, 12, 9},
+    {CLOTH_7, ZPOS, 0, 12, 9},
+    {CLOTH_7, ZNEG, 0, 12, 9},
+    {CLOTH_7, YPOS, 0, 12, 9},
+    {CLOTH_7, YNEG, 0, 12, 9},
+
+    {CLOTH_8, XPOS, 0, 12, 9},
+    {CLOTH_8, XNEG, 0, 12, 9},
+    {CLOTH_8, ZPOS, 0, 12, 9},
+    {CLOTH_8, ZNEG, 0, 12, 9},
+    {CLOTH_8, YPOS, 0, 12, 9},
+    {CLOTH_8, YNEG, 0, 12, 9},
+
+    {PAPER_LANTERN, XPOS, 4, 13, 15},
+    {PAPER_LANTERN, XNEG, 4, 13, 15},
+    {PAPER_LANTERN, ZPOS, 4, 13, 15},
+    {PAPER_LANTERN, ZNEG, 4, 13, 15},
+    {PAPER_LANTERN, YPOS, 4, 13, 14},
+    {PAPER_LANTERN, YNEG, 4, 13, 14},
+
+    {WOOD_LANTERN, XPOS, 4, 13, 13},
+    {WOOD_LANTERN, XNEG, 4, 13, 13},
+    {WOOD_LANTERN, ZPOS, 4, 13, 13},
+    {WOOD_LANTERN, ZNEG, 4, 13, 13},
+    {WOOD_LANTERN, YPOS, 4, 13, 12},
+    {WOOD_LANTERN, YNEG, 4, 13, 12},
+
+    {PAINTING_1_XP, XPOS, 0, 14, 14},
+    {PAINTING_1_XP, XNEG, 0, 13, 11},
+    {PAINTING_1_XP, ZPOS, 0, 13, 11},
+    {PAINTING_1_XP, ZNEG, 0, 13, 11},
+    {PAINTING_1_XP, YPOS, 0, 13, 11},
+    {PAINTING_1_XP, YNEG, 0, 13, 11},
+
+    {PAINTING_2_XP, XPOS, 0, 14, 12},
+    {PAINTING_2_XP, XNEG, 0, 13, 11},
+    {PAINTING_2_XP, ZPOS, 0, 13, 11},
+    {PAINTING_2_XP, ZNEG, 0, 13, 11},
+    {PAINTING_2_XP, YPOS, 0, 13, 11},
+    {PAINTING_2_XP, YNEG, 0, 13, 11},
+
+    {PAINTING_3_XP, XPOS, 0, 14, 10},
+    {PAINTING_3_XP, XNEG, 0, 13, 11},
+    {PAINTING_3_XP, ZPOS, 0, 13, 11},
+    {PAINTING_3_XP, ZNEG, 0, 13, 11},
+    {PAINTING_3_XP, YPOS, 0, 13, 11},
+    {PAINTING_3_XP, YNEG, 0, 13, 11},
+
+    {PAINTING_4_XP, XPOS, 0, 13, 7},
+    {PAINTING_4_XP, XNEG, 0, 13, 10},
+    {PAINTING_4_XP, ZPOS, 0, 13, 10},
+    {PAINTING_4_XP, ZNEG, 0, 13, 10},
+    {PAINTING_4_XP, YPOS, 0, 13, 10},
+    {PAINTING_4_XP, YNEG, 0, 13, 10},
+
+    {PAINTING_5_XP, XPOS, 0, 13, 4},
+    {PAINTING_5_XP, XNEG, 0, 13, 10},
+    {PAINTING_5_XP, ZPOS, 0, 13, 10},
+    {PAINTING_5_XP, ZNEG, 0, 13, 10},
+    {PAINTING_5_XP, YPOS, 0, 13, 10},
+    {PAINTING_5_XP, YNEG, 0, 13, 10},
+
+    {PAINTING_6L_XP, XPOS, 0, 9, 7},
+    {PAINTING_6L_XP, XNEG, 0, 13, 10},
+    {PAINTING_6L_XP, ZPOS, 0, 13, 10},
+    {PAINTING_6L_XP, ZNEG, 0, 13, 10},
+    {PAINTING_6L_XP, YPOS, 0, 13, 10},
+    {PAINTING_6L_XP, YNEG, 0, 13, 10},
+
+    {PAINTING_6R_XP, XPOS, 0, 11, 7},
+    {PAINTING_6R_XP, XNEG, 0, 13, 10},
+    {PAINTING_6R_XP, ZPOS, 0, 13, 10},
+    {PAINTING_6R_XP, ZNEG, 0, 13, 10},
+    {PAINTING_6R_XP, YPOS, 0, 13, 10},
+    {PAINTING_6R_XP, YNEG, 0, 13, 10},
+
+    {PAINTING_7T_XP, XPOS, 0, 11, 5},
+    {PAINTING_7T_XP, XNEG, 0, 13, 10},
+    {PAINTING_7T_XP, ZPOS, 0, 13, 10},
+    {PAINTING_7T_XP, ZNEG, 0, 13, 10},
+    {PAINTING_7T_XP, YPOS, 0, 13, 10},
+    {PAINTING_7T_XP, YNEG, 0, 13, 10},
+
+    {PAINTING_7B_XP, XPOS, 0, 11, 3},
+    {PAINTING_7B_XP, XNEG, 0, 13, 10},
+    {PAINTING_7B_XP, ZPOS, 0, 13, 10},
+    {PAINTING_7B_XP, ZNEG, 0, 13, 10},
+    {PAINTING_7B_XP, YPOS, 0, 13, 10},
+    {PAINTING_7B_XP, YNEG, 0, 13, 10},
+
+    {PAINTING_1_XN, XPOS, 0, 13, 11},
+    {PAINTING_1_XN, XNEG, 0, 14, 14},
+    {PAINTING_1_XN, ZPOS, 0, 13, 11},
+    {PAINTING_1_XN, ZNEG, 0, 13, 11},
+    {PAINTING_1_XN, YPOS, 0, 13, 11},
+    {PAINTING_1_XN, YNEG, 0, 13, 11},
+
+    {PAINTING_2_XN, XPOS, 0, 13, 11},
+    {PAINTING_2_XN, XNEG, 0, 14, 12},
+    {PAINTING_2_XN, ZPOS, 0, 13, 11},
+    {PAINTING_2_XN, ZNEG, 0, 13, 11},
+    {PAINTING_2_XN, YPOS, 0, 13, 11},
+    {PAINTING_2_XN, YNEG, 0, 13, 11},
+
+    {PAINTING_3_XN, XPOS, 0, 13, 11},
+    {PAINTING_3_XN, XNEG, 0, 14, 10},
+    {PAINTING_3_XN, ZPOS, 0, 13, 11},
+    {PAINTING_3_XN, ZNEG, 0, 13, 11},
+    {PAINTING_3_XN, YPOS, 0, 13, 11},
+    {PAINTING_3_XN, YNEG, 0, 13, 11},
+
+    {PAINTING_4_XN, XPOS, 0, 13, 10},
+    {PAINTING_4_XN, XNEG, 0, 13, 7},
+    {PAINTING_4_XN, ZPOS, 0, 13, 10},
+    {PAINTING_4_XN, ZNEG, 0, 13, 10},
+    {PAINTING_4_XN, YPOS, 0, 13, 10},
+    {PAINTING_4_XN, YNEG, 0, 13, 10},
+
+    {PAINTING_5_XN, XPOS, 0, 13, 10},
+    {PAINTING_5_XN, XNEG, 0, 13, 4},
+    {PAINTING_5_XN, ZPOS, 0, 13, 10},
+    {PAINTING_5_XN, ZNEG, 0, 13, 10},
+    {PAINTING_5_XN, YPOS, 0, 13, 10},
+    {PAINTING_5_XN, YNEG, 0, 13, 10},
+
+    {PAINTING_6L_XN, XPOS, 0, 13, 10},
+    {PAINTING_6L_XN, XNEG, 0, 9, 7},
+    {PAINTING_6L_XN, ZPOS, 0, 13, 10},
+    {PAINTING_6L_XN, ZNEG, 0, 13, 10},
+    {PAINTING_6L_XN, YPOS, 0, 13, 10},
+    {PAINTING_6L_XN, YNEG, 0, 13, 10},
+
+    {PAINTING_6R_XN, XPOS, 0, 13, 10},
+    {PAINTING_6R_XN, XNEG, 0, 11, 7},
+    {PAINTING_6R_XN, ZPOS, 0, 13, 10},
+    {PAINTING_6R_XN, ZNEG, 0, 13, 10},
+    {PAINTING_6R_XN, YPOS, 0, 13, 10},
+    {PAINTING_6R_XN, YNEG, 0, 13, 10},
+
+    {PAINTING_7T_XN, XPOS, 0, 13, 10},
+    {PAINTING_7T_XN, XNEG, 0, 11, 5},
+    {PAINTING_7T_XN, ZPOS, 0, 13, 10},
+    {PAINTING_7T_XN, ZNEG, 0, 13, 10},
+    {PAINTING_7T_XN, YPOS, 0, 13, 10},
+    {PAINTING_7T_XN, YNEG, 0, 13, 10},
+
+    {PAINTING_7B_XN, XPOS, 0, 13, 10},
+    {PAINTING_7B_XN, XNEG, 0, 11, 3},
+    {PAINTING_7B_XN, ZPOS, 0, 13, 10},
+    {PAINTING_7B_XN, ZNEG, 0, 13, 10},
+    {PAINTING_7B_XN, YPOS, 0, 13, 10},
+    {PAINTING_7B_XN, YNEG, 0, 13, 10},
+
+    {PAINTING_1_ZP, XPOS, 0, 13, 11},
+    {PAINTING_1_ZP, XNEG, 0, 13, 11},
+    {PAINTING_1_ZP, ZPOS, 0, 14, 14},
+    {PAINTING_1_ZP, ZNEG, 0, 13, 11},
+    {PAINTING_1_ZP, YPOS, 0, 13, 11},
+    {PAINTING_1_ZP, YNEG, 0, 13, 11},
+
+    {PAINTING_2_ZP, XPOS, 0, 13, 11},
+    {PAINTING_2_ZP, XNEG, 0, 13, 11},
+    {PAINTING_2_ZP, ZPOS, 0, 14, 12},
+    {PAINTING_2_ZP, ZNEG, 0, 13, 11},
+    {PAINTING_2_ZP, YPOS, 0, 13, 11},
+    {PAINTING_2_ZP, YNEG, 0, 13, 11},
+
+    {PAINTING_3_ZP, XPOS, 0, 13, 11},
+    {PAINTING_3_ZP, XNEG, 0, 13, 11},
+    {PAINTING_3_ZP, ZPOS, 0, 14, 10},
+    {PAINTING_3_ZP, ZNEG, 0, 13, 11},
+    {PAINTING_3_ZP, YPOS, 0, 13, 11},
+    {PAINTING_3_ZP, YNEG, 0, 13, 11},
+
+    {PAINTING_4_ZP, XPOS, 0, 13, 10},
+    {PAINTING_4_ZP, XNEG, 0, 13, 10},
+    {PAINTING_4_ZP, ZPOS, 0, 13, 7},
+    {PAINTING_4_ZP, ZNEG, 0, 13, 10},
+    {PAINTING_4_ZP, YPOS, 0, 13, 10},
+    {PAINTING_4_ZP, YNEG, 0, 13, 10},
+
+    {PAINTING_5_ZP, XPOS, 0, 13, 10},
+    {PAINTING_5_ZP, XNEG, 0, 13, 10},
+    {PAINTING_5_ZP, ZPOS, 0, 13, 4},
+    {PAINTING_5_ZP, ZNEG, 0, 13, 10},
+    {PAINTING_5_ZP, YPOS, 0, 13, 10},
+    {PAINTING_5_ZP, YNEG, 0, 13, 10},
+
+    {PAINTING_6L_ZP, XPOS, 0, 13, 10},
+    {PAINTING_6L_ZP, XNEG, 0, 13, 10},
+    {PAINTING_6L_ZP, ZPOS, 0, 9, 7},
+    {PAINTING_6L_ZP, ZNEG, 0, 13, 10},
+    {PAINTING_6L_ZP, YPOS, 0, 13, 10},
+    {PAINTING_6L_ZP, YNEG, 0, 13, 10},
+
+    {PAINTING_6R_ZP, XPOS, 0, 13, 10},
+    {PAINTING_6R_ZP, XNEG, 0, 13, 10},
+    {PAINTING_6R_ZP, ZPOS, 0, 11, 7},
+    {PAINTING_6R_ZP, ZNEG, 0, 13, 10},
+    {PAINTING_6R_ZP, YPOS, 0, 13, 10},
+    {PAINTING_6R_ZP, YNEG, 0, 13, 10},
+
+    {PAINTING_7T_ZP, XPOS, 0, 13, 10},
+    {PAINTING_7T_ZP, XNEG, 0, 13, 10},
+    {PAINTING_7T_ZP, ZPOS, 0, 11, 5},
+    {PAINTING_7T_ZP, ZNEG, 0, 13, 10},
+    {PAINTING_7T_ZP, YPOS, 0, 13, 10},
+    {PAINTING_7T_ZP, YNEG, 0, 13, 10},
+
+    {PAINTING_7B_ZP, XPOS, 0, 13, 10},
+    {PAINTING_7B_ZP, XNEG, 0, 13, 10},
+    {PAINTING_7B_ZP, ZPOS, 0, 11, 3},
+    {PAINTING_7B_ZP, ZNEG, 0, 13, 10},
+    {PAINTING_7B_ZP, YPOS, 0, 13, 10},
+    {PAINTING_7B_ZP, YNEG, 0, 13, 10},
+
+    {PAINTING_1_ZN, XPOS, 0, 13, 11},
+    {PAINTING_1_ZN, XNEG, 0, 13, 11},
+    {PAINTING_1_ZN, ZPOS, 0, 13, 11},
+    {PAINTING_1_ZN, ZNEG, 0, 14, 14},
+    {PAINTING_1_ZN, YPOS, 0, 13, 11},
+    {PAINTING_1_ZN, YNEG, 0, 13, 11},
+
+    {PAINTING_2_ZN, XPOS, 0, 13, 11},
+    {PAINTING_2_ZN, XNEG, 0, 13, 11},
+    {PAINTING_2_ZN, ZPOS, 0, 13, 11},
+    {PAINTING_2_ZN, ZNEG, 0, 14, 12},
+    {PAINTING_2_ZN, YPOS, 0, 13, 11},
+    {PAINTING_2_ZN, YNEG, 0, 13, 11},
+
+    {PAINTING_3_ZN, XPOS, 0, 13, 11},
+    {PAINTING_3_ZN, XNEG, 0, 13, 11},
+    {PAINTING_3_ZN, ZPOS, 0, 13, 11},
+    {PAINTING_3_ZN, ZNEG, 0, 14, 10},
+    {PAINTING_3_ZN, YPOS, 0, 13, 11},
+    {PAINTING_3_ZN, YNEG, 0, 13, 11},
+
+    {PAINTING_4_ZN, XPOS, 0, 13, 10},
+    {PAINTING_4_ZN, XNEG, 0, 13, 10},
+    {PAINTING_4_ZN, ZPOS, 0, 13, 10},
+    {PAINTING_4_ZN, ZNEG, 0, 13, 7},
+    {PAINTING_4_ZN, YPOS, 0, 13, 10},
+    {PAINTING_4_ZN, YNEG, 0, 13, 10},
+
+    {PAINTING_5_ZN, XPOS, 0, 13, 10},
+    {PAINTING_5_ZN, XNEG, 0, 13, 10},
+    {PAINTING_5_ZN, ZPOS, 0, 13, 10},
+    {PAINTING_5_ZN, ZNEG, 0, 13, 4},
+    {PAINTING_5_ZN, YPOS, 0, 13, 10},
+    {PAINTING_5_ZN, YNEG, 0, 13, 10},
+
+    {PAINTING_6L_ZN, XPOS, 0, 13, 10},
+    {PAINTING_6L_ZN, XNEG, 0, 13, 10},
+    {PAINTING_6L_ZN, ZPOS, 0, 13, 10},
+    {PAINTING_6L_ZN, ZNEG, 0, 9, 7},
+    {PAINTING_6L_ZN, YPOS, 0, 13, 10},
+    {PAINTING_6L_ZN, YNEG, 0, 13, 10},
+
+    {PAINTING_6R_ZN, XPOS, 0, 13, 10},
+    {PAINTING_6R_ZN, XNEG, 0, 13, 10},
+    {PAINTING_6R_ZN, ZPOS, 0, 13, 10},
+    {PAINTING_6R_ZN, ZNEG, 0, 11, 7},
+    {PAINTING_6R_ZN, YPOS, 0, 13, 10},
+    {PAINTING_6R_ZN, YNEG, 0, 13, 10},
+
+    {PAINTING_7T_ZN, XPOS, 0, 13, 10},
+    {PAINTING_7T_ZN, XNEG, 0, 13, 10},
+    {PAINTING_7T_ZN, ZPOS, 0, 13, 10},
+    {PAINTING_7T_ZN, ZNEG, 0, 11, 5},
+    {PAINTING_7T_ZN, YPOS, 0, 13, 10},
+    {PAINTING_7T_ZN, YNEG, 0, 13, 10},
+
+    {PAINTING_7B_ZN, XPOS, 0, 13, 10},
+    {PAINTING_7B_ZN, XNEG, 0, 13, 10},
+    {PAINTING_7B_ZN, ZPOS, 0, 13, 10},
+    {PAINTING_7B_ZN, ZNEG, 0, 11, 3},
+    {PAINTING_7B_ZN, YPOS, 0, 13, 10},
+    {PAINTING_7B_ZN, YNEG, 0, 13, 10},
+
+    {BONSAI_TREE, XPOS, 0, 0, 1},
+    {BONSAI_TREE, XNEG, 0, 0, 1},
+    {BONSAI_TREE, ZPOS, 0, 0, 1},
+    {BONSAI_TREE, ZNEG, 0, 0, 1},
+    {BONSAI_TREE, YPOS, 0, 0, 2},
+    {BONSAI_TREE, YNEG, 0, 0, 3},
+    {BONSAI_TREE, XPOS_ZPOS, 0, 0, 5},
+    {BONSAI_TREE, XPOS_ZNEG, 0, 0, 5},
+    {BONSAI_TREE, XNEG_ZPOS, 0, 0, 5},
+    {BONSAI_TREE, XNEG_ZNEG, 0, 0, 5},
+
+    {MAGNOLIA_IKEBANA, XPOS, 0, 0, 1},
+    {MAGNOLIA_IKEBANA, XNEG, 0, 0, 1},
+    {MAGNOLIA_IKEBANA, ZPOS, 0, 0, 1},
+    {MAGNOLIA_IKEBANA, ZNEG, 0, 0, 1},
+    {MAGNOLIA_IKEBANA, YPOS, 0, 0, 2},
+    {MAGNOLIA_IKEBANA, YNEG, 0, 0, 3},
+    {MAGNOLIA_IKEBANA, XPOS_ZPOS, 0, 0, 4},
+    {MAGNOLIA_IKEBANA, XPOS_ZNEG, 0, 0, 4},
+    {MAGNOLIA_IKEBANA, XNEG_ZPOS, 0, 0, 4},
+    {MAGNOLIA_IKEBANA, XNEG_ZNEG, 0, 0, 4},
+
+    {LOTUS_IKEBANA, XPOS, 0, 0, 1},
+    {LOTUS_IKEBANA, XNEG, 0, 0, 1},
+    {LOTUS_IKEBANA, ZPOS, 0, 0, 1},
+    {LOTUS_IKEBANA, ZNEG, 0, 0, 1},
+    {LOTUS_IKEBANA, YPOS, 0, 0, 2},
+    {LOTUS_IKEBANA, YNEG, 0, 0, 3},
+    {LOTUS_IKEBANA, XPOS_ZPOS, 0, 3, 5},
+    {LOTUS_IKEBANA, XPOS_ZNEG, 0, 3, 5},
+    {LOTUS_IKEBANA, XNEG_ZPOS, 0, 3, 5},
+    {LOTUS_IKEBANA, XNEG_ZNEG, 0, 3, 5},
+
+    {GREEN_HYDRANGEA_IKEBANA, XPOS, 0, 1, 1},
+    {GREEN_HYDRANGEA_IKEBANA, XNEG, 0, 1, 1},
+    {GREEN_HYDRANGEA_IKEBANA, ZPOS, 0, 1, 1},
+    {GREEN_HYDRANGEA_IKEBANA, ZNEG, 0, 1, 1},
+    {GREEN_HYDRANGEA_IKEBANA, YPOS, 0, 1, 2},
+    {GREEN_HYDRANGEA_IKEBANA, YNEG, 0, 1, 3},
+    {GREEN_HYDRANGEA_IKEBANA, XPOS_ZPOS, 0, 4, 4},
+    {GREEN_HYDRANGEA_IKEBANA, XPOS_ZNEG, 0, 4, 4},
+    {GREEN_HYDRANGEA_IKEBANA, XNEG_ZPOS, 0, 4, 4},
+    {GREEN_HYDRANGEA_IKEBANA, XNEG_ZNEG, 0, 4, 4},
+
+    {CHRYSANTHEMUM_IKEBANA, XPOS, 0, 1, 1},
+    {CHRYSANTHEMUM_IKEBANA, XNEG, 0, 1, 1},
+    {CHRYSANTHEMUM_IKEBANA, ZPOS, 0, 1, 1},
+    {CHRYSANTHEMUM_IKEBANA, ZNEG, 0, 1, 1},
+    {CHRYSANTHEMUM_IKEBANA, YPOS, 0, 1, 2},
+    {CHRYSANTHEMUM_IKEBANA, YNEG, 0, 1, 3},
+    {CHRYSANTHEMUM_IKEBANA, XPOS_ZPOS, 0, 5, 5},
+    {CHRYSANTHEMUM_IKEBANA, XPOS_ZNEG, 0, 5, 5},
+    {CHRYSANTHEMUM_IKEBANA, XNEG_ZPOS, 0, 5, 5},
+    {CHRYSANTHEMUM_IKEBANA, XNEG_ZNEG, 0, 5, 5},
+
+    {CHERRY_BLOSSOM_IKEBANA, XPOS, 0, 2, 1},
+    {CHERRY_BLOSSOM_IKEBANA, XNEG, 0, 2, 1},
+    {CHERRY_BLOSSOM_IKEBANA, ZPOS, 0, 2, 1},
+    {CHERRY_BLOSSOM_IKEBANA, ZNEG, 0, 2, 1},
+    {CHERRY_BLOSSOM_IKEBANA, YPOS, 0, 2, 2},
+    {CHERRY_BLOSSOM_IKEBANA, YNEG, 0, 2, 3},
+    {CHERRY_BLOSSOM_IKEBANA, XPOS_ZPOS, 0, 1, 5},
+    {CHERRY_BLOSSOM_IKEBANA, XPOS_ZNEG, 0, 1, 5},
+    {CHERRY_BLOSSOM_IKEBANA, XNEG_ZPOS, 0, 1, 5},
+    {CHERRY_BLOSSOM_IKEBANA, XNEG_ZNEG, 0, 1, 5},
+
+    {BLUE_HYDRANGEA_IKEBANA, XPOS, 0, 2, 1},
+    {BLUE_HYDRANGEA_IKEBANA, XNEG, 0, 2, 1},
+    {BLUE_HYDRANGEA_IKEBANA, ZPOS, 0, 2, 1},
+    {BLUE_HYDRANGEA_IKEBANA, ZNEG, 0, 2, 1},
+    {BLUE_HYDRANGEA_IKEBANA, YPOS, 0, 2, 2},
+    {BLUE_HYDRANGEA_IKEBANA, YNEG, 0, 2, 3},
+    {BLUE_HYDRANGEA_IKEBANA, XPOS_ZPOS, 0, 3, 4},
+    {BLUE_HYDRANGEA_IKEBANA, XPOS_ZNEG, 0, 3, 4},
+    {BLUE_HYDRANGEA_IKEBANA, XNEG_ZPOS, 0, 3, 4},
+    {BLUE_HYDRANGEA_IKEBANA, XNEG_ZNEG, 0, 3, 4},
+
+    {TULIP_IKEBANA, XPOS, 0, 2, 1},
+    {TULIP_IKEBANA, XNEG, 0, 2, 1},
+    {TULIP_IKEBANA, ZPOS, 0, 2, 1},
+    {TULIP_IKEBANA, ZNEG, 0, 2, 1},
+    {TULIP_IKEBANA, YPOS, 0, 2, 2},
+    {TULIP_IKEBANA, YNEG, 0, 2, 3},
+    {TULIP_IKEBANA, XPOS_ZPOS, 0, 6, 5},
+    {TULIP_IKEBANA, XPOS_ZNEG, 0, 6, 5},
+    {TULIP_IKEBANA, XNEG_ZPOS, 0, 6, 5},
+    {TULIP_IKEBANA, XNEG_ZNEG, 0, 6, 5},
+
+    {DAFFODIL_IKEBANA, XPOS, 0, 2, 1},
+    {DAFFODIL_IKEBANA, XNEG, 0, 2, 1},
+    {DAFFODIL_IKEBANA, ZPOS, 0, 2, 1},
+    {DAFFODIL_IKEBANA, ZNEG, 0, 2, 1},
+    {DAFFODIL_IKEBANA, YPOS, 0, 2, 2},
+    {DAFFODIL_IKEBANA, YNEG, 0, 2, 3},
+    {DAFFODIL_IKEBANA, XPOS_ZPOS, 0, 6, 4},
+    {DAFFODIL_IKEBANA, XPOS_ZNEG, 0, 6, 4},
+    {DAFFODIL_IKEBANA, XNEG_ZPOS, 0, 6, 4},
+    {DAFFODIL_IKEBANA, XNEG_ZNEG, 0, 6, 4},
+
+    {PLUM_BLOSSOM_IKEBANA, XPOS, 0, 3, 1},
+    {PLUM_BLOSSOM_IKEBANA, XNEG, 0, 3, 1},
+    {PLUM_BLOSSOM_IKEBANA, ZPOS, 0, 3, 1},
+    {PLUM_BLOSSOM_IKEBANA, ZNEG, 0, 3, 1},
+    {PLUM_BLOSSOM_IKEBANA, YPOS, 0, 3, 2},
+    {PLUM_BLOSSOM_IKEBANA, YNEG, 0, 3, 3},
+    {PLUM_BLOSSOM_IKEBANA, XPOS_ZPOS, 0, 2, 5},
+    {PLUM_BLOSSOM_IKEBANA, XPOS_ZNEG, 0, 2, 5},
+    {PLUM_BLOSSOM_IKEBANA, XNEG_ZPOS, 0, 2, 5},
+    {PLUM_BLOSSOM_IKEBANA, XNEG_ZNEG, 0, 2, 5},
+
+    {MAGNOLIA_BUD_IKEBANA, XPOS, 0, 3, 1},
+    {MAGNOLIA_BUD_IKEBANA, XNEG, 0, 3, 1},
+    {MAGNOLIA_BUD_IKEBANA, ZPOS, 0, 3, 1},
+    {MAGNOLIA_BUD_IKEBANA, ZNEG, 0, 3, 1},
+    {MAGNOLIA_BUD_IKEBANA, YPOS, 0, 3, 2},
+    {MAGNOLIA_BUD_IKEBANA, YNEG, 0, 3, 3},
+    {MAGNOLIA_BUD_IKEBANA, XPOS_ZPOS, 0, 1, 4},
+    {MAGNOLIA_BUD_IKEBANA, XPOS_ZNEG, 0, 1, 4},
+    {MAGNOLIA_BUD_IKEBANA, XNEG_ZPOS, 0, 1, 4},
+    {MAGNOLIA_BUD_IKEBANA, XNEG_ZNEG, 0, 1, 4},
+
+    {POPPY_IKEBANA, XPOS, 0, 3, 1},
+    {POPPY_IKEBANA, XNEG, 0, 3, 1},
+    {POPPY_IKEBANA, ZPOS, 0, 3, 1},
+    {POPPY_IKEBANA, ZNEG, 0, 3, 1},
+    {POPPY_IKEBANA, YPOS, 0, 3, 2},
+    {POPPY_IKEBANA, YNEG, 0, 3, 3},
+    {POPPY_IKEBANA, XPOS_ZPOS, 0, 2, 4},
+    {POPPY_IKEBANA, XPOS_ZNEG, 0, 2, 4},
+    {POPPY_IKEBANA, XNEG_ZPOS, 0, 2, 4},
+    {POPPY_IKEBANA, XNEG_ZNEG, 0, 2, 4},
+
+    {MAPLE_IKEBANA, XPOS, 0, 3, 1},
+    {MAPLE_IKEBANA, XNEG, 0, 3, 1},
+    {MAPLE_IKEBANA, ZPOS, 0, 3, 1},
+    {MAPLE_IKEBANA, ZNEG, 0, 3, 1},
+    {MAPLE_IKEBANA, YPOS, 0, 3, 2},
+    {MAPLE_IKEBANA, YNEG, 0, 3, 3},
+    {MAPLE_IKEBANA, XPOS_ZPOS, 0, 4, 5},
+    {MAPLE_IKEBANA, XPOS_ZNEG, 0, 4, 5},
+    {MAPLE_IKEBANA, XNEG_ZPOS, 0, 4, 5},
+    {MAPLE_IKEBANA, XNEG_ZNEG, 0, 4, 5},
+
+    {ONCIDIUM_IKEBANA, XPOS, 0, 3, 1},
+    {ONCIDIUM_IKEBANA, XNEG, 0, 3, 1},
+    {ONCIDIUM_IKEBANA, ZPOS, 0, 3, 1},
+    {ONCIDIUM_IKEBANA, ZNEG, 0, 3, 1},
+    {ONCIDIUM_IKEBANA, YPOS, 0, 3, 2},
+    {ONCIDIUM_IKEBANA, YNEG, 0, 3, 3},
+    {ONCIDIUM_IKEBANA, XPOS_ZPOS, 0, 5, 4},
+    {ONCIDIUM_IKEBANA, XPOS_ZNEG, 0, 5, 4},
+    {ONCIDIUM_IKEBANA, XNEG_ZPOS, 0, 5, 4},
+    {ONCIDIUM_IKEBANA, XNEG_ZNEG, 0, 5, 4},
+
+    {GHOST_LILY, XPOS_ZPOS, 4, 2, 9},
+    {GHOST_LILY, XPOS_ZNEG, 4, 2, 9},
+    {GHOST_LILY, XNEG_ZPOS, 4, 2, 9},
+    {GHOST_LILY, XNEG_ZNEG, 4, 2, 9},
+
+    {GHOST_WEED, XPOS_ZPOS, 4, 2, 10},
+    {GHOST_WEED, XPOS_ZNEG, 4, 2, 10},
+    {GHOST_WEED, XNEG_ZPOS, 4, 2, 10},
+    {GHOST_WEED, XNEG_ZNEG, 4, 2, 10},
+
+    {CORAL_1, XPOS_ZPOS, 0, 3, 9},
+    {CORAL_1, XPOS_ZNEG, 0, 3, 9},
+    {CORAL_1, XNEG_ZPOS, 0, 3, 9},
+    {CORAL_1, XNEG_ZNEG, 0, 3, 9},
+
+    {CORAL_2, XPOS_ZPOS, 0, 3, 10},
+    {CORAL_2, XPOS_ZNEG, 0, 3, 10},
+    {CORAL_2, XNEG_ZPOS, 0, 3, 10},
+    {CORAL_2, XNEG_ZNEG, 0, 3, 10},
+
+    {CORAL_3, XPOS_ZPOS, 0, 3, 11},
+    {CORAL_3, XPOS_ZNEG, 0, 3, 11},
+    {CORAL_3, XNEG_ZPOS, 0, 3, 11},
+    {CORAL_3, XNEG_ZNEG, 0, 3, 11},
+
+    {CORAL_4, XPOS_ZPOS, 0, 3, 12},
+    {CORAL_4, XPOS_ZNEG, 0, 3, 12},
+    {CORAL_4, XNEG_ZPOS, 0, 3, 12},
+    {CORAL_4, XNEG_ZNEG, 0, 3, 12},
+
+    {KELP_1, XPOS_ZPOS, 0, 4, 9},
+    {KELP_1, XPOS_ZNEG, 0, 4, 9},
+    {KELP_1, XNEG_ZPOS, 0, 4, 9},
+    {KELP_1, XNEG_ZNEG, 0, 4, 9},
+
+    {KELP_2, XPOS_ZPOS, 0, 4, 10},
+    {KELP_2, XPOS_ZNEG, 0, 4, 10},
+    {KELP_2, XNEG_ZPOS, 0, 4, 10},
+    {KELP_2, XNEG_ZNEG, 0, 4, 10},
+
+    {SEA_GRASS, XPOS, 0, 5, 9},
+    {SEA_GRASS, XNEG, 0, 5, 9},
+    {SEA_GRASS, ZPOS, 0, 5, 9},
+    {SEA_GRASS, ZNEG, 0, 5, 9}};
+
+// paintings drawn at 32x32 (double) res, on the face they hang from
+constexpr Face doubleRes[] = {{PAINTING_1_XP, XPOS},
+                              {PAINTING_2_XP, XPOS},
+                              {PAINTING_3_XP, XPOS},
+                              {PAINTING_6L_XP, XPOS},
+                              {PAINTING_6R_XP, XPOS},
+                              {PAINTING_7T_XP, XPOS},
+                              {PAINTING_7B_XP, XPOS},
+                              {PAINTING_1_XN, XNEG},
+                              {PAINTING_2_XN, XNEG},
+                              {PAINTING_3_XN, XNEG},
+                              {PAINTING_6L_XN, XNEG},
+                              {PAINTING_6R_XN, XNEG},
+                              {PAINTING_7T_XN, XNEG},
+                              {PAINTING_7B_XN, XNEG},
+                              {PAINTING_1_ZP, ZPOS},
+                              {PAINTING_2_ZP, ZPOS},
+                              {PAINTING_3_ZP, ZPOS},
+                              {PAINTING_6L_ZP, ZPOS},
+                              {PAINTING_6R_ZP, ZPOS},
+                              {PAINTING_7T_ZP, ZPOS},
+                              {PAINTING_7B_ZP, ZPOS},
+                              {PAINTING_1_ZN, ZNEG},
+                              {PAINTING_2_ZN, ZNEG},
+                              {PAINTING_3_ZN, ZNEG},
+                              {PAINTING_6L_ZN, ZNEG},
+                              {PAINTING_6R_ZN, ZNEG},
+                              {PAINTING_7T_ZN, ZNEG},
+                              {PAINTING_7B_ZN, ZNEG}};
+
+// paintings drawn at 48x48 (triple) res
+constexpr Face tripleRes[] = {{PAINTING_4_XP, XPOS},
+                              {PAINTING_5_XP, XPOS},
+                              {PAINTING_4_XN, XNEG},
+                              {PAINTING_5_XN, XNEG},
+                              {PAINTING_4_ZP, ZPOS},
+                              {PAINTING_5_ZP, ZPOS},
+                              {PAINTING_4_ZN, ZNEG},
+                              {PAINTING_5_ZN, ZNEG}};
+
+// logs lying along x have their bark rotated on the side faces,
+// logs lying along z on every face
+constexpr BlockType woodX[]
+    = {CEDAR_WOOD_X, TEAK_WOOD_X, CHERRY_WOOD_X, MAPLE_WOOD_X, PINE_WOOD_X, WISTERIA_WOOD_X};
+constexpr BlockType woodZ[]
+    = {CEDAR_WOOD_Z, TEAK_WOOD_Z, CHERRY_WOOD_Z, MAPLE_WOOD_Z, PINE_WOOD_Z, WISTERIA_WOOD_Z};
+
+using Table = std::array<std::array<FaceUV, NUM_DIRECTIONS>, 256>;
+
+constexpr Table build()
+{
+    Table t{};
+
+    for (const Entry& e : entries) {
+        t[e.bt][e.dir] = FaceUV{e.texFlag, e.u, e.v, VALID};
+    }
+
+    for (const Face& f : doubleRes) {
+        t[f.bt][f.dir].flags |= DOUBLE_RES;
+        if (f.dir == XNEG || f.dir == ZNEG) {
+            t[f.bt][f.dir].flags |= MIRROR_U;
+        }
+    }
+
+    for (const Face& f : tripleRes) {
+        t[f.bt][f.dir].flags |= TRIPLE_RES;
+    }
+
+    for (BlockType b : woodX) {
+        for (int d = 0; d < NUM_DIRECTIONS; d++) {
+            if (d != YPOS && d != YNEG) {
+                t[b][d].flags |= SWAP_UV;
+            }
+        }
+    }
+
+    for (BlockType b : woodZ) {
+        for (int d = 0; d < NUM_DIRECTIONS; d++) {
+            t[b][d].flags |= SWAP_UV;
+        }
+    }
+
+    return t;
+}
+
+inline constexpr Table table = build();
+
+inline constexpr const FaceUV& lookup(BlockType b, Direction d)
+{
+    return table[b][d];
+}
+
+}  // namespace BlockUVTable
@@ -0,0 +1,201 @@
+#include "cavefield.h"
+#include "biome.h"
+
+static constexpr int LAYER = 16 * 16;
+
+static ColumnNoise latticeKind(CaveQuality quality)
+{
+    return quality == CaveQuality::MEDIUM ? ColumnNoise::CAVES_MEDIUM : ColumnNoise::CAVES_COARSE;
+}
+
+// Lattice points along each axis of a Chunk at a step: chunk origins are multiples of 16, which
+// the steps divide, so the lattice points' local coordinates are multiples of the step: 0 up to
+// 16 across, and 0 up to the first one at or past MAX_Y
+static glm::ivec3 latticeCount(glm::ivec3 step)
+{
+    return glm::ivec3(16 / step.x + 1,
+                      (CaveField::MAX_Y + step.y - 1) / step.y + 1,
+                      16 / step.z + 1);
+}
+
+// The lattice column at world (worldX, worldZ), from the cache if it's there
+static void latticeColumn(CaveQuality quality,
+                          int worldX,
+                          int worldZ,
+                          uint32_t seed,
+                          ColumnNoiseCache* cache,
+                          std::vector<float>& column)
+{
+    ColumnNoise kind = latticeKind(quality);
+    glm::ivec3 step = CaveField::latticeStep(quality);
+    int countY = latticeCount(step).y;
+    if (!cache || !cache->find(kind, seed, worldX, worldZ, column)) {
+        column.resize(countY);
+        for (int j = 0; j < countY; j++) {
+            column[j] = CaveField::sample(worldX, j * step.y, worldZ, seed);
+        }
+        if (cache) {
+            cache->insert(kind, seed, worldX, worldZ, column);
+        }
+    }
+}
+
+// Trilinear interpolation between the eight lattice points around a block. below and above point
+// at the first of the four points in the layers below and above it, the next along z rowStride
+// further on, and fx, fy and fz are how far the block is past them.
+static float interpolate(const float* below,
+                         const float* above,
+                         int rowStride,
+                         float fx,
+                         float fy,
+                         float fz)
+{
+    // Along x on the four lattice lines around the block, then z, then y
+    float b0 = glm::mix(below[0], below[1], fx);
+    float b1 = glm::mix(below[rowStride], below[rowStride + 1], fx);
+    float a0 = glm::mix(above[0], above[1], fx);
+    float a1 = glm::mix(above[rowStride], above[rowStride + 1], fx);
+    return glm::mix(glm::mix(b0, b1, fz), glm::mix(a0, a1, fz), fy);
+}
+
+CaveField::CaveField(int worldXOrigin,
+                     int worldZOrigin,
+                     uint32_t seed,
+                     CaveQuality quality,
+                     ColumnNoiseCache* cache)
+    : m_density(LAYER * (MAX_Y - MIN_Y + 1))
+{
+    if (quality != CaveQuality::FULL) {
+        fillFromLattice(worldXOrigin, worldZOrigin, seed, quality, cache);
+        return;
+    }
+
+    for (int y = MIN_Y; y <= MAX_Y; y++) {
+        for (int z = 0; z < 16; z++) {
+            for (int x = 0; x < 16; x++) {
+                m_density[x + 16 * z + LAYER * (y - MIN_Y)]
+                    = sample(worldXOrigin + x, y, worldZOrigin + z, seed);
+            }
+        }
+    }
+}
+
+float CaveField::densityAt(int x, int y, int z) const
+{
+    return m_density[x + 16 * z + LAYER * (y - MIN_Y)];
+}
+
+bool CaveField::isCave(int x, int y, int z) const
+{
+    return densityAt(x, y, z) < THRESHOLD;
+}
+
+float CaveField::sample(int worldX, int y, int worldZ, uint32_t seed)
+{
+    float cavePerlin3D = Biome::perlin3D(glm::vec3(worldX, y, worldZ) * 0.06f, seed);
+    float cavePerlin3DTwo = Biome::perlin3D(
+        glm::vec3(worldX, y, glm::mix(worldX, worldZ, 0.35f)) * 0.06f,
+        seed);
+    return cavePerlin3D + cavePerlin3DTwo;
+}
+
+glm::ivec3 CaveField::latticeStep(CaveQuality quality)
+{
+    switch (quality) {
+    case CaveQuality::MEDIUM:
+        return glm::ivec3(2, 4, 2);
+    case CaveQuality::COARSE:
+        return glm::ivec3(4, 8, 4);
+    default:
+        return glm::ivec3(1);
+    }
+}
+
+void CaveField::column(int worldX,
+                       int worldZ,
+                       uint32_t seed,
+                       CaveQuality quality,
+                       ColumnNoiseCache* cache,
+                       std::vector<float>& out)
+{
+    out.resize(MAX_Y - MIN_Y + 1);
+    if (quality == CaveQuality::FULL) {
+        for (int y = MIN_Y; y <= MAX_Y; y++) {
+            out[y - MIN_Y] = sample(worldX, y, worldZ, seed);
+        }
+        return;
+    }
+
+    // The four lattice columns around this one, as a lattice two points wide along x and z
+    glm::ivec3 step = latticeStep(quality);
+    int countY = latticeCount(step).y;
+    int x = worldX & 15;
+    int z = worldZ & 15;
+    int i = x / step.x;
+    int k = z / step.z;
+    float fx = float(x - i * step.x) / step.x;
+    float fz = float(z - k * step.z) / step.z;
+    std::vector<float> lattice(2 * 2 * countY);
+    std::vector<float> column;
+    for (int dk = 0; dk < 2; dk++) {
+        for (int di = 0; di < 2; di++) {
+            latticeColumn(quality,
+                          worldX - x + (i + di) * step.x,
+                          worldZ - z + (k + dk) * step.z,
+                          seed,
+                          cache,
+                          column);
+            for (int j = 0; j < countY; j++) {
+                lattice[di + 2 * (dk + 2 * j)] = column[j];
+            }
+        }
+    }
+
+    for (int y = MIN_Y; y <= MAX_Y; y++) {
+        int j = y / step.y;
+        float fy = float(y - j * step.y) / step.y;
+        out[y - MIN_Y] = interpolate(&lattice[2 * 2 * j], &lattice[2 * 2 * (j + 1)], 2, fx, fy, fz);
+    }
+}
+
+void CaveField::fillFromLattice(int worldXOrigin,
+                                int worldZOrigin,
+                                uint32_t seed,
+                                CaveQuality quality,
+                                ColumnNoiseCache* cache)
+{
+    glm::ivec3 step = latticeStep(quality);
+    glm::ivec3 count = latticeCount(step);
+    std::vector<float> lattice(count.x * count.z * count.y);
+    std::vector<float> column;
+    for (int k = 0; k < count.z; k++) {
+        for (int i = 0; i < count.x; i++) {
+            latticeColumn(quality,
+                          worldXOrigin + i * step.x,
+                          worldZOrigin + k * step.z,
+                          seed,
+                          cache,
+                          column);
+            for (int j = 0; j < count.y; j++) {
+                lattice[i + count.x * (k + count.z * j)] = column[j];
+            }
+        }
+    }
+
+    for (int y = MIN_Y; y <= MAX_Y; y++) {
+        int j = y / step.y;
+        float fy = float(y - j * step.y) / step.y;
+        for (int z = 0; z < 16; z++) {
+            int k = z / step.z;
+            float fz = float(z - k * step.z) / step.z;
+            const float* below = &lattice[count.x * (k + count.z * j)];
+            const float* above = &lattice[count.x * (k + count.z * (j + 1))];
+            for (int x = 0; x < 16; x++) {
+                int i = x / step.x;
+                float fx = float(x - i * step.x) / step.x;
+                m_density[x + 16 * z + LAYER * (y - MIN_Y)]
+                    = interpolate(below + i, above + i, count.x, fx, fy, fz);
+            }
+        }
+    }
+}
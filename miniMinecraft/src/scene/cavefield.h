@@ -0,0 +1,62 @@
+#pragma once
+#include "glm_includes.h"
+#include "columnnoisecache.h"
+#include <vector>
+
+// How finely CaveField evaluates the cave noise
+enum class CaveQuality : unsigned char {
+    FULL,    // at every block
+    MEDIUM,  // every 2 blocks across and 4 up
+    COARSE   // every 4 blocks across and 8 up
+};
+
+// The density helperCreate carves a Chunk's caves out of, for its blocks from MIN_Y up to
+// MAX_Y: the sum of two perlin3D fields, with caves wherever it's below THRESHOLD.
+// Two perlin3D calls per block add up to most of the time it takes to generate a Chunk, so
+// below FULL quality the density is only evaluated on a coarse lattice and trilinearly
+// interpolated between its points. The lattice is aligned to world coordinates, so
+// neighboring Chunks share the points along their border and their caves line up. The
+// lattice's columns go through a ColumnNoiseCache, so those shared points are only
+// evaluated by whichever Chunk gets to them first.
+// The density is a pure function of the world's seed and the position.
+class CaveField
+{
+public:
+    static constexpr int MIN_Y = 1;
+    static constexpr int MAX_Y = 106;
+    static constexpr float THRESHOLD = -0.15f;
+
+    // cache may be null, in which case every lattice point is evaluated
+    CaveField(int worldXOrigin,
+              int worldZOrigin,
+              uint32_t seed,
+              CaveQuality quality,
+              ColumnNoiseCache* cache);
+
+    // Density at the block at local x and z, MIN_Y <= y <= MAX_Y
+    float densityAt(int x, int y, int z) const;
+    bool isCave(int x, int y, int z) const;
+
+    // The exact density at a world position, what FULL quality evaluates at every block
+    static float sample(int worldX, int y, int worldZ, uint32_t seed);
+    // The density down the world column (worldX, worldZ) at a quality, indexed by y - MIN_Y,
+    // exactly as densityAt gives it in the Chunk the column belongs to. For callers that only
+    // need a few columns of a Chunk.
+    static void column(int worldX,
+                       int worldZ,
+                       uint32_t seed,
+                       CaveQuality quality,
+                       ColumnNoiseCache* cache,
+                       std::vector<float>& out);
+    // Blocks between lattice points along x, y and z at a quality
+    static glm::ivec3 latticeStep(CaveQuality quality);
+
+private:
+    std::vector<float> m_density;  // indexed by x + 16 * z + 256 * (y - MIN_Y)
+
+    void fillFromLattice(int worldXOrigin,
+                         int worldZOrigin,
+                         uint32_t seed,
+                         CaveQuality quality,
+                         ColumnNoiseCache* cache);
+};
@@ -2,21 +2,109 @@
 #include "terrain.h"
 #include <iostream>
 #include <algorithm>
+#include <cstring>
+#include <tuple>
 #include "biome.h"
+#include "chunkcodec.h"
+#include "faceculling.h"
+#include "jobsystem.h"
+#include "meshbufferpool.h"
+
+bool Chunk::greedyMeshing = true;
+CaveQuality Chunk::caveQuality = CaveQuality::COARSE;
+
+static constexpr int CHUNK_VOLUME = 16 * 256 * 16;
+
+// Calls visit(first, t, count) for each run of a Chunk's block stream, first being the
+// y-major index x + 16 * z + 256 * y of its first block, until visit returns false.
+// Returns false if the stream is malformed or doesn't hold exactly one Chunk's blocks.
+template<typename F>
+static bool forEachBlockRun(BlockStreamDecoder& decoder, F visit)
+{
+    int first = 0;
+    BlockType t;
+    uint32_t count;
+    while (decoder.next(t, count)) {
+        if (count > uint32_t(CHUNK_VOLUME - first)) {
+            return false;
+        }
+        if (!visit(first, t, int(count))) {
+            return true;
+        }
+        first += count;
+    }
+    return !decoder.failed() && first == CHUNK_VOLUME;
+}
+
+// Decodes a Chunk's block stream into 16 sections
+static bool decodeSections(const unsigned char*& data,
+                           const unsigned char* end,
+                           std::array<PalettedSection, 16>& sections)
+{
+    // A section is 16 whole layers, so 4096 consecutive blocks of the stream
+    std::array<BlockType, PalettedSection::VOLUME> buffer;
+    BlockStreamDecoder decoder(data, end);
+    bool ok = forEachBlockRun(decoder, [&](int first, BlockType t, int count) {
+        for (int i = first; i < first + count;) {
+            // Runs covering whole sections skip the buffer
+            if ((i & 4095) == 0 && first + count - i >= 4096) {
+                sections[i >> 12].fill(t);
+                i += 4096;
+                continue;
+            }
+            int local = i & 4095;
+            buffer[PalettedSection::toIndex(local & 15, local >> 8, (local >> 4) & 15)] = t;
+            if ((++i & 4095) == 0) {
+                sections[(i - 1) >> 12].assign(buffer);
+            }
+        }
+        return true;
+    });
+    if (ok) {
+        data = decoder.end();
+    }
+    return ok;
+}
 
 Chunk::Chunk(OpenGLContext* context)
     : Drawable(context)
-    , m_blocks()
+    , m_state(ChunkState::ALLOCATED)
+    , m_editEpoch(1)
+    , m_uploadedEpoch(0)
+    , m_gpuBytes(0)
+    , m_sectionBuffers()
+    , m_recentlyRead(false)
+    , m_seed(0)
+    , m_sections()
     , m_neighbors{{XPOS, nullptr}, {XNEG, nullptr}, {ZPOS, nullptr}, {ZNEG, nullptr}}
+{}
+
+Chunk::~Chunk()
 {
-    std::fill_n(m_blocks.begin(), 65536, EMPTY);
+    for (ChunkSectionBuffers& buffers : m_sectionBuffers) {
+        for (GLuint* buf : {&buffers.oVertData, &buffers.oIdx, &buffers.tVertData, &buffers.tIdx}) {
+            if (*buf != 0) {
+                mp_context->glDeleteBuffers(1, buf);
+            }
+        }
+    }
 }
 
 // Does bounds checking with at()
 BlockType Chunk::getBlockAt(int x, int y, int z) const
 {
     if (isInBounds(glm::ivec3(x, y, z))) {
-        return m_blocks.at(x + 16 * y + 16 * 256 * z);
+        if (!m_recentlyRead.load(std::memory_order_relaxed)) {
+            m_recentlyRead.store(true, std::memory_order_relaxed);
+        }
+        m_blocksLock.lock();
+        if (!m_packedBlocks.empty()) {
+            // The blocks are the same either way, only how they're stored changes
+            const_cast<Chunk*>(this)->unpackLocked();
+        }
+        BlockType t = getLocalBlockAt(x, y, z);
+        m_blocksLock.unlock();
+        return t;
     } else if (x < 0 && m_neighbors.at(XNEG) != nullptr) {
         return m_neighbors.at(XNEG)->getBlockAt(16 + x, y, z);
     } else if (x > 15 && m_neighbors.at(XPOS) != nullptr) {
@@ -45,11 +133,41 @@ glm::vec4 Chunk::getBiomeAt(int x, int z) const
     return getBiomeAt(static_cast<unsigned int>(x), static_cast<unsigned int>(z));
 }
 
+BlockType Chunk::getLocalBlockAt(int x, int y, int z) const
+{
+    return m_sections.at(y >> 4).blocks.get(x, y & 15, z);
+}
+
+bool Chunk::setLocalBlockAt(int x, int y, int z, BlockType t)
+{
+    if (!m_packedBlocks.empty()) {
+        unpackLocked();
+    }
+
+    ChunkSection& sec = m_sections.at(y >> 4);
+    BlockType prev = sec.blocks.get(x, y & 15, z);
+
+    if (prev == t) {
+        return false;
+    }
+
+    sec.blocks.set(x, y & 15, z, t);
+    sec.nonEmptyCount += (t != EMPTY) - (prev != EMPTY);
+    sec.opaqueCount += BlockTraits::isOpaqueCube(t) - BlockTraits::isOpaqueCube(prev);
+    return true;
+}
+
 // Does bounds checking with at()
 void Chunk::setBlockAt(int x, int y, int z, BlockType t)
 {
     if (isInBounds(glm::ivec3(x, y, z))) {
-        m_blocks.at(x + 16 * y + 16 * 256 * z) = t;
+        m_blocksLock.lock();
+        bool changed = setLocalBlockAt(x, y, z, t);
+        m_blocksLock.unlock();
+
+        if (changed) {
+            markDirty(x, y, z);
+        }
     } else if (x < 0 && m_neighbors.at(XNEG) != nullptr) {
         m_neighbors.at(XNEG)->setBlockAt(16 + x, y, z, t);
     } else if (x > 15 && m_neighbors.at(XPOS) != nullptr) {
@@ -61,208 +179,589 @@ void Chunk::setBlockAt(int x, int y, int z, BlockType t)
     }
 }
 
-void Chunk::setBiomeAt(unsigned int x, unsigned int z, glm::vec4 b)
+void Chunk::setStructureBlockAt(int x, int y, int z, BlockType t)
 {
-    m_biomes.at(x + 16 * z) = b;
+    if (isInBounds(glm::ivec3(x, y, z))) {
+        setBlockAt(x, y, z, t);
+    }
 }
 
-void Chunk::linkNeighbor(uPtr<Chunk>& neighbor, Direction dir)
+void Chunk::fillColumn(int x, int z, int yMin, int yMax, BlockType t)
 {
-    if (neighbor != nullptr) {
-        this->m_neighbors[dir] = neighbor.get();
-        neighbor->m_neighbors[oppositeDirection.at(dir)] = this;
+    yMin = std::max(yMin, 0);
+    yMax = std::min(yMax, 256);
+
+    if (x < 0 || x > 15 || z < 0 || z > 15 || yMin >= yMax) {
+        return;
+    }
+
+    m_blocksLock.lock();
+    for (int y = yMin; y < yMax; y++) {
+        setLocalBlockAt(x, y, z, t);
+    }
+    m_blocksLock.unlock();
+
+    // Every section the column passes through needs re-meshing, as do the sections
+    // bordering the first and last block the column covers in each of them
+    for (int y = yMin; y < yMax; y = (y | 15) + 1) {
+        markDirty(x, y, z);
+        markDirty(x, std::min(y | 15, yMax - 1), z);
     }
 }
 
-bool Chunk::isInBounds(glm::ivec3 pos)
+void Chunk::compactBlocks()
 {
-    return (pos.x >= 0 && pos.x < 16 && pos.y >= 0 && pos.y < 256 && pos.z >= 0 && pos.z < 16);
+    m_blocksLock.lock();
+    for (ChunkSection& s : m_sections) {
+        s.blocks.compact();
+    }
+    m_blocksLock.unlock();
 }
 
-bool Chunk::isHPlane(BlockType bt)
+std::size_t Chunk::blockMemoryUsage() const
 {
-    return hPlane.find(bt) != hPlane.end();
+    std::size_t total = 0;
+    m_blocksLock.lock();
+    total += m_packedBlocks.capacity();
+    for (const ChunkSection& s : m_sections) {
+        total += s.blocks.memoryUsage();
+    }
+    m_blocksLock.unlock();
+    return total;
 }
 
-bool Chunk::isCross2(BlockType bt)
+void Chunk::encodeLocked(std::vector<unsigned char>& out) const
 {
-    return cross2.find(bt) != cross2.end();
+    if (!m_packedBlocks.empty()) {
+        out.insert(out.end(), m_packedBlocks.begin(), m_packedBlocks.end());
+        return;
+    }
+
+    BlockStreamEncoder encoder(out);
+    for (const ChunkSection& s : m_sections) {
+        if (s.blocks.isUniform()) {
+            encoder.put(s.blocks.get(0, 0, 0), PalettedSection::VOLUME);
+            continue;
+        }
+        for (int y = 0; y < 16; y++) {
+            for (int z = 0; z < 16; z++) {
+                for (int x = 0; x < 16; x++) {
+                    encoder.put(s.blocks.get(x, y, z));
+                }
+            }
+        }
+    }
+    encoder.finish();
 }
 
-bool Chunk::isCross4(BlockType bt)
+void Chunk::encodeBlocks(std::vector<unsigned char>& out) const
 {
-    return cross4.find(bt) != cross4.end();
+    m_blocksLock.lock();
+    encodeLocked(out);
+    m_blocksLock.unlock();
 }
 
-bool Chunk::isPartialX(BlockType bt)
+bool Chunk::decodeBlocks(const unsigned char*& data, const unsigned char* end)
 {
-    return partialX.find(bt) != partialX.end();
+    std::array<PalettedSection, 16> blocks;
+    if (!decodeSections(data, end, blocks)) {
+        return false;
+    }
+
+    m_blocksLock.lock();
+    replaceSectionsLocked(blocks);
+    m_blocksLock.unlock();
+    return true;
 }
 
-bool Chunk::isPartialY(BlockType bt)
+void Chunk::packBlocks()
 {
-    return partialY.find(bt) != partialY.end();
+    m_blocksLock.lock();
+    if (m_packedBlocks.empty()) {
+        std::vector<unsigned char> packed;
+        encodeLocked(packed);
+        packed.shrink_to_fit();
+        m_packedBlocks = std::move(packed);
+        for (ChunkSection& s : m_sections) {
+            s.blocks.fill(EMPTY);
+        }
+    }
+    m_blocksLock.unlock();
 }
 
-bool Chunk::isPartialZ(BlockType bt)
+void Chunk::unpackBlocks()
 {
-    return partialZ.find(bt) != partialZ.end();
+    m_blocksLock.lock();
+    if (!m_packedBlocks.empty()) {
+        unpackLocked();
+    }
+    m_blocksLock.unlock();
 }
 
-bool Chunk::isFullCube(BlockType bt)
+void Chunk::unpackLocked()
 {
-    return fullCube.find(bt) != fullCube.end();
+    // The stream was written by encodeLocked, so it can't be malformed
+    std::array<PalettedSection, 16> blocks;
+    const unsigned char* data = m_packedBlocks.data();
+    decodeSections(data, data + m_packedBlocks.size(), blocks);
+    for (int s = 0; s < 16; s++) {
+        m_sections[s].blocks = std::move(blocks[s]);
+    }
+    std::vector<unsigned char>().swap(m_packedBlocks);
 }
 
-bool Chunk::isTransparent(BlockType bt)
+bool Chunk::isPacked() const
 {
-    return transparent.find(bt) != transparent.end();
+    m_blocksLock.lock();
+    bool packed = !m_packedBlocks.empty();
+    m_blocksLock.unlock();
+    return packed;
 }
 
-bool Chunk::isVisible(int x, int y, int z, BlockType bt)
+bool Chunk::clearRecentlyRead()
 {
-    for (const DirectionVector& dv : directionIter) {
-        glm::ivec3 adjBlockPos = glm::ivec3(x, y, z) + dv.vec;
-        bool inSameChunk = Chunk::isInBounds(adjBlockPos);
+    return m_recentlyRead.exchange(false, std::memory_order_relaxed);
+}
+
+std::vector<unsigned char> Chunk::serialize() const
+{
+    std::vector<unsigned char> out;
+    encodeBlocks(out);
+
+    auto append = [&](const void* data, std::size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        out.insert(out.end(), bytes, bytes + size);
+    };
+    append(m_biomes.data(), sizeof(m_biomes));
+    uint32_t spawnCount = viableSpawnBlocks.size();
+    append(&spawnCount, sizeof(spawnCount));
+    append(viableSpawnBlocks.data(), spawnCount * sizeof(glm::vec3));
+    return out;
+}
 
-        BlockType adjBlockType;
+bool Chunk::deserialize(const unsigned char* data, std::size_t size)
+{
+    const unsigned char* end = data + size;
 
-        if (inSameChunk) {
-            adjBlockType = this->getBlockAt(adjBlockPos.x, adjBlockPos.y, adjBlockPos.z);
-        } else {
-            adjBlockType = this->getAdjBlockType(dv.dir, adjBlockPos);
-        }
+    std::array<PalettedSection, 16> blocks;
+    if (!decodeSections(data, end, blocks)) {
+        return false;
+    }
 
-        if ((!isFullCube(adjBlockType) || isTransparent(adjBlockType)) && adjBlockType != bt) {
-            return true;
-        }
+    uint32_t spawnCount = 0;
+    if (static_cast<std::size_t>(end - data) < sizeof(m_biomes) + sizeof(spawnCount)) {
+        return false;
+    }
+    std::memcpy(&spawnCount, data + sizeof(m_biomes), sizeof(spawnCount));
+    if (static_cast<std::size_t>(end - data)
+        != sizeof(m_biomes) + sizeof(spawnCount) + spawnCount * sizeof(glm::vec3)) {
+        return false;
     }
 
-    return false;
+    std::memcpy(static_cast<void*>(m_biomes.data()), data, sizeof(m_biomes));
+    data += sizeof(m_biomes) + sizeof(spawnCount);
+    viableSpawnBlocks.resize(spawnCount);
+    std::memcpy(static_cast<void*>(viableSpawnBlocks.data()),
+                data,
+                spawnCount * sizeof(glm::vec3));
+
+    m_blocksLock.lock();
+    replaceSectionsLocked(blocks);
+    m_blocksLock.unlock();
+    return true;
 }
 
-bool Chunk::isVisible(int x, int y, int z, DirectionVector dv, BlockType bt)
+void Chunk::replaceSectionsLocked(std::array<PalettedSection, 16>& blocks)
 {
-    glm::ivec3 adjBlockPos = glm::ivec3(x, y, z) + dv.vec;
-    bool inSameChunk = Chunk::isInBounds(adjBlockPos);
-    Direction d = dv.dir;
+    std::vector<unsigned char>().swap(m_packedBlocks);
+    for (int s = 0; s < 16; s++) {
+        ChunkSection& sec = m_sections[s];
+        sec.blocks = std::move(blocks[s]);
+        sec.dirty = true;
+
+        // The counts setLocalBlockAt keeps up to date as blocks are written one at a time
+        sec.nonEmptyCount = 0;
+        sec.opaqueCount = 0;
+        for (int z = 0; z < 16; z++) {
+            for (int y = 0; y < 16; y++) {
+                for (int x = 0; x < 16; x++) {
+                    BlockType t = sec.blocks.get(x, y, z);
+                    sec.nonEmptyCount += t != EMPTY;
+                    sec.opaqueCount += BlockTraits::isOpaqueCube(t);
+                }
+            }
+        }
+    }
+
+    // Every section touches the shared edge, as fillColumn's markDirty calls would find
+    for (const auto& n : m_neighbors) {
+        if (n.second != nullptr) {
+            n.second->markAllDirty();
+        }
+    }
+}
 
-    BlockType adjBlockType;
+std::size_t Chunk::memoryUsage() const
+{
+    return sizeof(Chunk) + blockMemoryUsage() + m_gpuBytes;
+}
 
-    if (inSameChunk) {
-        adjBlockType = this->getBlockAt(adjBlockPos.x, adjBlockPos.y, adjBlockPos.z);
+void Chunk::takeSnapshot(ChunkSnapshot& out) const
+{
+    m_blocksLock.lock();
+    if (m_packedBlocks.empty()) {
+        for (int s = 0; s < 16; s++) {
+            const PalettedSection& sec = m_sections[s].blocks;
+
+            for (int y = 0; y < 16; y++) {
+                for (int z = 0; z < 16; z++) {
+                    BlockType* row = &out.blocks[ChunkSnapshot::index(0, 16 * s + y, z)];
+                    for (int x = 0; x < 16; x++) {
+                        row[x] = sec.get(x, y, z);
+                    }
+                }
+            }
+        }
     } else {
-        adjBlockType = this->getAdjBlockType(dv.dir, adjBlockPos);
+        // The stream is in the snapshot's own order, less its padding
+        BlockStreamDecoder decoder(m_packedBlocks.data(),
+                                   m_packedBlocks.data() + m_packedBlocks.size());
+        forEachBlockRun(decoder, [&](int first, BlockType t, int count) {
+            for (int i = first; i < first + count; i++) {
+                out.blocks[ChunkSnapshot::index(i & 15, i >> 8, (i >> 4) & 15)] = t;
+            }
+            return true;
+        });
     }
+    out.biomes = m_biomes;
+    m_blocksLock.unlock();
 
-    if (adjBlockType == EMPTY) {
-        return true;
-    }
-    // if block is completely enclosed by non-transparent blocks
-    if (!isVisible(x, y, z, bt)) {
-        return false;
+    // Borrow the one-block border from each neighbor, under that neighbor's own lock
+    for (const auto& n : m_neighbors) {
+        Chunk* neighbor = n.second;
+
+        if (neighbor == nullptr) {
+            continue;
+        }
+
+        neighbor->m_blocksLock.lock();
+        if (!neighbor->m_packedBlocks.empty()) {
+            // One pass over the stream rather than a walk of it per border block
+            glm::ivec3 offset = glm::ivec3(n.first == XPOS ? 16 : n.first == XNEG ? -16 : 0,
+                                           0,
+                                           n.first == ZPOS ? 16 : n.first == ZNEG ? -16 : 0);
+            const std::vector<unsigned char>& packed = neighbor->m_packedBlocks;
+            BlockStreamDecoder decoder(packed.data(), packed.data() + packed.size());
+            forEachBlockRun(decoder, [&](int first, BlockType t, int count) {
+                for (int i = first; i < first + count; i++) {
+                    glm::ivec3 p = glm::ivec3(i & 15, i >> 8, (i >> 4) & 15) + offset;
+                    if (p.x >= -1 && p.x <= 16 && p.z >= -1 && p.z <= 16) {
+                        out.blocks[ChunkSnapshot::index(p.x, p.y, p.z)] = t;
+                    }
+                }
+                return true;
+            });
+            neighbor->m_blocksLock.unlock();
+            continue;
+        }
+        for (int y = 0; y < 256; y++) {
+            for (int i = 0; i < 16; i++) {
+                switch (n.first) {
+                    case XPOS:
+                        out.blocks[ChunkSnapshot::index(16, y, i)] = neighbor->getLocalBlockAt(0, y, i);
+                        break;
+                    case XNEG:
+                        out.blocks[ChunkSnapshot::index(-1, y, i)] = neighbor->getLocalBlockAt(15,
+                                                                                               y,
+                                                                                               i);
+                        break;
+                    case ZPOS:
+                        out.blocks[ChunkSnapshot::index(i, y, 16)] = neighbor->getLocalBlockAt(i, y, 0);
+                        break;
+                    case ZNEG:
+                        out.blocks[ChunkSnapshot::index(i, y, -1)] = neighbor->getLocalBlockAt(i,
+                                                                                               y,
+                                                                                               15);
+                        break;
+                    default: break;
+                }
+            }
+        }
+        neighbor->m_blocksLock.unlock();
     }
+}
 
-    if (isFullCube(bt) && isFullCube(adjBlockType) && !isTransparent(adjBlockType)) {
-        return false;
+void Chunk::markDirty(int x, int y, int z)
+{
+    int s = y >> 4;
+    m_sections[s].dirty = true;
+
+    // Blocks on a section's border also affect which faces its neighbors show
+    if ((y & 15) == 0 && s > 0) {
+        m_sections[s - 1].dirty = true;
+    } else if ((y & 15) == 15 && s < 15) {
+        m_sections[s + 1].dirty = true;
     }
 
-    if ((bt == WATER || bt == LAVA || bt == ICE)
-        && (bt == adjBlockType
-            || ((isCross4(adjBlockType) || isCross2(adjBlockType)) && d != YPOS))) {
-        return false;
+    if (x == 0 && m_neighbors.at(XNEG) != nullptr) {
+        m_neighbors.at(XNEG)->m_sections[s].dirty = true;
+    } else if (x == 15 && m_neighbors.at(XPOS) != nullptr) {
+        m_neighbors.at(XPOS)->m_sections[s].dirty = true;
     }
 
-    if (bt == WATER && (adjBlockType == RICE_01 || adjBlockType == RICE_02)) {
-        return false;
+    if (z == 0 && m_neighbors.at(ZNEG) != nullptr) {
+        m_neighbors.at(ZNEG)->m_sections[s].dirty = true;
+    } else if (z == 15 && m_neighbors.at(ZPOS) != nullptr) {
+        m_neighbors.at(ZPOS)->m_sections[s].dirty = true;
     }
+}
 
-    if ((d == XPOS || d == XNEG) && isPartialX(bt) && !isPartialY(bt) && !isPartialZ(bt)
-        && bt == adjBlockType) {
-        return false;
+void Chunk::markAllDirty()
+{
+    for (ChunkSection& s : m_sections) {
+        s.dirty = true;
     }
+}
 
-    if ((d == YPOS || d == YNEG) && isPartialY(bt) && !isPartialX(bt) && !isPartialZ(bt)
-        && bt == adjBlockType) {
-        return false;
+void Chunk::markSectionsDirty(uint16_t sections)
+{
+    for (int s = 0; s < 16; s++) {
+        if ((sections >> s) & 1) {
+            m_sections[s].dirty = true;
+        }
     }
+}
 
-    if ((d == ZPOS || d == ZNEG) && isPartialZ(bt) && !isPartialX(bt) && !isPartialY(bt)
-        && bt == adjBlockType) {
+bool Chunk::isSectionBuried(int s) const
+{
+    // The very top and bottom sections always have an exposed face
+    if (s == 0 || s == 15) {
         return false;
     }
-    // if the block adjacent to this face is EMPTY or transparent and is of a different type
-    if (isTransparent(adjBlockType) && adjBlockType != bt) {
-        return true;
-    }
 
-    if ((bt == CEDAR_LEAVES || bt == TEAK_LEAVES || bt == CHERRY_BLOSSOMS_1
-         || bt == CHERRY_BLOSSOMS_2 || bt == CHERRY_BLOSSOMS_3 || bt == CHERRY_BLOSSOMS_4
-         || bt == MAPLE_LEAVES_1 || bt == MAPLE_LEAVES_2 || bt == MAPLE_LEAVES_3 || bt == PINE_LEAVES
-         || bt == WISTERIA_BLOSSOMS_1 || bt == WISTERIA_BLOSSOMS_2 || bt == WISTERIA_BLOSSOMS_3)
-        && bt == adjBlockType) {
-        return true;
-    }
+    m_blocksLock.lock();
+    bool buried = m_sections[s].isSolid() && m_sections[s - 1].isSolid()
+                  && m_sections[s + 1].isSolid();
+    m_blocksLock.unlock();
 
-    if (isHPlane(adjBlockType) || isCross2(adjBlockType) || isCross4(adjBlockType)) {
-        return true;
+    // One lock at a time, as in takeSnapshot
+    for (const auto& n : m_neighbors) {
+        if (!buried) {
+            break;
+        }
+        if (n.second == nullptr) {
+            return false;
+        }
+        n.second->m_blocksLock.lock();
+        buried = n.second->m_sections[s].isSolid();
+        n.second->m_blocksLock.unlock();
     }
 
-    // if not a cube or partial block
-    if (isHPlane(bt) || isCross2(bt) || isCross4(bt)) {
-        return true;
-    }
+    return buried;
+}
 
-    // if this face or adjacent block face doesn't reach the bounds of a full block
-    if (((d == XPOS || d == XNEG)
-         && (isPartialX(bt) || isPartialX(adjBlockType) || isPartialY(adjBlockType)
-             || isPartialZ(adjBlockType)))
-        || ((d == YPOS) && (isPartialY(bt) || isPartialX(adjBlockType) || isPartialZ(adjBlockType)))
-        || ((d == YNEG)
-            && (isPartialX(adjBlockType) || isPartialY(adjBlockType) || isPartialZ(adjBlockType)))
-        || ((d == ZPOS || d == ZNEG)
-            && (isPartialZ(bt) || isPartialX(adjBlockType) || isPartialY(adjBlockType)
-                || isPartialZ(adjBlockType)))) {
-        return true;
-    }
+const ChunkSection& Chunk::getSection(int s) const
+{
+    return m_sections.at(s);
+}
 
-    if (d == YNEG
-        && (bt == CEDAR_PLANKS_2 || bt == TEAK_PLANKS_2 || bt == CHERRY_PLANKS_2
-            || bt == MAPLE_PLANKS_2 || bt == PINE_PLANKS_2 || bt == WISTERIA_PLANKS_2
-            || bt == ROOF_TILES_2 || bt == STRAW_2)) {
-        return true;
+void Chunk::setBiomeAt(unsigned int x, unsigned int z, glm::vec4 b)
+{
+    m_biomes.at(x + 16 * z) = b;
+}
+
+void Chunk::linkNeighbor(uPtr<Chunk>& neighbor, Direction dir)
+{
+    if (neighbor != nullptr) {
+        this->m_neighbors[dir] = neighbor.get();
+        neighbor->m_neighbors[oppositeDirection.at(dir)] = this;
+
+        // Faces along the shared border may now be hidden
+        this->markAllDirty();
+        neighbor->markAllDirty();
     }
+}
 
-    if (d == YPOS
-        && (adjBlockType == CEDAR_PLANKS_2 || adjBlockType == TEAK_PLANKS_2
-            || adjBlockType == CHERRY_PLANKS_2 || adjBlockType == MAPLE_PLANKS_2
-            || adjBlockType == PINE_PLANKS_2 || adjBlockType == WISTERIA_PLANKS_2
-            || adjBlockType == ROOF_TILES_2 || adjBlockType == STRAW_2)) {
-        return true;
+void Chunk::unlinkNeighbors()
+{
+    for (auto& n : m_neighbors) {
+        if (n.second != nullptr) {
+            n.second->m_neighbors[oppositeDirection.at(n.first)] = nullptr;
+            // Faces along the border it shared with this Chunk may now be exposed
+            n.second->markAllDirty();
+            n.second = nullptr;
+        }
     }
+}
 
-    return false;
+bool Chunk::isInBounds(glm::ivec3 pos)
+{
+    return (pos.x >= 0 && pos.x < 16 && pos.y >= 0 && pos.y < 256 && pos.z >= 0 && pos.z < 16);
+}
+
+bool Chunk::isHPlane(BlockType bt)
+{
+    return BlockTraits::isHPlane(bt);
+}
+
+bool Chunk::isCross2(BlockType bt)
+{
+    return BlockTraits::isCross2(bt);
+}
+
+bool Chunk::isCross4(BlockType bt)
+{
+    return BlockTraits::isCross4(bt);
+}
+
+bool Chunk::isPartialX(BlockType bt)
+{
+    return BlockTraits::isPartialX(bt);
+}
+
+bool Chunk::isPartialY(BlockType bt)
+{
+    return BlockTraits::isPartialY(bt);
 }
 
-BlockType Chunk::getAdjBlockType(Direction d, glm::ivec3 pos)
+bool Chunk::isPartialZ(BlockType bt)
 {
-    Chunk* neighborChunk = m_neighbors[d];
+    return BlockTraits::isPartialZ(bt);
+}
 
-    if (neighborChunk != nullptr) {
-        switch (d) {
-            case XPOS: return neighborChunk->getBlockAt(0, pos.y, pos.z);
+bool Chunk::isFullCube(BlockType bt)
+{
+    return BlockTraits::isFullCube(bt);
+}
 
-            case XNEG: return neighborChunk->getBlockAt(15, pos.y, pos.z);
+bool Chunk::isTransparent(BlockType bt)
+{
+    return BlockTraits::isTransparent(bt);
+}
 
-            case ZPOS: return neighborChunk->getBlockAt(pos.x, pos.y, 0);
+bool Chunk::isUnitCube(BlockType bt)
+{
+    // water and lava are partial blocks for culling purposes but are drawn as whole cubes
+    return isFullCube(bt) || bt == WATER || bt == LAVA;
+}
 
-            case ZNEG: return neighborChunk->getBlockAt(pos.x, pos.y, 15);
+bool Chunk::isVisible(const ChunkSnapshot& snap, int x, int y, int z, BlockType bt)
+{
+    for (const DirectionVector& dv : directionIter) {
+        glm::ivec3 adjBlockPos = glm::ivec3(x, y, z) + dv.vec;
+        BlockType adjBlockType = snap.getBlockAt(adjBlockPos.x, adjBlockPos.y, adjBlockPos.z);
 
-            default: return EMPTY;
+        if ((!isFullCube(adjBlockType) || isTransparent(adjBlockType)) && adjBlockType != bt) {
+            return true;
         }
     }
 
-    return EMPTY;
+    return false;
+}
+
+bool Chunk::isVisible(const ChunkSnapshot& snap,
+                      int x,
+                      int y,
+                      int z,
+                      DirectionVector dv,
+                      BlockType bt)
+{
+    glm::ivec3 adjBlockPos = glm::ivec3(x, y, z) + dv.vec;
+    BlockType adjBlockType = snap.getBlockAt(adjBlockPos.x, adjBlockPos.y, adjBlockPos.z);
+
+    // if block is completely enclosed by non-transparent blocks
+    if (adjBlockType != EMPTY && !isVisible(snap, x, y, z, bt)) {
+        return false;
+    }
+
+    return FaceCulling::isVisible(bt, adjBlockType, dv.dir);
+}
+
+void Chunk::findExposedBlocks(const ChunkSnapshot& snap, int s, ExposedFaces& exposed)
+{
+    // Bit x + 1 of opaque[(y + 1) * 18 + (z + 1)] is set when the block at (x, y, z),
+    // relative to the bottom of the section, is an opaque cube, and of empty when it's EMPTY.
+    // This covers the section plus a one block border, so every block in the section has all
+    // six neighbors here.
+    std::array<uint32_t, 18 * 18> opaque;
+    std::array<uint32_t, 18 * 18> empty;
+    for (int y = -1; y <= 16; y++) {
+        for (int z = -1; z <= 16; z++) {
+            uint32_t opaqueRow = 0;
+            uint32_t emptyRow = 0;
+            for (int x = -1; x <= 16; x++) {
+                BlockType bt = snap.getBlockAt(x, 16 * s + y, z);
+                if (BlockTraits::isOpaqueCube(bt)) {
+                    opaqueRow |= uint32_t(1) << (x + 1);
+                } else if (bt == EMPTY) {
+                    emptyRow |= uint32_t(1) << (x + 1);
+                }
+            }
+            opaque[(y + 1) * 18 + (z + 1)] = opaqueRow;
+            empty[(y + 1) * 18 + (z + 1)] = emptyRow;
+        }
+    }
+
+    for (int y = 0; y < 16; y++) {
+        for (int z = 0; z < 16; z++) {
+            int i = (y + 1) * 18 + (z + 1);
+            uint32_t row = opaque[i];
+            uint32_t occupied = ~empty[i] & 0x1FFFE;
+
+            // The rows of each block's neighbors along XPOS, XNEG, YPOS, YNEG, ZPOS and ZNEG,
+            // lined up with its own
+            std::array<uint32_t, 6> opaqueNext = {row >> 1,
+                                                  row << 1,
+                                                  opaque[i + 18],
+                                                  opaque[i - 18],
+                                                  opaque[i + 1],
+                                                  opaque[i - 1]};
+            std::array<uint32_t, 6> emptyNext = {empty[i] >> 1,
+                                                 empty[i] << 1,
+                                                 empty[i + 18],
+                                                 empty[i - 18],
+                                                 empty[i + 1],
+                                                 empty[i - 1]};
+
+            // A block whose six neighbors are all opaque cubes can't be seen, whatever it is.
+            // An opaque cube can if any neighbor isn't one, and anything else can if any
+            // neighbor is EMPTY; the blocks left over check their neighbors one by one.
+            uint32_t buried = ~0u;
+            uint32_t nextToEmpty = 0;
+            for (int d = 0; d < 6; d++) {
+                buried &= opaqueNext[d];
+                nextToEmpty |= emptyNext[d];
+            }
+            uint32_t blocks = occupied & ~buried & (row | nextToEmpty);
+            uint32_t unsure = occupied & ~buried & ~blocks;
+            for (int x = 0; unsure != 0 && x < 16; x++) {
+                if (((unsure >> (x + 1)) & 1)
+                    && isVisible(snap, x, 16 * s + y, z, snap.getBlockAt(x, 16 * s + y, z))) {
+                    blocks |= uint32_t(1) << (x + 1);
+                }
+            }
+            exposed.blocks[y * 16 + z] = blocks >> 1;
+
+            for (const DirectionVector& dv : directionIter) {
+                // Faces against EMPTY are always drawn and faces between two opaque cubes
+                // never are; only the other pairs need the table
+                uint32_t faces = blocks & emptyNext[dv.dir];
+                uint32_t lookup = blocks & ~emptyNext[dv.dir] & ~(row & opaqueNext[dv.dir]);
+                for (int x = 0; lookup != 0 && x < 16; x++) {
+                    if (!((lookup >> (x + 1)) & 1)) {
+                        continue;
+                    }
+                    glm::ivec3 adj = glm::ivec3(x, 16 * s + y, z) + dv.vec;
+                    if (FaceCulling::isVisible(snap.getBlockAt(x, 16 * s + y, z),
+                                               snap.getBlockAt(adj.x, adj.y, adj.z),
+                                               dv.dir)) {
+                        faces |= uint32_t(1) << (x + 1);
+                    }
+                }
+                exposed.faces[dv.dir][y * 16 + z] = faces >> 1;
+            }
+        }
+    }
 }
 
 void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
@@ -486,25 +985,21 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
 
             if (d == XNEG) {
                 verts.push_back(Vertex(glm::vec4(x1, y1, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetZNEG, offsetYNEG),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x1, y2, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetZNEG, offsetYPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x1, y2, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetZPOS, offsetYPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x1, y1, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetZPOS, offsetYNEG),
@@ -512,25 +1007,21 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
 
                 if (isCross4(bt)) {
                     verts.push_back(Vertex(glm::vec4(x2, y1, z2, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetZNEG, offsetYNEG),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x2, y2, z2, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetZNEG, offsetYPOS),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x2, y2, z1, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetZPOS, offsetYPOS),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x2, y1, z1, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetZPOS, offsetYNEG),
@@ -538,25 +1029,21 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
                 }
             } else {
                 verts.push_back(Vertex(glm::vec4(x2, y1, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetZPOS, offsetYNEG),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x2, y2, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetZPOS, offsetYPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x2, y2, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetZNEG, offsetYPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x2, y1, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetZNEG, offsetYNEG),
@@ -564,25 +1051,21 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
 
                 if (isCross4(bt)) {
                     verts.push_back(Vertex(glm::vec4(x1, y1, z1, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetZPOS, offsetYNEG),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x1, y2, z1, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetZPOS, offsetYPOS),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x1, y2, z2, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetZNEG, offsetYPOS),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x1, y1, z2, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetZNEG, offsetYNEG),
@@ -613,50 +1096,42 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
 
             if (d == YNEG) {
                 verts.push_back(Vertex(glm::vec4(x1, y1, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXNEG, offsetZPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x1, y1, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXPOS, offsetZPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x2, y1, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXPOS, offsetZNEG),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x2, y1, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXNEG, offsetZNEG),
                                        bWts));
             } else {
                 verts.push_back(Vertex(glm::vec4(x2, y2, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXNEG, offsetZNEG),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x2, y2, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXPOS, offsetZNEG),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x1, y2, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXPOS, offsetZPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x1, y2, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXNEG, offsetZPOS),
@@ -686,25 +1161,21 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
 
             if (d == ZNEG) {
                 verts.push_back(Vertex(glm::vec4(x1, y1, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXNEG, offsetYNEG),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x1, y2, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXNEG, offsetYPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x2, y2, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXPOS, offsetYPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x2, y1, z1, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXPOS, offsetYNEG),
@@ -712,25 +1183,21 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
 
                 if (isCross4(bt)) {
                     verts.push_back(Vertex(glm::vec4(x1, y1, z2, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetXNEG, offsetYNEG),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x1, y2, z2, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetXNEG, offsetYPOS),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x2, y2, z2, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetXPOS, offsetYPOS),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x2, y1, z2, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetXPOS, offsetYNEG),
@@ -738,25 +1205,21 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
                 }
             } else {
                 verts.push_back(Vertex(glm::vec4(x2, y1, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXPOS, offsetYNEG),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x2, y2, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXPOS, offsetYPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x1, y2, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXNEG, offsetYPOS),
                                        bWts));
                 verts.push_back(Vertex(glm::vec4(x1, y1, z2, 1),
-                                       dirVec.vec,
                                        bt,
                                        d,
                                        glm::vec2(offsetXNEG, offsetYNEG),
@@ -764,25 +1227,21 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
 
                 if (isCross4(bt)) {
                     verts.push_back(Vertex(glm::vec4(x2, y1, z1, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetXPOS, offsetYNEG),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x2, y2, z1, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetXPOS, offsetYPOS),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x1, y2, z1, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetXNEG, offsetYPOS),
                                            bWts));
                     verts.push_back(Vertex(glm::vec4(x1, y1, z1, 1),
-                                           dirVec.vec,
                                            bt,
                                            d,
                                            glm::vec2(offsetXNEG, offsetYNEG),
@@ -799,14 +1258,10 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
             z1 += offsetDiag;
             z2 += 1 - offsetDiag;
 
-            verts.push_back(
-                Vertex(glm::vec4(x1, y1, z2, 1), dirVec.vec, bt, d, glm::vec2(0, 0), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x2, y1, z1, 1), dirVec.vec, bt, d, glm::vec2(1, 0), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x2, y2, z1, 1), dirVec.vec, bt, d, glm::vec2(1, 1), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x1, y2, z2, 1), dirVec.vec, bt, d, glm::vec2(0, 1), bWts));
+            verts.push_back(Vertex(glm::vec4(x1, y1, z2, 1), bt, d, glm::vec2(0, 0), bWts));
+            verts.push_back(Vertex(glm::vec4(x2, y1, z1, 1), bt, d, glm::vec2(1, 0), bWts));
+            verts.push_back(Vertex(glm::vec4(x2, y2, z1, 1), bt, d, glm::vec2(1, 1), bWts));
+            verts.push_back(Vertex(glm::vec4(x1, y2, z2, 1), bt, d, glm::vec2(0, 1), bWts));
 
             break;
 
@@ -817,14 +1272,10 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
             z1 += offsetDiag;
             z2 += 1 - offsetDiag;
 
-            verts.push_back(
-                Vertex(glm::vec4(x2, y1, z1, 1), dirVec.vec, bt, d, glm::vec2(0, 0), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x1, y1, z2, 1), dirVec.vec, bt, d, glm::vec2(1, 0), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x1, y2, z2, 1), dirVec.vec, bt, d, glm::vec2(1, 1), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x2, y2, z1, 1), dirVec.vec, bt, d, glm::vec2(0, 1), bWts));
+            verts.push_back(Vertex(glm::vec4(x2, y1, z1, 1), bt, d, glm::vec2(0, 0), bWts));
+            verts.push_back(Vertex(glm::vec4(x1, y1, z2, 1), bt, d, glm::vec2(1, 0), bWts));
+            verts.push_back(Vertex(glm::vec4(x1, y2, z2, 1), bt, d, glm::vec2(1, 1), bWts));
+            verts.push_back(Vertex(glm::vec4(x2, y2, z1, 1), bt, d, glm::vec2(0, 1), bWts));
 
             break;
 
@@ -835,14 +1286,10 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
             z1 += offsetDiag;
             z2 += 1 - offsetDiag;
 
-            verts.push_back(
-                Vertex(glm::vec4(x2, y1, z2, 1), dirVec.vec, bt, d, glm::vec2(0, 0), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x1, y1, z1, 1), dirVec.vec, bt, d, glm::vec2(1, 0), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x1, y2, z1, 1), dirVec.vec, bt, d, glm::vec2(1, 1), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x2, y2, z2, 1), dirVec.vec, bt, d, glm::vec2(0, 1), bWts));
+            verts.push_back(Vertex(glm::vec4(x2, y1, z2, 1), bt, d, glm::vec2(0, 0), bWts));
+            verts.push_back(Vertex(glm::vec4(x1, y1, z1, 1), bt, d, glm::vec2(1, 0), bWts));
+            verts.push_back(Vertex(glm::vec4(x1, y2, z1, 1), bt, d, glm::vec2(1, 1), bWts));
+            verts.push_back(Vertex(glm::vec4(x2, y2, z2, 1), bt, d, glm::vec2(0, 1), bWts));
 
             break;
 
@@ -853,131 +1300,278 @@ void Chunk::createFaceVBOData(std::vector<Vertex>& verts,
             z1 += offsetDiag;
             z2 += 1 - offsetDiag;
 
-            verts.push_back(
-                Vertex(glm::vec4(x1, y1, z1, 1), dirVec.vec, bt, d, glm::vec2(0, 0), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x2, y1, z2, 1), dirVec.vec, bt, d, glm::vec2(1, 0), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x2, y2, z2, 1), dirVec.vec, bt, d, glm::vec2(1, 1), bWts));
-            verts.push_back(
-                Vertex(glm::vec4(x1, y2, z1, 1), dirVec.vec, bt, d, glm::vec2(0, 1), bWts));
+            verts.push_back(Vertex(glm::vec4(x1, y1, z1, 1), bt, d, glm::vec2(0, 0), bWts));
+            verts.push_back(Vertex(glm::vec4(x2, y1, z2, 1), bt, d, glm::vec2(1, 0), bWts));
+            verts.push_back(Vertex(glm::vec4(x2, y2, z2, 1), bt, d, glm::vec2(1, 1), bWts));
+            verts.push_back(Vertex(glm::vec4(x1, y2, z1, 1), bt, d, glm::vec2(0, 1), bWts));
 
             break;
     }
 }
 
-void Chunk::createVBOdata()
+void Chunk::createGreedyFaceVBOData(std::vector<Vertex>& verts,
+                                    glm::ivec3 min,
+                                    glm::ivec3 max,
+                                    DirectionVector dirVec,
+                                    BlockType bt,
+                                    glm::vec4 bWts)
 {
-    // opaque
-    std::vector<GLuint> oIndices = std::vector<GLuint>();
-    std::vector<glm::vec4> oVertData = std::vector<glm::vec4>();
-    // transparent
-    std::vector<GLuint> tIndices = std::vector<GLuint>();
-    std::vector<glm::vec4> tVertData = std::vector<glm::vec4>();
-
-    int oVertCount = 0;
-    int tVertCount = 0;
-
-    for (int x = 0; x < 16; x++) {
-        for (int y = 0; y < 256; y++) {
-            for (int z = 0; z < 16; z++) {
-                BlockType currType = this->getBlockAt(x, y, z);
-                glm::vec4 biomeWts = this->getBiomeAt(x, z);
-
-                if (currType != EMPTY) {
-                    if (isHPlane(currType)) {
-                        if (isVisible(x, y, z, currType)) {
-                            for (const DirectionVector& dv : planeDirIter) {
-                                std::vector<Vertex> faceVerts;
-                                Chunk::createFaceVBOData(faceVerts, x, y, z, dv, currType, biomeWts);
-
-                                for (const Vertex& v : faceVerts) {
-                                    tVertData.push_back(v.position);
-                                    tVertData.push_back(v.normal);
-                                    tVertData.push_back(v.color);
-                                    tVertData.push_back(v.uvCoords);
-                                    tVertData.push_back(v.blockType);
-                                    tVertData.push_back(v.biomeWts);
-                                }
+    Direction d = dirVec.dir;
 
-                                tIndices.push_back(tVertCount);
-                                tIndices.push_back(tVertCount + 1);
-                                tIndices.push_back(tVertCount + 2);
-                                tIndices.push_back(tVertCount);
-                                tIndices.push_back(tVertCount + 2);
-                                tIndices.push_back(tVertCount + 3);
+    float x1 = min.x;
+    float x2 = max.x;
+    float y1 = min.y;
+    float y2 = max.y;
+    float z1 = min.z;
+    float z2 = max.z;
 
-                                tVertCount += 4;
-                            }
+    // Corners are wound the same way as createFaceVBOData, and the uvs run from 0 to the
+    // quad's size in blocks along the same axes a single block face would use
+    std::array<glm::vec3, 4> corners;
+    switch (d) {
+        case XPOS:
+            corners = {glm::vec3(x2, y1, z1),
+                       glm::vec3(x2, y2, z1),
+                       glm::vec3(x2, y2, z2),
+                       glm::vec3(x2, y1, z2)};
+            break;
+        case XNEG:
+            corners = {glm::vec3(x1, y1, z2),
+                       glm::vec3(x1, y2, z2),
+                       glm::vec3(x1, y2, z1),
+                       glm::vec3(x1, y1, z1)};
+            break;
+        case YPOS:
+            corners = {glm::vec3(x2, y2, z2),
+                       glm::vec3(x2, y2, z1),
+                       glm::vec3(x1, y2, z1),
+                       glm::vec3(x1, y2, z2)};
+            break;
+        case YNEG:
+            corners = {glm::vec3(x1, y1, z2),
+                       glm::vec3(x1, y1, z1),
+                       glm::vec3(x2, y1, z1),
+                       glm::vec3(x2, y1, z2)};
+            break;
+        case ZPOS:
+            corners = {glm::vec3(x2, y1, z2),
+                       glm::vec3(x2, y2, z2),
+                       glm::vec3(x1, y2, z2),
+                       glm::vec3(x1, y1, z2)};
+            break;
+        case ZNEG:
+            corners = {glm::vec3(x1, y1, z1),
+                       glm::vec3(x1, y2, z1),
+                       glm::vec3(x2, y2, z1),
+                       glm::vec3(x2, y1, z1)};
+            break;
+        default: return;
+    }
+
+    for (const glm::vec3& c : corners) {
+        glm::vec2 uv;
+        if (d == XPOS || d == XNEG) {
+            uv = glm::vec2(z2 - c.z, c.y - y1);
+        } else if (d == YPOS || d == YNEG) {
+            uv = glm::vec2(z2 - c.z, x2 - c.x);
+        } else {
+            uv = glm::vec2(c.x - x1, c.y - y1);
+        }
+        verts.push_back(Vertex(glm::vec4(c, 1), bt, d, uv, bWts, true));
+    }
+}
+
+void Chunk::createVBOdata()
+{
+    // Whatever a VBOWorker might be meshing right now predates this mesh
+    markEdited();
+
+    uPtr<ChunkVBOData> data = MeshBufferPool::acquire();
+    generateVBOData(*data);
+    loadVBO(*data);
+    MeshBufferPool::release(std::move(data));
+
+    // A VBOWorker's mesh still on its way will be found stale and dropped, and will settle
+    // the state when it is. A Chunk that's still ALLOCATED or GENERATING stays that way:
+    // its BDWorker hasn't filled in its blocks yet.
+    if (!transitionState(ChunkState::DIRTY, ChunkState::UPLOADED)) {
+        transitionState(ChunkState::GENERATED, ChunkState::UPLOADED);
+    }
+}
+
+// Fills one section's vertex and index buffers with verts and indices, making the buffers
+// the first time there's something to put in them and deleting them once there isn't.
+// Returns the bytes uploaded.
+static std::size_t uploadSectionMesh(OpenGLContext* context,
+                                     GLuint& vertData,
+                                     GLuint& idx,
+                                     const std::vector<Vertex>& verts,
+                                     const std::vector<GLuint>& indices)
+{
+    if (indices.empty()) {
+        if (idx != 0) {
+            context->glDeleteBuffers(1, &vertData);
+            context->glDeleteBuffers(1, &idx);
+            vertData = 0;
+            idx = 0;
+        }
+        return 0;
+    }
+
+    if (idx == 0) {
+        context->glGenBuffers(1, &vertData);
+        context->glGenBuffers(1, &idx);
+    }
+    context->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, idx);
+    context->glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                          indices.size() * sizeof(GLuint),
+                          indices.data(),
+                          GL_STATIC_DRAW);
+    context->glBindBuffer(GL_ARRAY_BUFFER, vertData);
+    context->glBufferData(GL_ARRAY_BUFFER,
+                          verts.size() * sizeof(Vertex),
+                          verts.data(),
+                          GL_STATIC_DRAW);
+    return indices.size() * sizeof(GLuint) + verts.size() * sizeof(Vertex);
+}
+
+void Chunk::loadVBO(const ChunkVBOData& data)
+{
+    // The sections that weren't re-meshed keep what's already in their buffers
+    for (int s = 0; s < 16; s++) {
+        if (!((data.meshed >> s) & 1)) {
+            continue;
+        }
+
+        const SectionVBOData& mesh = data.sections[s];
+        ChunkSectionBuffers& buffers = m_sectionBuffers[s];
+        m_gpuBytes -= buffers.bytes;
+        buffers.bytes = uploadSectionMesh(mp_context,
+                                          buffers.oVertData,
+                                          buffers.oIdx,
+                                          mesh.m_OVertData,
+                                          mesh.m_OIndexeData)
+                        + uploadSectionMesh(mp_context,
+                                            buffers.tVertData,
+                                            buffers.tIdx,
+                                            mesh.m_TVertData,
+                                            mesh.m_TIndexData);
+        buffers.oCount = mesh.m_OIndexeData.size();
+        buffers.tCount = mesh.m_TIndexData.size();
+        m_gpuBytes += buffers.bytes;
+    }
+    m_uploadedEpoch = data.epoch;
+}
+
+const ChunkSectionBuffers& Chunk::getSectionBuffers(int s) const
+{
+    return m_sectionBuffers[s];
+}
+
+void Chunk::generateSectionVBOData(const ChunkSnapshot& snap, int s, SectionVBOData& mesh)
+{
+    // opaque
+    std::vector<GLuint>& oIndices = mesh.m_OIndexeData;
+    std::vector<Vertex>& oVertData = mesh.m_OVertData;
+    // transparent
+    std::vector<GLuint>& tIndices = mesh.m_TIndexData;
+    std::vector<Vertex>& tVertData = mesh.m_TVertData;
+
+    // indices are relative to the section's first vertex
+    int oVertCount = 0;
+    int tVertCount = 0;
+
+    ExposedFaces exposed;
+    findExposedBlocks(snap, s, exposed);
+
+    for (int x = 0; x < 16; x++) {
+        for (int y = 16 * s; y < 16 * s + 16; y++) {
+            for (int z = 0; z < 16; z++) {
+                // air and enclosed blocks have nothing to draw
+                int row = (y - 16 * s) * 16 + z;
+                if (!((exposed.blocks[row] >> x) & 1)) {
+                    continue;
+                }
+
+                BlockType currType = snap.getBlockAt(x, y, z);
+                glm::vec4 biomeWts = snap.getBiomeAt(x, z);
+
+                if (currType != EMPTY) {
+                    if (isHPlane(currType)) {
+                        for (const DirectionVector& dv : planeDirIter) {
+                            std::vector<Vertex> faceVerts;
+                            Chunk::createFaceVBOData(faceVerts, x, y, z, dv, currType, biomeWts);
+
+                            for (const Vertex& v : faceVerts) {
+                                tVertData.push_back(v);
+                            }
+
+                            tIndices.push_back(tVertCount);
+                            tIndices.push_back(tVertCount + 1);
+                            tIndices.push_back(tVertCount + 2);
+                            tIndices.push_back(tVertCount);
+                            tIndices.push_back(tVertCount + 2);
+                            tIndices.push_back(tVertCount + 3);
+
+                            tVertCount += 4;
                         }
                     }
 
                     if (isCross2(currType)) {
-                        // check if the block is exposed to air
-                        if (isVisible(x, y, z, currType)) {
-                            for (const DirectionVector& dv : cross2DirIter) {
-                                std::vector<Vertex> faceVerts;
-                                Chunk::createFaceVBOData(faceVerts, x, y, z, dv, currType, biomeWts);
-
-                                for (const Vertex& v : faceVerts) {
-                                    oVertData.push_back(v.position);
-                                    oVertData.push_back(v.normal);
-                                    oVertData.push_back(v.color);
-                                    oVertData.push_back(v.uvCoords);
-                                    oVertData.push_back(v.blockType);
-                                    oVertData.push_back(v.biomeWts);
-                                }
+                        for (const DirectionVector& dv : cross2DirIter) {
+                            std::vector<Vertex> faceVerts;
+                            Chunk::createFaceVBOData(faceVerts, x, y, z, dv, currType, biomeWts);
 
-                                oIndices.push_back(oVertCount);
-                                oIndices.push_back(oVertCount + 1);
-                                oIndices.push_back(oVertCount + 2);
-                                oIndices.push_back(oVertCount);
-                                oIndices.push_back(oVertCount + 2);
-                                oIndices.push_back(oVertCount + 3);
-
-                                oVertCount += 4;
+                            for (const Vertex& v : faceVerts) {
+                                oVertData.push_back(v);
                             }
+
+                            oIndices.push_back(oVertCount);
+                            oIndices.push_back(oVertCount + 1);
+                            oIndices.push_back(oVertCount + 2);
+                            oIndices.push_back(oVertCount);
+                            oIndices.push_back(oVertCount + 2);
+                            oIndices.push_back(oVertCount + 3);
+
+                            oVertCount += 4;
                         }
                     }
 
                     if (isCross4(currType)) {
-                        // check if the block is exposed to air
-                        if (isVisible(x, y, z, currType)) {
-                            for (const DirectionVector& dv : cross4DirIter) {
-                                std::vector<Vertex> faceVerts;
-                                Chunk::createFaceVBOData(faceVerts, x, y, z, dv, currType, biomeWts);
-
-                                for (const Vertex& v : faceVerts) {
-                                    oVertData.push_back(v.position);
-                                    oVertData.push_back(v.normal);
-                                    oVertData.push_back(v.color);
-                                    oVertData.push_back(v.uvCoords);
-                                    oVertData.push_back(v.blockType);
-                                    oVertData.push_back(v.biomeWts);
-                                }
+                        for (const DirectionVector& dv : cross4DirIter) {
+                            std::vector<Vertex> faceVerts;
+                            Chunk::createFaceVBOData(faceVerts, x, y, z, dv, currType, biomeWts);
 
-                                oIndices.push_back(oVertCount);
-                                oIndices.push_back(oVertCount + 1);
-                                oIndices.push_back(oVertCount + 2);
-                                oIndices.push_back(oVertCount);
-                                oIndices.push_back(oVertCount + 2);
-                                oIndices.push_back(oVertCount + 3);
-
-                                oIndices.push_back(oVertCount + 4);
-                                oIndices.push_back(oVertCount + 5);
-                                oIndices.push_back(oVertCount + 6);
-                                oIndices.push_back(oVertCount + 4);
-                                oIndices.push_back(oVertCount + 6);
-                                oIndices.push_back(oVertCount + 7);
-
-                                oVertCount += 8;
+                            for (const Vertex& v : faceVerts) {
+                                oVertData.push_back(v);
                             }
+
+                            oIndices.push_back(oVertCount);
+                            oIndices.push_back(oVertCount + 1);
+                            oIndices.push_back(oVertCount + 2);
+                            oIndices.push_back(oVertCount);
+                            oIndices.push_back(oVertCount + 2);
+                            oIndices.push_back(oVertCount + 3);
+
+                            oIndices.push_back(oVertCount + 4);
+                            oIndices.push_back(oVertCount + 5);
+                            oIndices.push_back(oVertCount + 6);
+                            oIndices.push_back(oVertCount + 4);
+                            oIndices.push_back(oVertCount + 6);
+                            oIndices.push_back(oVertCount + 7);
+
+                            oVertCount += 8;
                         }
                     }
 
+                    // handled all at once by generateGreedySectionVBOData below
+                    if (greedyMeshing && isUnitCube(currType)) {
+                        continue;
+                    }
+
                     if (isPartialX(currType) || isPartialY(currType) || isPartialZ(currType)) {
                         for (const DirectionVector& dv : directionIter) {
-                            if (isVisible(x, y, z, dv, currType)) {
+                            if ((exposed.faces[dv.dir][row] >> x) & 1) {
                                 if (!isTransparent(currType)) {
                                     std::vector<Vertex> faceVerts;
                                     Chunk::createFaceVBOData(faceVerts,
@@ -989,12 +1583,7 @@ void Chunk::createVBOdata()
                                                              biomeWts);
 
                                     for (const Vertex& v : faceVerts) {
-                                        oVertData.push_back(v.position);
-                                        oVertData.push_back(v.normal);
-                                        oVertData.push_back(v.color);
-                                        oVertData.push_back(v.uvCoords);
-                                        oVertData.push_back(v.blockType);
-                                        oVertData.push_back(v.biomeWts);
+                                        oVertData.push_back(v);
                                     }
 
                                     oIndices.push_back(oVertCount);
@@ -1016,12 +1605,7 @@ void Chunk::createVBOdata()
                                                              biomeWts);
 
                                     for (const Vertex& v : faceVerts) {
-                                        tVertData.push_back(v.position);
-                                        tVertData.push_back(v.normal);
-                                        tVertData.push_back(v.color);
-                                        tVertData.push_back(v.uvCoords);
-                                        tVertData.push_back(v.blockType);
-                                        tVertData.push_back(v.biomeWts);
+                                        tVertData.push_back(v);
                                     }
 
                                     tIndices.push_back(tVertCount);
@@ -1039,7 +1623,7 @@ void Chunk::createVBOdata()
 
                     if (isFullCube(currType)) {
                         for (const DirectionVector& dv : directionIter) {
-                            if (isVisible(x, y, z, dv, currType)) {
+                            if ((exposed.faces[dv.dir][row] >> x) & 1) {
                                 if (!isTransparent(currType)) {
                                     std::vector<Vertex> faceVerts;
                                     Chunk::createFaceVBOData(faceVerts,
@@ -1051,12 +1635,7 @@ void Chunk::createVBOdata()
                                                              biomeWts);
 
                                     for (const Vertex& v : faceVerts) {
-                                        oVertData.push_back(v.position);
-                                        oVertData.push_back(v.normal);
-                                        oVertData.push_back(v.color);
-                                        oVertData.push_back(v.uvCoords);
-                                        oVertData.push_back(v.blockType);
-                                        oVertData.push_back(v.biomeWts);
+                                        oVertData.push_back(v);
                                     }
 
                                     oIndices.push_back(oVertCount);
@@ -1078,12 +1657,7 @@ void Chunk::createVBOdata()
                                                              biomeWts);
 
                                     for (const Vertex& v : faceVerts) {
-                                        tVertData.push_back(v.position);
-                                        tVertData.push_back(v.normal);
-                                        tVertData.push_back(v.color);
-                                        tVertData.push_back(v.uvCoords);
-                                        tVertData.push_back(v.blockType);
-                                        tVertData.push_back(v.biomeWts);
+                                        tVertData.push_back(v);
                                     }
 
                                     tIndices.push_back(tVertCount);
@@ -1102,522 +1676,836 @@ void Chunk::createVBOdata()
         }
     }
 
-    m_oCount = oIndices.size();
-
-    generateOIdx();
-    mp_context->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_oBufIdx);
-    mp_context->glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                             oIndices.size() * sizeof(GLuint),
-                             oIndices.data(),
-                             GL_STATIC_DRAW);
-
-    generateOVertData();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufVertData);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             oVertData.size() * sizeof(glm::vec4),
-                             oVertData.data(),
-                             GL_STATIC_DRAW);
-
-    m_tCount = tIndices.size();
-
-    generateTIdx();
-    mp_context->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_tBufIdx);
-    mp_context->glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                             tIndices.size() * sizeof(GLuint),
-                             tIndices.data(),
-                             GL_STATIC_DRAW);
-
-    generateTVertData();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_tBufVertData);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             tVertData.size() * sizeof(glm::vec4),
-                             tVertData.data(),
-                             GL_STATIC_DRAW);
-
-    hasVBOData = true;
-    hasBinded = true;
-}
-
-void Chunk::redistributeVertexData(std::vector<glm::vec4> ovd,
-                                   std::vector<GLuint> oIndices,
-                                   std::vector<glm::vec4> tvd,
-                                   std::vector<GLuint> tIndices)
-{
-    std::vector<glm::vec4> o_positions;
-    std::vector<glm::vec4> o_normals;
-    std::vector<glm::vec4> o_colors;
-    std::vector<glm::vec4> o_uvs;
-    std::vector<glm::vec4> o_bts;
-    std::vector<glm::vec4> o_bWts;
-
-    std::vector<glm::vec4> t_positions;
-    std::vector<glm::vec4> t_normals;
-    std::vector<glm::vec4> t_colors;
-    std::vector<glm::vec4> t_uvs;
-    std::vector<glm::vec4> t_bts;
-    std::vector<glm::vec4> t_bWts;
-
-    for (int i = 0; i < (int)ovd.size(); i = i + 6) {
-        o_positions.push_back(ovd[i]);
-        o_normals.push_back(ovd[i + 1]);
-        o_colors.push_back(ovd[i + 2]);
-        o_uvs.push_back(ovd[i + 3]);
-        o_bts.push_back(ovd[i + 4]);
-        o_bWts.push_back(ovd[i + 5]);
-    }
-
-    for (int i = 0; i < (int)tvd.size(); i = i + 6) {
-        t_positions.push_back(tvd[i]);
-        t_normals.push_back(tvd[i + 1]);
-        t_colors.push_back(tvd[i + 2]);
-        t_uvs.push_back(tvd[i + 3]);
-        t_bts.push_back(tvd[i + 4]);
-        t_bWts.push_back(tvd[i + 5]);
-    }
-
-    m_oCount = oIndices.size();
-    generateOIdx();
-    mp_context->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_oBufIdx);
-    mp_context->glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                             oIndices.size() * sizeof(GLuint),
-                             oIndices.data(),
-                             GL_STATIC_DRAW);
-    generateOPos();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufPos);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             o_positions.size() * sizeof(glm::vec4),
-                             o_positions.data(),
-                             GL_STATIC_DRAW);
-    generateONor();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufNor);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             o_normals.size() * sizeof(glm::vec4),
-                             o_normals.data(),
-                             GL_STATIC_DRAW);
-    generateOCol();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufCol);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             o_colors.size() * sizeof(glm::vec4),
-                             o_colors.data(),
-                             GL_STATIC_DRAW);
-    generateOUVs();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufUVs);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             o_uvs.size() * sizeof(glm::vec4),
-                             o_uvs.data(),
-                             GL_STATIC_DRAW);
-    generateOBTs();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufBTs);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             o_bts.size() * sizeof(glm::vec4),
-                             o_bts.data(),
-                             GL_STATIC_DRAW);
-    generateOBWts();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufBWts);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             o_bWts.size() * sizeof(glm::vec4),
-                             o_bWts.data(),
-                             GL_STATIC_DRAW);
-
-    m_tCount = tIndices.size();
-    generateTIdx();
-    mp_context->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_tBufIdx);
-    mp_context->glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                             tIndices.size() * sizeof(GLuint),
-                             tIndices.data(),
-                             GL_STATIC_DRAW);
-    generateTPos();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_tBufPos);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             t_positions.size() * sizeof(glm::vec4),
-                             t_positions.data(),
-                             GL_STATIC_DRAW);
-    generateTNor();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_tBufNor);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             t_normals.size() * sizeof(glm::vec4),
-                             t_normals.data(),
-                             GL_STATIC_DRAW);
-    generateTCol();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufCol);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             t_colors.size() * sizeof(glm::vec4),
-                             t_colors.data(),
-                             GL_STATIC_DRAW);
-    generateTUVs();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufUVs);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             t_uvs.size() * sizeof(glm::vec4),
-                             t_uvs.data(),
-                             GL_STATIC_DRAW);
-    generateTBTs();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufBTs);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             t_bts.size() * sizeof(glm::vec4),
-                             t_bts.data(),
-                             GL_STATIC_DRAW);
-    generateTBWts();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_tBufBWts);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             t_bWts.size() * sizeof(glm::vec4),
-                             t_bWts.data(),
-                             GL_STATIC_DRAW);
-}
-
-void Chunk::create()
-{
-    loadVBO();
-}
-
-void Chunk::loadVBO()
-{
-    // opaque
-    std::vector<GLuint> oIndices = chunkVBOData.m_OIndexeData;
-    std::vector<glm::vec4> oVertData = chunkVBOData.m_OVertData;
-    // transparent
-    std::vector<GLuint> tIndices = chunkVBOData.m_TIndexData;
-    std::vector<glm::vec4> tVertData = chunkVBOData.m_TVertData;
-
-    m_oCount = oIndices.size();
-
-    generateOIdx();
-    mp_context->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_oBufIdx);
-    mp_context->glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                             oIndices.size() * sizeof(GLuint),
-                             oIndices.data(),
-                             GL_STATIC_DRAW);
-
-    generateOVertData();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_oBufVertData);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             oVertData.size() * sizeof(glm::vec4),
-                             oVertData.data(),
-                             GL_STATIC_DRAW);
-
-    m_tCount = tIndices.size();
-
-    generateTIdx();
-    mp_context->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_tBufIdx);
-    mp_context->glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                             tIndices.size() * sizeof(GLuint),
-                             tIndices.data(),
-                             GL_STATIC_DRAW);
-
-    generateTVertData();
-    mp_context->glBindBuffer(GL_ARRAY_BUFFER, m_tBufVertData);
-    mp_context->glBufferData(GL_ARRAY_BUFFER,
-                             tVertData.size() * sizeof(glm::vec4),
-                             tVertData.data(),
-                             GL_STATIC_DRAW);
-    //std::cout<<"I hath binded \n";
-    hasBinded = true;
-}
-
-void Chunk::generateVBOData()
+    if (greedyMeshing) {
+        generateGreedySectionVBOData(snap, s, exposed, mesh);
+    }
+}
+
+void Chunk::generateGreedySectionVBOData(const ChunkSnapshot& snap,
+                                         int s,
+                                         const ExposedFaces& exposed,
+                                         SectionVBOData& mesh)
 {
-    // opaque
-    std::vector<GLuint> oIndices = std::vector<GLuint>();
-    std::vector<glm::vec4> oVertData = std::vector<glm::vec4>();
-    // transparent
-    std::vector<GLuint> tIndices = std::vector<GLuint>();
-    std::vector<glm::vec4> tVertData = std::vector<glm::vec4>();
 
-    int oVertCount = 0;
-    int tVertCount = 0;
+    // One visible face in the slice currently being merged
+    struct FaceCell
+    {
+        BlockType type;
+        glm::vec4 biomeWts;
+    };
+    std::array<FaceCell, 256> mask;
 
-    for (int x = 0; x < 16; x++) {
-        for (int y = 0; y < 256; y++) {
-            for (int z = 0; z < 16; z++) {
-                BlockType currType = this->getBlockAt(x, y, z);
-                glm::vec4 biomeWts = this->getBiomeAt(x, z);
+    for (const DirectionVector& dv : directionIter) {
+        Direction d = dv.dir;
+
+        // the axis the faces point along, and the two axes spanning each slice
+        int n = (d == XPOS || d == XNEG) ? 0 : (d == YPOS || d == YNEG) ? 1 : 2;
+        int uAxis = n == 0 ? 2 : 0;
+        int vAxis = n == 1 ? 2 : 1;
+
+        for (int slice = 0; slice < 16; slice++) {
+            for (int v = 0; v < 16; v++) {
+                for (int u = 0; u < 16; u++) {
+                    glm::ivec3 pos;
+                    pos[n] = slice;
+                    pos[uAxis] = u;
+                    pos[vAxis] = v;
+                    pos.y += 16 * s;
+
+                    BlockType bt = snap.getBlockAt(pos.x, pos.y, pos.z);
+                    FaceCell& cell = mask[u + 16 * v];
+
+                    int row = (pos.y - 16 * s) * 16 + pos.z;
+                    if (isUnitCube(bt) && ((exposed.faces[d][row] >> pos.x) & 1)) {
+                        cell.type = bt;
+                        cell.biomeWts = snap.getBiomeAt(pos.x, pos.z);
+                    } else {
+                        cell.type = EMPTY;
+                    }
+                }
+            }
 
-                if (currType != EMPTY) {
-                    if (isHPlane(currType)) {
-                        if (isVisible(x, y, z, currType)) {
-                            for (const DirectionVector& dv : planeDirIter) {
-                                std::vector<Vertex> faceVerts;
-                                Chunk::createFaceVBOData(faceVerts, x, y, z, dv, currType, biomeWts);
-
-                                for (const Vertex& v : faceVerts) {
-                                    tVertData.push_back(v.position);
-                                    tVertData.push_back(v.normal);
-                                    tVertData.push_back(v.color);
-                                    tVertData.push_back(v.uvCoords);
-                                    tVertData.push_back(v.blockType);
-                                    tVertData.push_back(v.biomeWts);
-                                }
+            for (int v = 0; v < 16; v++) {
+                for (int u = 0; u < 16; u++) {
+                    FaceCell cell = mask[u + 16 * v];
+                    if (cell.type == EMPTY) {
+                        continue;
+                    }
 
-                                tIndices.push_back(tVertCount);
-                                tIndices.push_back(tVertCount + 1);
-                                tIndices.push_back(tVertCount + 2);
-                                tIndices.push_back(tVertCount);
-                                tIndices.push_back(tVertCount + 2);
-                                tIndices.push_back(tVertCount + 3);
+                    // Higher resolution textures span several atlas cells and can't be
+                    // wrapped per block, and tinted faces must agree on their biome colors
+                    const FaceUV& face = BlockUVTable::lookup(cell.type, d);
+                    bool canMerge = (face.flags & BlockUVTable::VALID)
+                                    && !(face.flags
+                                         & (BlockUVTable::DOUBLE_RES | BlockUVTable::TRIPLE_RES));
+                    bool tinted = face.texFlag == 1 || face.texFlag == 2;
+
+                    auto matches = [&](const FaceCell& other) {
+                        return other.type == cell.type
+                               && (!tinted || other.biomeWts == cell.biomeWts);
+                    };
+
+                    int w = 1;
+                    int h = 1;
+                    if (canMerge) {
+                        while (u + w < 16 && matches(mask[u + w + 16 * v])) {
+                            w++;
+                        }
 
-                                tVertCount += 4;
+                        bool rowMatches = true;
+                        while (v + h < 16 && rowMatches) {
+                            for (int k = 0; k < w; k++) {
+                                if (!matches(mask[u + k + 16 * (v + h)])) {
+                                    rowMatches = false;
+                                    break;
+                                }
+                            }
+                            if (rowMatches) {
+                                h++;
                             }
                         }
                     }
 
-                    if (isCross2(currType)) {
-                        // check if the block is exposed to air
-                        if (isVisible(x, y, z, currType)) {
-                            for (const DirectionVector& dv : cross2DirIter) {
-                                std::vector<Vertex> faceVerts;
-                                Chunk::createFaceVBOData(faceVerts, x, y, z, dv, currType, biomeWts);
-
-                                for (const Vertex& v : faceVerts) {
-                                    oVertData.push_back(v.position);
-                                    oVertData.push_back(v.normal);
-                                    oVertData.push_back(v.color);
-                                    oVertData.push_back(v.uvCoords);
-                                    oVertData.push_back(v.blockType);
-                                    oVertData.push_back(v.biomeWts);
-                                }
-
-                                oIndices.push_back(oVertCount);
-                                oIndices.push_back(oVertCount + 1);
-                                oIndices.push_back(oVertCount + 2);
-                                oIndices.push_back(oVertCount);
-                                oIndices.push_back(oVertCount + 2);
-                                oIndices.push_back(oVertCount + 3);
-
-                                oVertCount += 4;
-                            }
+                    for (int j = 0; j < h; j++) {
+                        for (int k = 0; k < w; k++) {
+                            mask[u + k + 16 * (v + j)].type = EMPTY;
                         }
                     }
 
-                    if (isCross4(currType)) {
-                        // check if the block is exposed to air
-                        if (isVisible(x, y, z, currType)) {
-                            for (const DirectionVector& dv : cross4DirIter) {
-                                std::vector<Vertex> faceVerts;
-                                Chunk::createFaceVBOData(faceVerts, x, y, z, dv, currType, biomeWts);
-
-                                for (const Vertex& v : faceVerts) {
-                                    oVertData.push_back(v.position);
-                                    oVertData.push_back(v.normal);
-                                    oVertData.push_back(v.color);
-                                    oVertData.push_back(v.uvCoords);
-                                    oVertData.push_back(v.blockType);
-                                    oVertData.push_back(v.biomeWts);
-                                }
+                    glm::ivec3 min;
+                    min[n] = slice;
+                    min[uAxis] = u;
+                    min[vAxis] = v;
+                    min.y += 16 * s;
+
+                    // a lone face is emitted exactly as the per-block path would
+                    std::vector<Vertex> faceVerts;
+                    if (w == 1 && h == 1) {
+                        Chunk::createFaceVBOData(faceVerts,
+                                                 min.x,
+                                                 min.y,
+                                                 min.z,
+                                                 dv,
+                                                 cell.type,
+                                                 cell.biomeWts);
+                    } else {
+                        glm::ivec3 max = min;
+                        max[n] += 1;
+                        max[uAxis] += w;
+                        max[vAxis] += h;
+                        Chunk::createGreedyFaceVBOData(faceVerts,
+                                                       min,
+                                                       max,
+                                                       dv,
+                                                       cell.type,
+                                                       cell.biomeWts);
+                    }
 
-                                oIndices.push_back(oVertCount);
-                                oIndices.push_back(oVertCount + 1);
-                                oIndices.push_back(oVertCount + 2);
-                                oIndices.push_back(oVertCount);
-                                oIndices.push_back(oVertCount + 2);
-                                oIndices.push_back(oVertCount + 3);
-
-                                oIndices.push_back(oVertCount + 4);
-                                oIndices.push_back(oVertCount + 5);
-                                oIndices.push_back(oVertCount + 6);
-                                oIndices.push_back(oVertCount + 4);
-                                oIndices.push_back(oVertCount + 6);
-                                oIndices.push_back(oVertCount + 7);
-
-                                oVertCount += 8;
-                            }
-                        }
+                    bool transparent = isTransparent(cell.type);
+                    std::vector<Vertex>& vertData = transparent ? mesh.m_TVertData
+                                                                   : mesh.m_OVertData;
+                    std::vector<GLuint>& indices = transparent ? mesh.m_TIndexData
+                                                               : mesh.m_OIndexeData;
+                    GLuint vertCount = vertData.size();
+
+                    for (const Vertex& vert : faceVerts) {
+                        vertData.push_back(vert);
                     }
 
-                    if (isPartialX(currType) || isPartialY(currType) || isPartialZ(currType)) {
-                        for (const DirectionVector& dv : directionIter) {
-                            if (isVisible(x, y, z, dv, currType)) {
-                                if (!isTransparent(currType)) {
-                                    std::vector<Vertex> faceVerts;
-                                    Chunk::createFaceVBOData(faceVerts,
-                                                             x,
-                                                             y,
-                                                             z,
-                                                             dv,
-                                                             currType,
-                                                             biomeWts);
+                    indices.push_back(vertCount);
+                    indices.push_back(vertCount + 1);
+                    indices.push_back(vertCount + 2);
+                    indices.push_back(vertCount);
+                    indices.push_back(vertCount + 2);
+                    indices.push_back(vertCount + 3);
+                }
+            }
+        }
+    }
+}
 
-                                    for (const Vertex& v : faceVerts) {
-                                        oVertData.push_back(v.position);
-                                        oVertData.push_back(v.normal);
-                                        oVertData.push_back(v.color);
-                                        oVertData.push_back(v.uvCoords);
-                                        oVertData.push_back(v.blockType);
-                                        oVertData.push_back(v.biomeWts);
-                                    }
+void Chunk::generateVBOData(ChunkVBOData& out)
+{
+    // Read before the snapshot, so that an edit made while we mesh makes this mesh stale
+    out.chunk = this;
+    out.epoch = m_editEpoch.load();
+
+    // Re-mesh only the sections whose blocks (or whose neighbors' border blocks)
+    // changed since they were last meshed. The flags are cleared before the snapshot, so
+    // a block written after it leaves its section dirty for the next mesh. Clearing them
+    // also claims the sections, so no other generateVBOData meshes them at the same time.
+    out.meshed = 0;
+    for (int s = 0; s < 16; s++) {
+        if (m_sections[s].dirty.exchange(false)) {
+            out.meshed |= 1 << s;
+        }
+    }
 
-                                    oIndices.push_back(oVertCount);
-                                    oIndices.push_back(oVertCount + 1);
-                                    oIndices.push_back(oVertCount + 2);
-                                    oIndices.push_back(oVertCount);
-                                    oIndices.push_back(oVertCount + 2);
-                                    oIndices.push_back(oVertCount + 3);
+    // Mesh from a private copy of our blocks and our neighbors' borders,
+    // so generation workers can keep writing while we read
+    ChunkSnapshot snap;
+    takeSnapshot(snap);
 
-                                    oVertCount += 4;
-                                } else {
-                                    std::vector<Vertex> faceVerts;
-                                    Chunk::createFaceVBOData(faceVerts,
-                                                             x,
-                                                             y,
-                                                             z,
-                                                             dv,
-                                                             currType,
-                                                             biomeWts);
+    // All-air sections and sections buried under solid ground can't produce any faces,
+    // so they're skipped outright, leaving their meshes empty
+    std::vector<int> toMesh;
+    for (int s = 0; s < 16; s++) {
+        if (!((out.meshed >> s) & 1)) {
+            continue;
+        }
 
-                                    for (const Vertex& v : faceVerts) {
-                                        tVertData.push_back(v.position);
-                                        tVertData.push_back(v.normal);
-                                        tVertData.push_back(v.color);
-                                        tVertData.push_back(v.uvCoords);
-                                        tVertData.push_back(v.blockType);
-                                        tVertData.push_back(v.biomeWts);
-                                    }
+        m_blocksLock.lock();
+        bool empty = m_sections[s].isEmpty();
+        m_blocksLock.unlock();
+        if (!empty && !isSectionBuried(s)) {
+            toMesh.push_back(s);
+        }
+    }
 
-                                    tIndices.push_back(tVertCount);
-                                    tIndices.push_back(tVertCount + 1);
-                                    tIndices.push_back(tVertCount + 2);
-                                    tIndices.push_back(tVertCount);
-                                    tIndices.push_back(tVertCount + 2);
-                                    tIndices.push_back(tVertCount + 3);
+    // Sections only write their own meshes, so on a worker thread they're meshed
+    // as separate tasks. On the GL thread (createVBOdata) they're meshed in turn.
+    JobSystem& jobs = JobSystem::instance();
+    if (jobs.isWorkerThread() && toMesh.size() > 1) {
+        jobs.parallelFor(toMesh.size(), [&](int i) {
+            generateSectionVBOData(snap, toMesh[i], out.sections[toMesh[i]]);
+        });
+    } else {
+        for (int s : toMesh) {
+            generateSectionVBOData(snap, s, out.sections[s]);
+        }
+    }
+}
 
-                                    tVertCount += 4;
-                                }
-                            }
-                        }
-                    }
+ChunkState Chunk::getState() const
+{
+    return m_state.load();
+}
 
-                    if (isFullCube(currType)) {
-                        for (const DirectionVector& dv : directionIter) {
-                            if (isVisible(x, y, z, dv, currType)) {
-                                if (!isTransparent(currType)) {
-                                    std::vector<Vertex> faceVerts;
-                                    Chunk::createFaceVBOData(faceVerts,
-                                                             x,
-                                                             y,
-                                                             z,
-                                                             dv,
-                                                             currType,
-                                                             biomeWts);
+void Chunk::setState(ChunkState s)
+{
+    m_state.store(s);
+}
 
-                                    for (const Vertex& v : faceVerts) {
-                                        oVertData.push_back(v.position);
-                                        oVertData.push_back(v.normal);
-                                        oVertData.push_back(v.color);
-                                        oVertData.push_back(v.uvCoords);
-                                        oVertData.push_back(v.blockType);
-                                        oVertData.push_back(v.biomeWts);
-                                    }
+bool Chunk::transitionState(ChunkState from, ChunkState to)
+{
+    return m_state.compare_exchange_strong(from, to);
+}
 
-                                    oIndices.push_back(oVertCount);
-                                    oIndices.push_back(oVertCount + 1);
-                                    oIndices.push_back(oVertCount + 2);
-                                    oIndices.push_back(oVertCount);
-                                    oIndices.push_back(oVertCount + 2);
-                                    oIndices.push_back(oVertCount + 3);
+uint32_t Chunk::getEditEpoch() const
+{
+    return m_editEpoch.load();
+}
 
-                                    oVertCount += 4;
-                                } else {
-                                    std::vector<Vertex> faceVerts;
-                                    Chunk::createFaceVBOData(faceVerts,
-                                                             x,
-                                                             y,
-                                                             z,
-                                                             dv,
-                                                             currType,
-                                                             biomeWts);
+void Chunk::markEdited()
+{
+    m_editEpoch++;
+    transitionState(ChunkState::UPLOADED, ChunkState::DIRTY);
+}
+
+bool Chunk::isUploadCurrent() const
+{
+    return m_uploadedEpoch == m_editEpoch.load();
+}
+
+void Chunk::setWorldPos(int x, int z)
+{
+    int x_floor = static_cast<int>(glm::floor(x / 16.f));
+    int z_floor = static_cast<int>(glm::floor(z / 16.f));
+    worldPos_x = 16 * x_floor;
+    worldPos_z = 16 * z_floor;
+}
+
+glm::ivec2 Chunk::getWorldPos()
+{
+    return glm::ivec2(worldPos_x, worldPos_z);
+}
+
+// Picks the biome at a column from the fbm noise of helperCreate's grids, and blends the four
+// biomes' heights there by weights, which it fills in
+static std::pair<float, BiomeEnum> blendBiomes(float elevationNoise,
+                                               float temperatureNoise,
+                                               float mountH,
+                                               float hillH,
+                                               float forestH,
+                                               float islandH,
+                                               glm::vec4& weights)
+{
+    // perform bilinear interpolation
+
+    BiomeEnum b;
+
+    //    double elev = std::clamp((Biome::perlin1(worldXZ / 237.f) + 1.f) / 2.f, 0.f, 1.f); // remap perlin noise from (-1, 1) to (0, 1)
+    //    double temp = std::clamp((Biome::perlin2(worldXZ / 189.f) + 1.f) / 2.f, 0.f, 1.f);
+    double elev = std::clamp(elevationNoise, 0.f, 1.f);  // fbm(worldXZ / 237)
+    double temp = std::clamp(temperatureNoise, 0.f, 1.f);  // fbm(worldXZ / 189)
+
+    //    std::cout<<elev<<","<<temp<<std::endl;
+
+    if (elev >= 0.5 && temp < 0.5) {
+        b = MOUNTAINS;
+    } else if (elev >= 0.5 && temp >= 0.5) {
+        b = HILLS;
+    } else if (elev < 0.5 && temp < 0.5) {
+        b = FOREST;
+    } else {
+        b = ISLANDS;
+    }
+
+    weights.x = elev * (1.f - temp);
+    weights.y = elev * temp;
+    weights.z = (1.f - elev) * (1.f - temp);
+    weights.w = (1.f - elev) * temp;
+
+    //    std::cout<<"("<<weights.x<<","<<weights.y<<","<<weights.z<<","<<weights.w<<")"<<std::endl;
+    //    if (weights.x + weights.y + weights.z + weights.w > 1.00001 || weights.x + weights.y + weights.z + weights.w < 0.99999) {
+    //        std::cout << "something is wrong" << std::endl;
+    //    }
+
+    float h = (weights.x * mountH) + (weights.y * hillH) + (weights.z * forestH)
+              + (weights.w * islandH);
+    return std::pair(h, b);
+}
+
+// What ColumnNoiseCache keeps of a Chunk's surface: the height helperCreate gives each of its
+// columns, indexed by x + 16 * z, followed by their biomes from SURFACE_BIOMES on
+static constexpr int SURFACE_BIOMES = 256;
+
+// The surface of the Chunk at origin, from the cache if it's there
+static void surfaceOf(glm::ivec2 origin, uint32_t seed, std::vector<float>& out)
+{
+    ColumnNoiseCache& cache = ColumnNoiseCache::instance();
+    if (cache.find(ColumnNoise::SURFACE, seed, origin.x, origin.y, out)) {
+        return;
+    }
+
+    glm::vec2 corner(origin);
+    std::array<float, 256> mountainsH, hillsH, forestH, islandsH, elevation, temperature;
+    Biome::mountainsGrid(corner, 16, 16, mountainsH.data(), seed);
+    Biome::hillsGrid(corner, 16, 16, hillsH.data(), seed);
+    Biome::forestGrid(corner, 16, 16, forestH.data(), seed);
+    Biome::islandsGrid(corner, 16, 16, islandsH.data(), seed);
+    Biome::fbmGrid(corner, 16, 16, 237.f, elevation.data(), seed);
+    Biome::fbmGrid(corner, 16, 16, 189.f, temperature.data(), seed);
+
+    out.resize(2 * SURFACE_BIOMES);
+    glm::vec4 weights;
+    for (int column = 0; column < 256; column++) {
+        std::pair<float, BiomeEnum> hb = blendBiomes(elevation[column],
+                                                     temperature[column],
+                                                     mountainsH[column],
+                                                     hillsH[column],
+                                                     forestH[column],
+                                                     islandsH[column],
+                                                     weights);
+        out[column] = hb.first;
+        out[SURFACE_BIOMES + column] = hb.second;
+    }
+    cache.insert(ColumnNoise::SURFACE, seed, origin.x, origin.y, out);
+}
+
+// The height and biome helperCreate gives the column at world (x, z), one column at a time
+static std::pair<float, BiomeEnum> columnSurface(int worldX, int worldZ, uint32_t seed)
+{
+    glm::vec2 p(worldX, worldZ);
+    glm::vec4 weights;
+    return blendBiomes(Biome::fbm(p / 237.f, seed),
+                       Biome::fbm(p / 189.f, seed),
+                       Biome::mountains(p, seed),
+                       Biome::hills(p, seed),
+                       Biome::forest(p, seed),
+                       Biome::islands(p, seed),
+                       weights);
+}
+
+// Whether helperCreate leaves the block on top of a column of height h open to grow things
+// on: EMPTY, or the thinnest layer of snow. x and z are local, as the snow's noise takes them.
+static bool hasOpenTop(BiomeEnum b, float h, int x, int z, uint32_t seed)
+{
+    if (int(h) > 255) {
+        return true;  // above the Chunk, where every block reads as EMPTY
+    }
+    switch (b) {
+    case MOUNTAINS:
+        return h >= 120 && Biome::noise1D(glm::vec3(x, h, z), seed) < 0.5;
+    case HILLS:
+        return h >= 120 && h <= 130;  // above that the hills are farmed
+    case FOREST:
+    case ISLANDS:
+        return h >= 120;
+    default:
+        return false;
+    }
+}
+
+// How high each stage of the bamboo stalk growing up from y in a column reaches: BAMBOO_1
+// fills the column up to the first, exclusive, BAMBOO_2 up to the second and BAMBOO_3 up to
+// the third
+static std::array<int, 3> bambooStalk(int worldX, int y, int worldZ, uint32_t seed)
+{
+    std::array<int, 3> ends;
+    do {
+        y++;
+    } while (Biome::noise1D(glm::vec3(worldX, y + 1, worldZ), seed) < 0.75);
+    ends[0] = y;
+    do {
+        y++;
+    } while (Biome::noise1D(glm::vec3(worldX, y, worldZ), seed) < 0.5);
+    ends[1] = y;
+    do {
+        y++;
+    } while (Biome::noise1D(glm::vec3(worldX, y, worldZ), seed) < 0.25);
+    ends[2] = y;
+    return ends;
+}
+
+// The kinds of site a structure grows from, in the order placeStructures builds them
+enum class SiteKind : unsigned char {
+    HUT,
+    WISTERIA,
+    CEDAR,
+    TEAK,
+    COTTAGE,
+    CHERRY,
+    TEA_HOUSE,
+    PINE,
+    MAPLE
+};
+
+// What ColumnNoiseCache keeps of each site on a Chunk: its kind, then its x, y and z, with x and
+// z local to the Chunk. Sites on the surface keep the fraction of its height, which the noise
+// picking what grows there takes.
+static constexpr int SITE_SIZE = 4;
+
+static ColumnNoise sitesKind(CaveQuality quality)
+{
+    switch (quality) {
+    case CaveQuality::FULL:
+        return ColumnNoise::SITES_FULL;
+    case CaveQuality::MEDIUM:
+        return ColumnNoise::SITES_MEDIUM;
+    default:
+        return ColumnNoise::SITES_COARSE;
+    }
+}
+
+// Finds where structures grow on the Chunk at origin, with its caves at quality
+static void findSites(glm::ivec2 origin,
+                      uint32_t seed,
+                      CaveQuality quality,
+                      std::vector<float>& out)
+{
+    out.clear();
+    std::vector<float> caves;
+    auto addSite = [&](SiteKind kind, int x, float y, int z) {
+        out.insert(out.end(), {float(kind), float(x), y, float(z)});
+    };
+
+    for (int x = 0; x < 16; ++x) {
+        for (int z = 0; z < 16; ++z) {
+            int worldX = origin.x + x;
+            int worldZ = origin.y + z;
+
+            // Structures grow at the points of Voronoi cells, whose size sets how sparse they
+            // are, so most columns are ruled out before their surface is worked out
+            glm::vec2 jitter = Biome::voronoiJitter(glm::vec2(worldX, worldZ), seed);
+            glm::vec2 wTree = Biome::voronoi(glm::vec2(worldX, worldZ), jitter, 5);
+            glm::vec2 wSparseTree = Biome::voronoi(glm::vec2(worldX, worldZ), jitter, 12);
+            glm::vec2 wHouse = Biome::voronoi(glm::vec2(worldX, worldZ), jitter, 107);
+            bool tree = worldX == wTree.x && worldZ == wTree.y;
+            bool sparseTree = worldX == wSparseTree.x && worldZ == wSparseTree.y;
+            bool house = worldX == wHouse.x && worldZ == wHouse.y;
+            if (!tree && !sparseTree && !house) {
+                continue;
+            }
 
-                                    for (const Vertex& v : faceVerts) {
-                                        tVertData.push_back(v.position);
-                                        tVertData.push_back(v.normal);
-                                        tVertData.push_back(v.color);
-                                        tVertData.push_back(v.uvCoords);
-                                        tVertData.push_back(v.blockType);
-                                        tVertData.push_back(v.biomeWts);
-                                    }
+            std::pair<float, BiomeEnum> hb = columnSurface(worldX, worldZ, seed);
+            float h = hb.first;
+            BiomeEnum b = hb.second;
+            float p1 = Biome::noise1D(glm::vec2(worldX, worldZ), seed);
 
-                                    tIndices.push_back(tVertCount);
-                                    tIndices.push_back(tVertCount + 1);
-                                    tIndices.push_back(tVertCount + 2);
-                                    tIndices.push_back(tVertCount);
-                                    tIndices.push_back(tVertCount + 2);
-                                    tIndices.push_back(tVertCount + 3);
-                                    tVertCount += 4;
-                                }
-                            }
+            if (hasOpenTop(b, h, x, z, seed)) {
+                if (b == MOUNTAINS && h > 130) {
+                    if (tree && p1 < 0.175) {
+                        addSite(SiteKind::CEDAR, x, h, z);
+                    } else if (tree && p1 < 0.225) {
+                        addSite(SiteKind::TEAK, x, h, z);
+                    }
+                    if (house) {
+                        addSite(SiteKind::COTTAGE, x, h, z);
+                    }
+                } else if (b == FOREST) {
+                    if (sparseTree) {
+                        addSite(SiteKind::CHERRY, x, h, z);
+                    }
+                    if (house && p1 > 0.75) {
+                        addSite(SiteKind::TEA_HOUSE, x, h, z);
+                    }
+                } else if (b == HILLS) {
+                    if (house && Biome::noise1D(glm::vec3(worldX, h, worldZ), seed) < 0.2) {
+                        addSite(SiteKind::HUT, x, h, z);
+                    }
+                } else if (b == ISLANDS && tree) {
+                    addSite(p1 < 0.2 ? SiteKind::PINE : SiteKind::MAPLE, x, h, z);
+                }
+            }
+
+            // Wisteria grow on the floors of caves, where helperCreate puts no other plant
+            if (!tree) {
+                continue;
+            }
+            CaveField::column(worldX, worldZ, seed, quality, &ColumnNoiseCache::instance(), caves);
+            bool prevNotGround = false;
+            for (int y = CaveField::MIN_Y; y <= CaveField::MAX_Y; y++) {
+                if (caves[y - CaveField::MIN_Y] >= CaveField::THRESHOLD) {
+                    prevNotGround = false;
+                } else if (y >= 25) {
+                    if (!prevNotGround) {
+                        float p3 = Biome::noise1D(glm::vec3(worldX, y, worldZ), seed);
+                        if (p3 >= 0.1 && p3 < 0.1075) {
+                            addSite(SiteKind::WISTERIA, x, y, z);
                         }
                     }
+                    prevNotGround = true;
                 }
             }
         }
     }
+}
+
+// The sites on the Chunk at origin, from the cache if they're there
+static void sitesOf(glm::ivec2 origin, uint32_t seed, CaveQuality quality, std::vector<float>& out)
+{
+    ColumnNoiseCache& cache = ColumnNoiseCache::instance();
+    ColumnNoise kind = sitesKind(quality);
+    if (cache.find(kind, seed, origin.x, origin.y, out)) {
+        return;
+    }
 
-    hasVBOData = true;
+    findSites(origin, seed, quality, out);
+    cache.insert(kind, seed, origin.x, origin.y, out);
+}
 
-    chunkVBOData.m_OIndexeData = oIndices;
-    chunkVBOData.m_OVertData = oVertData;
+// The shapes placeStructures builds, one per create function and rotation
+enum class StructureShape : unsigned char {
+    TORII_X,
+    TORII_Z,
+    HUT,
+    COTTAGE_1,
+    COTTAGE_2,
+    TEA_HOUSE,
+    CONIFER_1,
+    CONIFER_2,
+    CONIFER_3,
+    DECIDUOUS_1,
+    DECIDUOUS_2,
+    DECIDUOUS_3
+};
+
+// The box of blocks a shape's create function can write, relative to the position it's given.
+// Trees also need room to grow: no terrain in the box above their position up to room blocks
+// high, across their whole width. Houses and torii gates are built wherever they're sited.
+struct ShapeExtent
+{
+    glm::ivec3 min, max;
+    int room;  // 0 for anything but a tree
+    bool growsOverShoots;  // whether the tree may grow over the youngest bamboo, BAMBOO_1
+};
+
+static const ShapeExtent SHAPE_EXTENTS[] = {
+    {glm::ivec3(-2, 0, 0), glm::ivec3(8, 9, 0), 0, false},      // TORII_X
+    {glm::ivec3(0, 0, -2), glm::ivec3(0, 9, 8), 0, false},      // TORII_Z
+    {glm::ivec3(-3, 0, -2), glm::ivec3(11, 13, 10), 0, false},  // HUT
+    {glm::ivec3(-1, -1, -2), glm::ivec3(11, 10, 9), 0, false},  // COTTAGE_1
+    {glm::ivec3(-2, -4, -2), glm::ivec3(12, 15, 11), 0, false}, // COTTAGE_2
+    {glm::ivec3(-2, 0, -2), glm::ivec3(16, 15, 11), 0, false},  // TEA_HOUSE
+    {glm::ivec3(-3, 0, -3), glm::ivec3(3, 7, 3), 7, false},     // CONIFER_1
+    {glm::ivec3(-2, 0, -2), glm::ivec3(2, 9, 2), 9, false},     // CONIFER_2
+    {glm::ivec3(-2, 0, -2), glm::ivec3(2, 6, 2), 6, false},     // CONIFER_3
+    {glm::ivec3(-2, 0, -2), glm::ivec3(2, 6, 2), 6, true},      // DECIDUOUS_1
+    {glm::ivec3(-3, 0, -3), glm::ivec3(3, 5, 3), 6, true},      // DECIDUOUS_2
+    {glm::ivec3(-2, 0, -2), glm::ivec3(2, 3, 2), 4, true},      // DECIDUOUS_3
+};
+
+// A structure that might reach into the Chunk placeStructures is building
+struct PlannedStructure
+{
+    SiteKind site;
+    StructureShape shape;
+    glm::ivec3 pos;  // what its create function is given, in world coordinates
+    BlockType leaf, wood;  // for trees
+
+    const ShapeExtent& extent() const
+    {
+        return SHAPE_EXTENTS[static_cast<int>(shape)];
+    }
+};
+
+// What grows from a site on the Chunk at origin, if anything: noise picks between the variants
+// of the site's kind
+static bool planStructure(glm::ivec2 origin,
+                          const float* site,
+                          uint32_t seed,
+                          PlannedStructure& out)
+{
+    SiteKind kind = SiteKind(site[0]);
+    int x = site[1];
+    float h = site[2];
+    int z = site[3];
+    int worldX = origin.x + x;
+    int worldZ = origin.y + z;
+    // most of the variants are picked by noise at the site's local coordinates
+    float p3 = Biome::noise1D(glm::vec3(x, h, z), seed);
+
+    out.site = kind;
+    out.pos = glm::ivec3(worldX, int(h), worldZ);
+    out.leaf = EMPTY;
+    out.wood = EMPTY;
+    auto tree = [&](StructureShape shape, BlockType leaf, BlockType wood) {
+        out.shape = shape;
+        out.leaf = leaf;
+        out.wood = wood;
+        return true;
+    };
 
-    chunkVBOData.m_TIndexData = tIndices;
-    chunkVBOData.m_TVertData = tVertData;
+    switch (kind) {
+    case SiteKind::HUT:
+        out.shape = StructureShape::HUT;
+        return true;
+    case SiteKind::WISTERIA: {
+        float p4 = Biome::noise1D(glm::vec2(worldX, worldZ), seed);
+        if (p4 < 0.2) {
+            return tree(StructureShape::DECIDUOUS_3, WISTERIA_BLOSSOMS_1, WISTERIA_WOOD_Y);
+        } else if (p4 < 0.4) {
+            return tree(StructureShape::DECIDUOUS_2, WISTERIA_BLOSSOMS_2, WISTERIA_WOOD_Y);
+        }
+        return tree(StructureShape::DECIDUOUS_1, WISTERIA_BLOSSOMS_3, WISTERIA_WOOD_Y);
+    }
+    case SiteKind::CEDAR:
+        return tree(StructureShape::CONIFER_1, CEDAR_LEAVES, CEDAR_WOOD_Y);
+    case SiteKind::TEAK:
+        return tree(StructureShape::CONIFER_2, TEAK_LEAVES, TEAK_WOOD_Y);
+    case SiteKind::COTTAGE:
+        if (p3 < 0.2) {
+            out.shape = StructureShape::COTTAGE_1;
+            return true;
+        } else if (p3 < 0.4) {
+            out.shape = StructureShape::COTTAGE_2;
+            out.pos.y += 3;
+            return true;
+        }
+        return false;
+    case SiteKind::CHERRY:
+        if (p3 < 0.05) {
+            return tree(StructureShape::DECIDUOUS_2, CHERRY_BLOSSOMS_1, CHERRY_WOOD_Y);
+        } else if (p3 < 0.055) {
+            return tree(StructureShape::DECIDUOUS_3, CHERRY_BLOSSOMS_2, CHERRY_WOOD_Y);
+        } else if (p3 < 0.06) {
+            return tree(StructureShape::DECIDUOUS_3, CHERRY_BLOSSOMS_3, CHERRY_WOOD_Y);
+        } else if (p3 < 0.065) {
+            return tree(StructureShape::DECIDUOUS_1, CHERRY_BLOSSOMS_4, CHERRY_WOOD_Y);
+        } else if (p3 < 0.066) {
+            out.shape = StructureShape::TORII_X;
+            return true;
+        } else if (p3 < 0.067) {
+            out.shape = StructureShape::TORII_Z;
+            return true;
+        }
+        return false;
+    case SiteKind::TEA_HOUSE:
+        out.shape = StructureShape::TEA_HOUSE;
+        return true;
+    case SiteKind::PINE:
+        return tree(StructureShape::CONIFER_3, PINE_LEAVES, PINE_WOOD_Y);
+    case SiteKind::MAPLE:
+        if (p3 < 0.2) {
+            return tree(StructureShape::DECIDUOUS_2, MAPLE_LEAVES_1, MAPLE_WOOD_Y);
+        } else if (p3 < 0.4) {
+            return tree(StructureShape::DECIDUOUS_3, MAPLE_LEAVES_2, MAPLE_WOOD_Y);
+        } else if (p3 < 0.6) {
+            return tree(StructureShape::DECIDUOUS_1, MAPLE_LEAVES_3, MAPLE_WOOD_Y);
+        }
+        return false;
+    }
+    return false;
 }
 
-void Chunk::setWorldPos(int x, int z)
+static bool boxesOverlap(glm::ivec3 minA, glm::ivec3 maxA, glm::ivec3 minB, glm::ivec3 maxB)
 {
-    int x_floor = static_cast<int>(glm::floor(x / 16.f));
-    int z_floor = static_cast<int>(glm::floor(z / 16.f));
-    worldPos_x = 16 * x_floor;
-    worldPos_z = 16 * z_floor;
+    return glm::all(glm::lessThanEqual(minA, maxB)) && glm::all(glm::lessThanEqual(minB, maxA));
 }
 
-glm::ivec2 Chunk::getWorldPos()
+// The terrain of the Chunks around the one placeStructures is building, as helperCreate
+// generates it, for telling whether trees have room to grow without reading any Chunk's blocks.
+// Each Chunk's surface, and each column's caves, are only worked out once they're needed.
+class SiteTerrain
 {
-    return glm::ivec2(worldPos_x, worldPos_z);
+public:
+    SiteTerrain(uint32_t seed, CaveQuality quality)
+        : m_seed(seed)
+        , m_quality(quality)
+        , m_surfaces()
+        , m_caves()
+    {}
+
+    // Whether the terrain leaves the column at world (x, z) open from yMin up to yMax:
+    // above the ground and out of the water, or in a cave, and clear of bamboo
+    bool isClear(int worldX, int worldZ, int yMin, int yMax, bool overShoots)
+    {
+        glm::ivec2 origin(worldX & ~15, worldZ & ~15);
+        int x = worldX & 15;
+        int z = worldZ & 15;
+        const std::vector<float>& surface = surfaceAt(origin);
+        float h = surface[x + 16 * z];
+        BiomeEnum b = BiomeEnum(surface[SURFACE_BIOMES + x + 16 * z]);
+        int top = h;
+        bool openTop = hasOpenTop(b, h, x, z, m_seed);
+
+        for (int y = yMin; y <= yMax; y++) {
+            bool open;
+            if (y > top) {
+                open = h >= 120 || y >= 120;  // lakes fill up to 120
+            } else if (y == top) {
+                open = openTop;
+            } else {
+                open = y >= 25 && y <= CaveField::MAX_Y
+                       && cavesAt(worldX, worldZ)[y - CaveField::MIN_Y] < CaveField::THRESHOLD;
+            }
+            if (!open) {
+                return false;
+            }
+        }
+
+        if (openTop && b == FOREST && Biome::noise1D(glm::vec2(worldX, worldZ), m_seed) < 0.04) {
+            std::array<int, 3> stalk = bambooStalk(worldX, top, worldZ, m_seed);
+            int bottom = overShoots ? stalk[0] : top;
+            return bottom > yMax || stalk[2] <= yMin;
+        }
+        return true;
+    }
+
+private:
+    uint32_t m_seed;
+    CaveQuality m_quality;
+    std::unordered_map<int64_t, std::vector<float>> m_surfaces;
+    std::unordered_map<int64_t, std::vector<float>> m_caves;
+
+    static int64_t key(int x, int z)
+    {
+        return int64_t(x) << 32 | uint32_t(z);
+    }
+
+    const std::vector<float>& surfaceAt(glm::ivec2 origin)
+    {
+        auto it = m_surfaces.find(key(origin.x, origin.y));
+        if (it == m_surfaces.end()) {
+            it = m_surfaces.emplace(key(origin.x, origin.y), std::vector<float>()).first;
+            surfaceOf(origin, m_seed, it->second);
+        }
+        return it->second;
+    }
+
+    // The cave density down a column, indexed by y - CaveField::MIN_Y
+    const std::vector<float>& cavesAt(int worldX, int worldZ)
+    {
+        auto it = m_caves.find(key(worldX, worldZ));
+        if (it == m_caves.end()) {
+            it = m_caves.emplace(key(worldX, worldZ), std::vector<float>()).first;
+            CaveField::column(worldX,
+                              worldZ,
+                              m_seed,
+                              m_quality,
+                              &ColumnNoiseCache::instance(),
+                              it->second);
+        }
+        return it->second;
+    }
+};
+
+// Whether structures[i], a tree, has room to grow: the terrain leaves the box above it open,
+// and it stays out of every house and torii gate, and out of every tree before it whether or
+// not that one had room itself, so the answer only depends on the sites around it
+static bool hasRoom(const std::vector<PlannedStructure>& structures,
+                    std::size_t i,
+                    SiteTerrain& terrain)
+{
+    const PlannedStructure& tree = structures[i];
+    const ShapeExtent& extent = tree.extent();
+    glm::ivec3 roomMin = tree.pos + glm::ivec3(extent.min.x, 1, extent.min.z);
+    glm::ivec3 roomMax = tree.pos + glm::ivec3(extent.max.x, extent.room, extent.max.z);
+
+    for (std::size_t j = 0; j < structures.size(); j++) {
+        const PlannedStructure& other = structures[j];
+        if (j == i || (j > i && other.extent().room > 0)) {
+            continue;
+        }
+        if (boxesOverlap(roomMin,
+                         roomMax,
+                         other.pos + other.extent().min,
+                         other.pos + other.extent().max)) {
+            return false;
+        }
+    }
+
+    for (int x = roomMin.x; x <= roomMax.x; x++) {
+        for (int z = roomMin.z; z <= roomMax.z; z++) {
+            if (!terrain.isClear(x, z, roomMin.y, roomMax.y, extent.growsOverShoots)) {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
-void Chunk::helperCreate(int worldXOrigin, int worldZOrigin)
+void Chunk::helperCreate(int worldXOrigin, int worldZOrigin, uint32_t seed)
 {
-    std::vector<glm::vec3> cedarPos;
-    std::vector<glm::vec3> teakPos;
-    std::vector<glm::vec3> cottagePos;
-    std::vector<glm::vec3> cherryPos;
-    std::vector<glm::vec3> teaHousePos;
-    std::vector<glm::vec3> maplePos;
-    std::vector<glm::vec3> pinePos;
-    std::vector<glm::vec3> wisteriaPos;
+    m_seed = seed;
+
+    // All the 2D noise for the Chunk's columns at once, indexed by x + 16 * z
+    glm::vec2 origin(worldXOrigin, worldZOrigin);
+    std::array<float, 256> mountainsH, hillsH, forestH, islandsH, detail, elevation, temperature;
+    Biome::mountainsGrid(origin, 16, 16, mountainsH.data(), seed);
+    Biome::hillsGrid(origin, 16, 16, hillsH.data(), seed);
+    Biome::forestGrid(origin, 16, 16, forestH.data(), seed);
+    Biome::islandsGrid(origin, 16, 16, islandsH.data(), seed);
+    Biome::fbmGrid(origin, 16, 16, 1.f, detail.data(), seed);
+    Biome::fbmGrid(origin, 16, 16, 237.f, elevation.data(), seed);
+    Biome::fbmGrid(origin, 16, 16, 189.f, temperature.data(), seed);
+    CaveField caves(worldXOrigin,
+                    worldZOrigin,
+                    seed,
+                    caveQuality,
+                    &ColumnNoiseCache::instance());
+    std::vector<float> surface(2 * SURFACE_BIOMES);
 
     for (int x = 0; x < 16; ++x) {
         for (int z = 0; z < 16; ++z) {
             int worldX = worldXOrigin + x;
             int worldZ = worldZOrigin + z;
-
-            float hM = Biome::mountains(glm::vec2(worldX, worldZ));
-            float hH = Biome::hills(glm::vec2(worldX, worldZ));
-            float hF = Biome::forest(glm::vec2(worldX, worldZ));
-            float hI = Biome::islands(glm::vec2(worldX, worldZ));
-
-            std::pair<float, BiomeEnum> hb
-                = blendMultipleBiomes(glm::vec2(worldX, worldZ), glm::vec2(x, z), hM, hH, hF, hI);
+            int column = x + 16 * z;
+
+            std::pair<float, BiomeEnum> hb = blendMultipleBiomes(elevation[column],
+                                                                 temperature[column],
+                                                                 glm::vec2(x, z),
+                                                                 mountainsH[column],
+                                                                 hillsH[column],
+                                                                 forestH[column],
+                                                                 islandsH[column]);
             float h = hb.first;
             BiomeEnum b = hb.second;
+            surface[column] = h;
+            surface[SURFACE_BIOMES + column] = b;
 
-            int numDirtBlocks = 10 * Biome::fbm(glm::vec2(worldX, worldZ));
+            int numDirtBlocks = 10 * detail[column];
             if (b == MOUNTAINS) {
                 if (h < 120) {
-                    for (int y = 0; y < h - numDirtBlocks; ++y) {
-                        setBlockAt(x, y, z, STONE);
-                    }
-                    for (int y = h - numDirtBlocks; y < h; ++y) {
-                        setBlockAt(x, y, z, DIRT);
-                    }
-                    for (int y = h; y < 120; ++y) {
-                        setBlockAt(x, y, z, WATER);
-                    }
+                    fillColumn(x, z, 0, h - numDirtBlocks, STONE);
+                    fillColumn(x, z, h - numDirtBlocks, h, DIRT);
+                    fillColumn(x, z, h, 120, WATER);
                 } else {
-                    for (int y = 0; y < h - numDirtBlocks - 1; ++y) {
-                        setBlockAt(x, y, z, STONE);
-                    }
-                    for (int y = h - numDirtBlocks - 1; y < h - 1; ++y) {
-                        setBlockAt(x, y, z, DIRT);
-                    }
+                    fillColumn(x, z, 0, h - numDirtBlocks - 1, STONE);
+                    fillColumn(x, z, h - numDirtBlocks - 1, h - 1, DIRT);
                     setBlockAt(x, h - 1, z, GRASS);
-                    float snowBar = Biome::noise1D(glm::vec3(x, h, z));
+                    float snowBar = Biome::noise1D(glm::vec3(x, h, z), seed);
                     if (snowBar < 0.5) {
                         setBlockAt(x, h, z, SNOW_1);
                     } else if (snowBar < 0.8) {
@@ -1628,22 +2516,16 @@ void Chunk::helperCreate(int worldXOrigin, int worldZOrigin)
                     this->viableSpawnBlocks.push_back(glm::vec3(x, h, z));
                 }
             } else if (b == HILLS) {
-                for (int y = 0; y < h - 3 - numDirtBlocks; ++y) {
-                    setBlockAt(x, y, z, STONE);
-                }
-                for (int currY = h - 3 - numDirtBlocks; currY < h - 1; ++currY) {
-                    setBlockAt(x, currY, z, DIRT);
-                }
+                fillColumn(x, z, 0, h - 3 - numDirtBlocks, STONE);
+                fillColumn(x, z, h - 3 - numDirtBlocks, h - 1, DIRT);
 
-                float p3 = Biome::noise1D(glm::vec2(h, h));
-                float p4 = Biome::noise1D(glm::vec3(worldX, h, worldZ));
+                float p3 = Biome::noise1D(glm::vec2(h, h), seed);
+                float p4 = Biome::noise1D(glm::vec3(worldX, h, worldZ), seed);
 
                 if (h < 120) {
                     setBlockAt(x, h - 1, z, DIRT);
 
-                    for (int y = h; y < 120; ++y) {
-                        setBlockAt(x, y, z, WATER);
-                    }
+                    fillColumn(x, z, h, 120, WATER);
                 } else if (h <= 130) {
                     setBlockAt(x, h - 1, z, GRASS);
                     this->viableSpawnBlocks.push_back(glm::vec3(x, h, z));
@@ -1685,45 +2567,30 @@ void Chunk::helperCreate(int worldXOrigin, int worldZOrigin)
                     this->viableSpawnBlocks.push_back(glm::vec3(x, h, z));
                 }
             } else if (b == FOREST) {
-                for (int y = 0; y < h - numDirtBlocks - 1; ++y) {
-                    setBlockAt(x, y, z, STONE);
-                }
-                for (int y = h - numDirtBlocks - 1; y < h - 1; ++y) {
-                    setBlockAt(x, y, z, DIRT);
-                }
+                fillColumn(x, z, 0, h - numDirtBlocks - 1, STONE);
+                fillColumn(x, z, h - numDirtBlocks - 1, h - 1, DIRT);
 
                 if (h < 120) {
                     setBlockAt(x, h - 1, z, DIRT);
 
-                    for (int y = h; y < 120; ++y) {
-                        setBlockAt(x, y, z, WATER);
-                    }
+                    fillColumn(x, z, h, 120, WATER);
                 } else {
                     setBlockAt(x, h - 1, z, GRASS);
                     this->viableSpawnBlocks.push_back(glm::vec3(x, h, z));
                 }
             } else if (b == ISLANDS) {
-                for (int y = 0; y < 80; ++y) {
-                    setBlockAt(x, y, z, STONE);
-                }
-                for (int y = 80; y < h; ++y) {
-                    setBlockAt(x, y, z, SAND);
-                }
+                fillColumn(x, z, 0, 80, STONE);
+                fillColumn(x, z, 80, h, SAND);
                 if (h < 120) {
-                    for (int y = h; y < 120; ++y) {
-                        setBlockAt(x, y, z, WATER);
-                    }
+                    fillColumn(x, z, h, 120, WATER);
                 } else {
                     this->viableSpawnBlocks.push_back(glm::vec3(x, h, z));
                 }
             }
 
             // assets
-            float p1 = Biome::noise1D(glm::vec2(worldX, worldZ));
-            float p2 = Biome::fbm(glm::vec2(worldX, worldZ));
-            glm::vec2 wTree = Biome::voronoi(glm::vec2(worldX, worldZ), 5);
-            glm::vec2 wSparseTree = Biome::voronoi(glm::vec2(worldX, worldZ), 12);
-            glm::vec2 wHouse = Biome::voronoi(glm::vec2(worldX, worldZ), 107);
+            float p1 = Biome::noise1D(glm::vec2(worldX, worldZ), seed);
+            float p2 = detail[x + 16 * z];
 
             if (getBlockAt(x, h, z) == EMPTY || getBlockAt(x, h, z) == SNOW_1) {
                 // TALL_GRASS
@@ -1732,65 +2599,12 @@ void Chunk::helperCreate(int worldXOrigin, int worldZOrigin)
                     setBlockAt(x, h, z, TALL_GRASS);
                 }
 
-                // bamboo, trees
-                if (b == MOUNTAINS && h > 130) {
-                    if (worldX == wTree.x && worldZ == wTree.y) {
-                        if (p1 < 0.175) {
-                            cedarPos.push_back(glm::vec3(x, h, z));
-                        } else if (p1 < 0.225) {
-                            teakPos.push_back(glm::vec3(x, h, z));
-                        }
-                    }
-                    if (worldX == wHouse.x && worldZ == wHouse.y) {
-                        cottagePos.push_back(glm::vec3(x, h, z));
-                    }
-                } else if (b == FOREST) {
-                    if (p1 < 0.04) {
-                        // bamboo
-                        int y = h;
-                        int addHeight = 0;
-                        while (addHeight == 0 && getBlockAt(x, y + 1, z) == EMPTY) {
-                            setBlockAt(x, y, z, BAMBOO_1);
-                            y++;
-                            if (Biome::noise1D(glm::vec3(worldX, y + 1, worldZ)) >= 0.75) {
-                                addHeight = 1;
-                            }
-                        }
-                        while (addHeight == 1 && getBlockAt(x, y + 1, z) == EMPTY) {
-                            setBlockAt(x, y, z, BAMBOO_2);
-                            y++;
-                            if (Biome::noise1D(glm::vec3(worldX, y, worldZ)) >= 0.5) {
-                                addHeight = 2;
-                            }
-                        }
-                        while (addHeight == 2 && getBlockAt(x, y + 1, z) == EMPTY) {
-                            setBlockAt(x, y, z, BAMBOO_3);
-                            y++;
-                            if (Biome::noise1D(glm::vec3(worldX, y, worldZ)) >= 0.25) {
-                                addHeight = 3;
-                            }
-                        }
-                    }
-
-                    if (worldX == wSparseTree.x && worldZ == wSparseTree.y) {
-                        cherryPos.push_back(glm::vec3(x, h, z));
-                    }
-                    if (worldX == wHouse.x && worldZ == wHouse.y && p1 > 0.75) {
-                        teaHousePos.push_back(glm::vec3(x, h, z));
-                    }
-                } else if (b == HILLS) {
-                    float p3 = Biome::noise1D(glm::vec3(worldX, h, worldZ));
-                    if (worldX == wHouse.x && worldZ == wHouse.y && p3 < 0.2) {
-                        createHut(x, h, z);
-                    }
-                } else if (b == ISLANDS) {
-                    if (worldX == wTree.x && worldZ == wTree.y) {
-                        if (p1 < 0.2) {
-                            pinePos.push_back(glm::vec3(x, h, z));
-                        } else {
-                            maplePos.push_back(glm::vec3(x, h, z));
-                        }
-                    }
+                // bamboo
+                if (b == FOREST && p1 < 0.04) {
+                    std::array<int, 3> stalk = bambooStalk(worldX, h, worldZ, seed);
+                    fillColumn(x, z, h, stalk[0], BAMBOO_1);
+                    fillColumn(x, z, stalk[0], stalk[1], BAMBOO_2);
+                    fillColumn(x, z, stalk[1], stalk[2], BAMBOO_3);
                 }
             } else if (getBlockAt(x, h, z) == WATER) {
                 // lotuses, coral, sea grass, kelp, lanterns
@@ -1825,7 +2639,7 @@ void Chunk::helperCreate(int worldXOrigin, int worldZOrigin)
                         while (y < 118 && addHeight) {
                             setBlockAt(x, y, z, KELP_1);
                             y++;
-                            addHeight = (Biome::noise1D(glm::vec3(worldX, y, worldZ)) < 0.75);
+                            addHeight = Biome::noise1D(glm::vec3(worldX, y, worldZ), seed) < 0.75;
                         }
                         setBlockAt(x, y, z, KELP_2);
                     }
@@ -1833,15 +2647,10 @@ void Chunk::helperCreate(int worldXOrigin, int worldZOrigin)
             }
 
             bool prevNotGround = false;
-            std::vector<float> treePos;
-            for (int currY = 1; currY <= 106; currY++) {
-                float cavePerlin3D = Biome::perlin3D(glm::vec3(worldX, currY, worldZ) * 0.06f);
-                float cavePerlin3DTwo = Biome::perlin3D(
-                    glm::vec3(worldX, currY, glm::mix(worldX, worldZ, 0.35f)) * 0.06f);
+            for (int currY = CaveField::MIN_Y; currY <= CaveField::MAX_Y; currY++) {
+                float p3 = Biome::noise1D(glm::vec3(worldX, currY, worldZ), seed);
 
-                float p3 = Biome::noise1D(glm::vec3(worldX, currY, worldZ));
-
-                if (cavePerlin3D + cavePerlin3DTwo < -0.15f) {
+                if (caves.isCave(x, currY, z)) {
                     if (currY < 25) {
                         setBlockAt(x, currY, z, LAVA);
                     } else {
@@ -1855,8 +2664,6 @@ void Chunk::helperCreate(int worldXOrigin, int worldZOrigin)
                                 setBlockAt(x, currY, z, GHOST_WEED);
                             } else if (p3 < 0.1) {
                                 setBlockAt(x, currY, z, TALL_GRASS);
-                            } else if (p3 < 0.1075) {
-                                treePos.push_back(currY);
                             }
                         }
                         prevNotGround = true;
@@ -1865,18 +2672,6 @@ void Chunk::helperCreate(int worldXOrigin, int worldZOrigin)
                     prevNotGround = false;
                 }
             }
-            for (float y : treePos) {
-                float p4 = Biome::noise1D(glm::vec2(worldX, worldZ));
-                if (worldX == wTree.x && worldZ == wTree.y) {
-                    if (p4 < 0.2) {
-                        createDeciduous3(x, y, z, WISTERIA_BLOSSOMS_1, WISTERIA_WOOD_Y);
-                    } else if (p4 < 0.4) {
-                        createDeciduous2(x, y, z, WISTERIA_BLOSSOMS_2, WISTERIA_WOOD_Y);
-                    } else {
-                        createDeciduous1(x, y, z, WISTERIA_BLOSSOMS_3, WISTERIA_WOOD_Y);
-                    }
-                }
-            }
 
             if (getBlockAt(x, h, z) == WATER) {
                 int y = h - 1;
@@ -1889,143 +2684,155 @@ void Chunk::helperCreate(int worldXOrigin, int worldZOrigin)
         }
     }
 
-    for (glm::vec3 p : cedarPos) {
-        createConifer1(p.x, p.y, p.z, CEDAR_LEAVES, CEDAR_WOOD_Y);
+    // The Chunks around this one need its surface and sites to build the parts of its
+    // structures that reach into them
+    ColumnNoiseCache& cache = ColumnNoiseCache::instance();
+    cache.insert(ColumnNoise::SURFACE, seed, worldXOrigin, worldZOrigin, surface);
+    std::vector<float> sites;
+    if (!cache.find(sitesKind(caveQuality), seed, worldXOrigin, worldZOrigin, sites)) {
+        findSites(glm::ivec2(worldXOrigin, worldZOrigin), seed, caveQuality, sites);
+        cache.insert(sitesKind(caveQuality), seed, worldXOrigin, worldZOrigin, sites);
     }
-    for (glm::vec3 p : teakPos) {
-        createConifer2(p.x, p.y, p.z, TEAK_LEAVES, TEAK_WOOD_Y);
-    }
-    for (glm::vec3 p : cottagePos) {
-        float p3 = Biome::noise1D(glm::vec3(p.x, p.y, p.z));
-        if (p3 < 0.2) {
-            createCottage1(p.x, p.y, p.z);
-        } else if (p3 < 0.4) {
-            createCottage2(p.x, p.y + 3, p.z);
+}
+
+void Chunk::placeStructures()
+{
+    // Structures reach at most 16 blocks from their sites, and no more than 3 toward -x or -z,
+    // so everything that reaches into this Chunk, or into the room of a tree that does, grows
+    // from a site on this Chunk, the one after it or the two before it, along both x and z
+    std::vector<PlannedStructure> structures;
+    std::vector<float> sites;
+    for (int dz = -2; dz <= 1; dz++) {
+        for (int dx = -2; dx <= 1; dx++) {
+            glm::ivec2 origin(worldPos_x + 16 * dx, worldPos_z + 16 * dz);
+            sitesOf(origin, m_seed, caveQuality, sites);
+            for (std::size_t i = 0; i < sites.size(); i += SITE_SIZE) {
+                PlannedStructure planned;
+                if (planStructure(origin, &sites[i], m_seed, planned)) {
+                    structures.push_back(planned);
+                }
+            }
         }
     }
-    for (glm::vec3 p : cherryPos) {
-        float p3 = Biome::noise1D(glm::vec3(p.x, p.y, p.z));
-        if (p3 < 0.05) {
-            createDeciduous2(p.x, p.y, p.z, CHERRY_BLOSSOMS_1, CHERRY_WOOD_Y);
-        } else if (p3 < 0.055) {
-            createDeciduous3(p.x, p.y, p.z, CHERRY_BLOSSOMS_2, CHERRY_WOOD_Y);
-        } else if (p3 < 0.06) {
-            createDeciduous3(p.x, p.y, p.z, CHERRY_BLOSSOMS_3, CHERRY_WOOD_Y);
-        } else if (p3 < 0.065) {
-            createDeciduous1(p.x, p.y, p.z, CHERRY_BLOSSOMS_4, CHERRY_WOOD_Y);
-        } else if (p3 < 0.066) {
-            createToriiGate(p.x, p.y, p.z, 0);
-        } else if (p3 < 0.067) {
-            createToriiGate(p.x, p.y, p.z, 1);
+    // Every Chunk a structure reaches into builds it in the same order among those it overlaps
+    std::sort(structures.begin(),
+              structures.end(),
+              [](const PlannedStructure& a, const PlannedStructure& b) {
+                  return std::make_tuple(a.site, a.pos.x, a.pos.z, a.pos.y)
+                         < std::make_tuple(b.site, b.pos.x, b.pos.z, b.pos.y);
+              });
+
+    SiteTerrain terrain(m_seed, caveQuality);
+    glm::ivec3 chunkMin(worldPos_x, 0, worldPos_z);
+    glm::ivec3 chunkMax(worldPos_x + 15, 255, worldPos_z + 15);
+    for (std::size_t i = 0; i < structures.size(); i++) {
+        const PlannedStructure& s = structures[i];
+        if (!boxesOverlap(s.pos + s.extent().min, s.pos + s.extent().max, chunkMin, chunkMax)
+            || (s.extent().room > 0 && !hasRoom(structures, i, terrain))) {
+            continue;
         }
-    }
-    for (glm::vec3 p : teaHousePos) {
-        createTeaHouse(p.x, p.y, p.z);
-    }
-    for (glm::vec3 p : pinePos) {
-        createConifer3(p.x, p.y, p.z, PINE_LEAVES, PINE_WOOD_Y);
-    }
-    for (glm::vec3 p : maplePos) {
-        float p3 = Biome::noise1D(glm::vec3(p.x, p.y, p.z));
-        if (p3 < 0.2) {
-            createDeciduous2(p.x, p.y, p.z, MAPLE_LEAVES_1, MAPLE_WOOD_Y);
-        } else if (p3 < 0.4) {
-            createDeciduous3(p.x, p.y, p.z, MAPLE_LEAVES_2, MAPLE_WOOD_Y);
-        } else if (p3 < 0.6) {
-            createDeciduous1(p.x, p.y, p.z, MAPLE_LEAVES_3, MAPLE_WOOD_Y);
+
+        int x = s.pos.x - worldPos_x;
+        int y = s.pos.y;
+        int z = s.pos.z - worldPos_z;
+        switch (s.shape) {
+        case StructureShape::TORII_X:
+            createToriiGate(x, y, z, 0);
+            break;
+        case StructureShape::TORII_Z:
+            createToriiGate(x, y, z, 1);
+            break;
+        case StructureShape::HUT:
+            createHut(x, y, z);
+            break;
+        case StructureShape::COTTAGE_1:
+            createCottage1(x, y, z);
+            break;
+        case StructureShape::COTTAGE_2:
+            createCottage2(x, y, z);
+            break;
+        case StructureShape::TEA_HOUSE:
+            createTeaHouse(x, y, z);
+            break;
+        case StructureShape::CONIFER_1:
+            createConifer1(x, y, z, s.leaf, s.wood);
+            break;
+        case StructureShape::CONIFER_2:
+            createConifer2(x, y, z, s.leaf, s.wood);
+            break;
+        case StructureShape::CONIFER_3:
+            createConifer3(x, y, z, s.leaf, s.wood);
+            break;
+        case StructureShape::DECIDUOUS_1:
+            createDeciduous1(x, y, z, s.leaf, s.wood);
+            break;
+        case StructureShape::DECIDUOUS_2:
+            createDeciduous2(x, y, z, s.leaf, s.wood);
+            break;
+        case StructureShape::DECIDUOUS_3:
+            createDeciduous3(x, y, z, s.leaf, s.wood);
+            break;
         }
     }
 }
 
-std::pair<float, BiomeEnum> Chunk::blendMultipleBiomes(glm::vec2 worldXZ,
+std::pair<float, BiomeEnum> Chunk::blendMultipleBiomes(float elevationNoise,
+                                                       float temperatureNoise,
                                                        glm::vec2 localXZ,
                                                        float mountH,
                                                        float hillH,
                                                        float forestH,
                                                        float islandH)
 {
-    // perform bilinear interpolation
-
-    BiomeEnum b;
     glm::vec4 biomeWts;
-
-    //    double elev = std::clamp((Biome::perlin1(worldXZ / 237.f) + 1.f) / 2.f, 0.f, 1.f); // remap perlin noise from (-1, 1) to (0, 1)
-    //    double temp = std::clamp((Biome::perlin2(worldXZ / 189.f) + 1.f) / 2.f, 0.f, 1.f);
-    double elev = std::clamp(Biome::fbm(worldXZ / 237.f),
-                             0.f,
-                             1.f);  // remap perlin noise from (-1, 1) to (0, 1)
-    double temp = std::clamp(Biome::fbm(worldXZ / 189.f), 0.f, 1.f);
-
-    //    std::cout<<elev<<","<<temp<<std::endl;
-
-    if (elev >= 0.5 && temp < 0.5) {
-        b = MOUNTAINS;
-    } else if (elev >= 0.5 && temp >= 0.5) {
-        b = HILLS;
-    } else if (elev < 0.5 && temp < 0.5) {
-        b = FOREST;
-    } else {
-        b = ISLANDS;
-    }
-
+    std::pair<float, BiomeEnum> hb
+        = blendBiomes(elevationNoise, temperatureNoise, mountH, hillH, forestH, islandH, biomeWts);
     // set biome weights in m_biomes for each xz coord in this chunk
-    biomeWts.x = elev * (1.f - temp);
-    biomeWts.y = elev * temp;
-    biomeWts.z = (1.f - elev) * (1.f - temp);
-    biomeWts.w = (1.f - elev) * temp;
     setBiomeAt(localXZ[0], localXZ[1], biomeWts);
-
-    //    std::cout<<"("<<biomeWts.x<<","<<biomeWts.y<<","<<biomeWts.z<<","<<biomeWts.w<<")"<<std::endl;
-    //    if (biomeWts.x + biomeWts.y + biomeWts.z + biomeWts.w > 1.00001 || biomeWts.x + biomeWts.y + biomeWts.z + biomeWts.w < 0.99999) {
-    //        std::cout << "something is wrong" << std::endl;
-    //    }
-
-    float h = (biomeWts.x * mountH) + (biomeWts.y * hillH) + (biomeWts.z * forestH)
-              + (biomeWts.w * islandH);
-    return std::pair(h, b);
+    return hb;
 }
 
 void Chunk::createToriiGate(int x, int y, int z, int rot)
 {
     if (rot == 0) {
-        setBlockAt(x, y, z, BLACK_PAINTED_WOOD);
-        setBlockAt(x + 6, y, z, BLACK_PAINTED_WOOD);
+        setStructureBlockAt(x, y, z, BLACK_PAINTED_WOOD);
+        setStructureBlockAt(x + 6, y, z, BLACK_PAINTED_WOOD);
 
         for (int y1 = y + 1; y1 <= y + 5; y1++) {
-            setBlockAt(x, y1, z, RED_PAINTED_WOOD);
-            setBlockAt(x + 6, y1, z, RED_PAINTED_WOOD);
+            setStructureBlockAt(x, y1, z, RED_PAINTED_WOOD);
+            setStructureBlockAt(x + 6, y1, z, RED_PAINTED_WOOD);
         }
 
         for (int x1 = x - 1; x1 <= x + 7; x1++) {
-            setBlockAt(x1, y + 6, z, RED_PAINTED_WOOD);
-            setBlockAt(x1, y + 8, z, RED_PAINTED_WOOD);
+            setStructureBlockAt(x1, y + 6, z, RED_PAINTED_WOOD);
+            setStructureBlockAt(x1, y + 8, z, RED_PAINTED_WOOD);
         }
-        setBlockAt(x, y + 7, z, RED_PAINTED_WOOD);
-        setBlockAt(x + 3, y + 7, z, RED_PAINTED_WOOD);
-        setBlockAt(x + 6, y + 7, z, RED_PAINTED_WOOD);
+        setStructureBlockAt(x, y + 7, z, RED_PAINTED_WOOD);
+        setStructureBlockAt(x + 3, y + 7, z, RED_PAINTED_WOOD);
+        setStructureBlockAt(x + 6, y + 7, z, RED_PAINTED_WOOD);
 
         for (int x2 = x - 2; x2 <= x + 8; x2++) {
-            setBlockAt(x2, y + 9, z, ROOF_TILES_1);
+            setStructureBlockAt(x2, y + 9, z, ROOF_TILES_1);
         }
     } else {
-        setBlockAt(x, y, z, BLACK_PAINTED_WOOD);
-        setBlockAt(x, y, z + 6, BLACK_PAINTED_WOOD);
+        setStructureBlockAt(x, y, z, BLACK_PAINTED_WOOD);
+        setStructureBlockAt(x, y, z + 6, BLACK_PAINTED_WOOD);
 
         for (int y1 = y + 1; y1 <= y + 5; y1++) {
-            setBlockAt(x, y1, z, RED_PAINTED_WOOD);
-            setBlockAt(x, y1, z + 6, RED_PAINTED_WOOD);
+            setStructureBlockAt(x, y1, z, RED_PAINTED_WOOD);
+            setStructureBlockAt(x, y1, z + 6, RED_PAINTED_WOOD);
         }
 
         for (int z1 = z - 1; z1 <= z + 7; z1++) {
-            setBlockAt(x, y + 6, z1, RED_PAINTED_WOOD);
-            setBlockAt(x, y + 8, z1, RED_PAINTED_WOOD);
+            setStructureBlockAt(x, y + 6, z1, RED_PAINTED_WOOD);
+            setStructureBlockAt(x, y + 8, z1, RED_PAINTED_WOOD);
         }
-        setBlockAt(x, y + 7, z, RED_PAINTED_WOOD);
-        setBlockAt(x, y + 7, z + 3, RED_PAINTED_WOOD);
-        setBlockAt(x, y + 7, z + 6, RED_PAINTED_WOOD);
+        setStructureBlockAt(x, y + 7, z, RED_PAINTED_WOOD);
+        setStructureBlockAt(x, y + 7, z + 3, RED_PAINTED_WOOD);
+        setStructureBlockAt(x, y + 7, z + 6, RED_PAINTED_WOOD);
 
         for (int z2 = z - 2; z2 <= z + 8; z2++) {
-            setBlockAt(x, y + 9, z2, ROOF_TILES_1);
+            setStructureBlockAt(x, y + 9, z2, ROOF_TILES_1);
         }
     }
 }
@@ -2033,69 +2840,69 @@ void Chunk::createToriiGate(int x, int y, int z, int rot)
 void Chunk::createHut(int x, int y, int z)
 {
     for (int y1 = y; y1 <= y + 3; y1++) {
-        setBlockAt(x, y1, z, MAPLE_WOOD_Y);
-        setBlockAt(x + 8, y1, z, MAPLE_WOOD_Y);
-        setBlockAt(x, y1, z + 8, MAPLE_WOOD_Y);
-        setBlockAt(x + 8, y1, z + 8, MAPLE_WOOD_Y);
+        setStructureBlockAt(x, y1, z, MAPLE_WOOD_Y);
+        setStructureBlockAt(x + 8, y1, z, MAPLE_WOOD_Y);
+        setStructureBlockAt(x, y1, z + 8, MAPLE_WOOD_Y);
+        setStructureBlockAt(x + 8, y1, z + 8, MAPLE_WOOD_Y);
     }
     for (int x1 = x - 1; x1 <= x + 9; x1++) {
         for (int z1 = z - 1; z1 <= z + 9; z1++) {
-            setBlockAt(x1, y + 4, z1, MAPLE_WOOD_Z);
+            setStructureBlockAt(x1, y + 4, z1, MAPLE_WOOD_Z);
         }
-        setBlockAt(x1, y + 4, z - 2, MAPLE_WOOD_X);
-        setBlockAt(x1, y + 4, z + 10, MAPLE_WOOD_X);
-    }
-    setBlockAt(x - 3, y + 4, z - 2, MAPLE_WOOD_X);
-    setBlockAt(x - 3, y + 4, z + 10, MAPLE_WOOD_X);
-    setBlockAt(x - 2, y + 4, z - 2, MAPLE_WOOD_X);
-    setBlockAt(x - 2, y + 4, z + 10, MAPLE_WOOD_X);
-    setBlockAt(x + 10, y + 4, z - 2, MAPLE_WOOD_X);
-    setBlockAt(x + 10, y + 4, z + 10, MAPLE_WOOD_X);
-    setBlockAt(x + 11, y + 4, z - 2, MAPLE_WOOD_X);
-    setBlockAt(x + 11, y + 4, z + 10, MAPLE_WOOD_X);
+        setStructureBlockAt(x1, y + 4, z - 2, MAPLE_WOOD_X);
+        setStructureBlockAt(x1, y + 4, z + 10, MAPLE_WOOD_X);
+    }
+    setStructureBlockAt(x - 3, y + 4, z - 2, MAPLE_WOOD_X);
+    setStructureBlockAt(x - 3, y + 4, z + 10, MAPLE_WOOD_X);
+    setStructureBlockAt(x - 2, y + 4, z - 2, MAPLE_WOOD_X);
+    setStructureBlockAt(x - 2, y + 4, z + 10, MAPLE_WOOD_X);
+    setStructureBlockAt(x + 10, y + 4, z - 2, MAPLE_WOOD_X);
+    setStructureBlockAt(x + 10, y + 4, z + 10, MAPLE_WOOD_X);
+    setStructureBlockAt(x + 11, y + 4, z - 2, MAPLE_WOOD_X);
+    setStructureBlockAt(x + 11, y + 4, z + 10, MAPLE_WOOD_X);
 
     for (int y2 = y + 5; y2 <= y + 10; y2++) {
         for (int x2 = x; x2 <= x + 8; x2++) {
-            setBlockAt(x2, y2, z, CHERRY_PLANKS);
-            setBlockAt(x2, y2, z + 8, CHERRY_PLANKS);
+            setStructureBlockAt(x2, y2, z, CHERRY_PLANKS);
+            setStructureBlockAt(x2, y2, z + 8, CHERRY_PLANKS);
         }
         for (int z2 = z + 1; z2 <= z + 7; z2++) {
-            setBlockAt(x, y2, z2, CHERRY_PLANKS);
-            setBlockAt(x + 8, y2, z2, CHERRY_PLANKS);
+            setStructureBlockAt(x, y2, z2, CHERRY_PLANKS);
+            setStructureBlockAt(x + 8, y2, z2, CHERRY_PLANKS);
         }
     }
     for (int x2 = x + 2; x2 <= x + 6; x2++) {
-        setBlockAt(x2, y + 11, z, CHERRY_PLANKS);
-        setBlockAt(x2, y + 11, z + 8, CHERRY_PLANKS);
+        setStructureBlockAt(x2, y + 11, z, CHERRY_PLANKS);
+        setStructureBlockAt(x2, y + 11, z + 8, CHERRY_PLANKS);
     }
-    setBlockAt(x + 4, y + 12, z, CHERRY_PLANKS);
-    setBlockAt(x + 4, y + 12, z + 8, CHERRY_PLANKS);
+    setStructureBlockAt(x + 4, y + 12, z, CHERRY_PLANKS);
+    setStructureBlockAt(x + 4, y + 12, z + 8, CHERRY_PLANKS);
 
     // roof
     for (int z3 = z - 1; z3 <= z + 9; z3++) {
         int dx = -2;
         for (int y3 = y + 10; y3 <= y + 12; y3++) {
-            setBlockAt(x + dx, y3, z3, STRAW_1);
-            setBlockAt(x + 8 - dx, y3, z3, STRAW_1);
+            setStructureBlockAt(x + dx, y3, z3, STRAW_1);
+            setStructureBlockAt(x + 8 - dx, y3, z3, STRAW_1);
             dx++;
-            setBlockAt(x + dx, y3, z3, STRAW);
-            setBlockAt(x + 8 - dx, y3, z3, STRAW);
+            setStructureBlockAt(x + dx, y3, z3, STRAW);
+            setStructureBlockAt(x + 8 - dx, y3, z3, STRAW);
             dx++;
         }
-        setBlockAt(x + 4, y + 13, z3, STRAW_1);
+        setStructureBlockAt(x + 4, y + 13, z3, STRAW_1);
     }
 
-    setBlockAt(x + 4, y + 5, z, EMPTY);
-    setBlockAt(x + 4, y + 6, z, EMPTY);
+    setStructureBlockAt(x + 4, y + 5, z, EMPTY);
+    setStructureBlockAt(x + 4, y + 6, z, EMPTY);
 
-    //    setBlockAt(x + 4, y + 5, z + 8, EMPTY);
-    //    setBlockAt(x + 4, y + 6, z + 8, EMPTY);
+    //    setStructureBlockAt(x + 4, y + 5, z + 8, EMPTY);
+    //    setStructureBlockAt(x + 4, y + 6, z + 8, EMPTY);
 
-    //    setBlockAt(x, y + 5, z + 4, EMPTY);
-    //    setBlockAt(x, y + 6, z + 4, EMPTY);
+    //    setStructureBlockAt(x, y + 5, z + 4, EMPTY);
+    //    setStructureBlockAt(x, y + 6, z + 4, EMPTY);
 
-    setBlockAt(x + 8, y + 5, z + 4, EMPTY);
-    setBlockAt(x + 8, y + 6, z + 4, EMPTY);
+    setStructureBlockAt(x + 8, y + 5, z + 4, EMPTY);
+    setStructureBlockAt(x + 8, y + 6, z + 4, EMPTY);
 }
 
 void Chunk::createCottage1(int x, int y, int z)
@@ -2103,7 +2910,7 @@ void Chunk::createCottage1(int x, int y, int z)
     for (int x1 = x; x1 <= x + 10; x1++) {
         for (int z1 = z; z1 <= z + 7; z1++) {
             for (int y1 = y; y1 <= y + 10; y1++) {
-                setBlockAt(x1, y1, z1, EMPTY);
+                setStructureBlockAt(x1, y1, z1, EMPTY);
             }
         }
     }
@@ -2111,119 +2918,119 @@ void Chunk::createCottage1(int x, int y, int z)
     // floor 1 walls
     for (int y1 = y; y1 <= y + 3; y1++) {
         for (int x1 = x; x1 <= x + 10; x1++) {
-            setBlockAt(x1, y1, z, CHERRY_PLANKS);
-            setBlockAt(x1, y1, z + 7, CHERRY_PLANKS);
+            setStructureBlockAt(x1, y1, z, CHERRY_PLANKS);
+            setStructureBlockAt(x1, y1, z + 7, CHERRY_PLANKS);
         }
         for (int z1 = z; z1 <= z + 7; z1++) {
-            setBlockAt(x, y1, z1, CHERRY_PLANKS);
-            setBlockAt(x + 10, y1, z1, CHERRY_PLANKS);
+            setStructureBlockAt(x, y1, z1, CHERRY_PLANKS);
+            setStructureBlockAt(x + 10, y1, z1, CHERRY_PLANKS);
         }
     }
     for (int x1 = x; x1 <= x + 4; x1++) {
         for (int y1 = y; y1 <= y + 2; y1++) {
-            setBlockAt(x1, y1, z + 7, EMPTY);
-            setBlockAt(x1, y1, z + 6, CHERRY_PLANKS);
+            setStructureBlockAt(x1, y1, z + 7, EMPTY);
+            setStructureBlockAt(x1, y1, z + 6, CHERRY_PLANKS);
         }
     }
 
     // floor 1 decor
     for (int x1 = x + 1; x1 < x + 10; x1 += 2) {
-        setBlockAt(x1, y + 6, z - 1, PAPER_LANTERN);
-        setBlockAt(x1, y + 6, z + 8, PAPER_LANTERN);
-    }
-    setBlockAt(x + 2, y, z + 6, CHERRY_WINDOW_Z);
-    setBlockAt(x + 2, y + 1, z + 6, CHERRY_WINDOW_Z);
-    setBlockAt(x + 3, y, z + 6, EMPTY);
-    setBlockAt(x + 3, y + 1, z + 6, EMPTY);
-    setBlockAt(x + 4, y + 2, z + 7, PAPER_LANTERN);
-    setBlockAt(x + 2, y, z + 5, WOOD_LANTERN);
-    setBlockAt(x + 2, y + 1, z + 5, MAPLE_IKEBANA);
-    setBlockAt(x + 3, y + 1, z + 1, PAINTING_4_ZP);
-
-    setBlockAt(x + 10, y, z + 3, EMPTY);
-    setBlockAt(x + 10, y + 1, z + 3, EMPTY);
-    setBlockAt(x + 10, y, z + 4, CHERRY_WINDOW_X);
-    setBlockAt(x + 10, y + 1, z + 4, CHERRY_WINDOW_X);
+        setStructureBlockAt(x1, y + 6, z - 1, PAPER_LANTERN);
+        setStructureBlockAt(x1, y + 6, z + 8, PAPER_LANTERN);
+    }
+    setStructureBlockAt(x + 2, y, z + 6, CHERRY_WINDOW_Z);
+    setStructureBlockAt(x + 2, y + 1, z + 6, CHERRY_WINDOW_Z);
+    setStructureBlockAt(x + 3, y, z + 6, EMPTY);
+    setStructureBlockAt(x + 3, y + 1, z + 6, EMPTY);
+    setStructureBlockAt(x + 4, y + 2, z + 7, PAPER_LANTERN);
+    setStructureBlockAt(x + 2, y, z + 5, WOOD_LANTERN);
+    setStructureBlockAt(x + 2, y + 1, z + 5, MAPLE_IKEBANA);
+    setStructureBlockAt(x + 3, y + 1, z + 1, PAINTING_4_ZP);
+
+    setStructureBlockAt(x + 10, y, z + 3, EMPTY);
+    setStructureBlockAt(x + 10, y + 1, z + 3, EMPTY);
+    setStructureBlockAt(x + 10, y, z + 4, CHERRY_WINDOW_X);
+    setStructureBlockAt(x + 10, y + 1, z + 4, CHERRY_WINDOW_X);
 
     // floor 2 walls
     for (int y2 = y + 4; y2 <= y + 7; y2++) {
         for (int x1 = x; x1 <= x + 10; x1++) {
-            setBlockAt(x1, y2, z, PINE_PLANKS);
-            setBlockAt(x1, y2, z + 7, PINE_PLANKS);
+            setStructureBlockAt(x1, y2, z, PINE_PLANKS);
+            setStructureBlockAt(x1, y2, z + 7, PINE_PLANKS);
         }
         for (int z2 = z; z2 <= z + 7; z2++) {
-            setBlockAt(x, y2, z2, PINE_PLANKS);
-            setBlockAt(x + 10, y2, z2, PINE_PLANKS);
+            setStructureBlockAt(x, y2, z2, PINE_PLANKS);
+            setStructureBlockAt(x + 10, y2, z2, PINE_PLANKS);
         }
     }
     for (int z2 = z + 2; z2 <= z + 5; z2++) {
-        setBlockAt(x, y + 8, z2, PINE_PLANKS);
-        setBlockAt(x + 10, y + 8, z2, PINE_PLANKS);
+        setStructureBlockAt(x, y + 8, z2, PINE_PLANKS);
+        setStructureBlockAt(x + 10, y + 8, z2, PINE_PLANKS);
     }
 
     // floor 2 decor
-    setBlockAt(x + 9, y + 4, z + 6, WOOD_LANTERN);
-    setBlockAt(x + 9, y + 5, z + 6, DAFFODIL_IKEBANA);
-    setBlockAt(x + 1, y + 4, z + 1, WOOD_LANTERN);
-    setBlockAt(x + 1, y + 5, z + 1, ONCIDIUM_IKEBANA);
+    setStructureBlockAt(x + 9, y + 4, z + 6, WOOD_LANTERN);
+    setStructureBlockAt(x + 9, y + 5, z + 6, DAFFODIL_IKEBANA);
+    setStructureBlockAt(x + 1, y + 4, z + 1, WOOD_LANTERN);
+    setStructureBlockAt(x + 1, y + 5, z + 1, ONCIDIUM_IKEBANA);
 
-    setBlockAt(x + 2, y + 4, z + 3, WISTERIA_WOOD_Z);
-    setBlockAt(x + 3, y + 4, z + 3, WISTERIA_WOOD_Z);
-    setBlockAt(x + 2, y + 4, z + 4, WISTERIA_WOOD_Z);
-    setBlockAt(x + 3, y + 4, z + 4, WISTERIA_WOOD_Z);
-    setBlockAt(x + 2, y + 4, z + 5, WISTERIA_WOOD_Z);
-    setBlockAt(x + 3, y + 4, z + 5, WISTERIA_WOOD_Z);
+    setStructureBlockAt(x + 2, y + 4, z + 3, WISTERIA_WOOD_Z);
+    setStructureBlockAt(x + 3, y + 4, z + 3, WISTERIA_WOOD_Z);
+    setStructureBlockAt(x + 2, y + 4, z + 4, WISTERIA_WOOD_Z);
+    setStructureBlockAt(x + 3, y + 4, z + 4, WISTERIA_WOOD_Z);
+    setStructureBlockAt(x + 2, y + 4, z + 5, WISTERIA_WOOD_Z);
+    setStructureBlockAt(x + 3, y + 4, z + 5, WISTERIA_WOOD_Z);
 
-    setBlockAt(x + 2, y + 5, z + 4, CHRYSANTHEMUM_IKEBANA);
-    setBlockAt(x + 2, y + 5, z + 5, PAPER_LANTERN);
+    setStructureBlockAt(x + 2, y + 5, z + 4, CHRYSANTHEMUM_IKEBANA);
+    setStructureBlockAt(x + 2, y + 5, z + 5, PAPER_LANTERN);
 
     // floor
     for (int x2 = x; x2 <= x + 10; x2++) {
         for (int z2 = z; z2 <= z + 7; z2++) {
-            setBlockAt(x2, y - 1, z2, PINE_PLANKS);
-            setBlockAt(x2, y + 3, z2, CHERRY_PLANKS);
+            setStructureBlockAt(x2, y - 1, z2, PINE_PLANKS);
+            setStructureBlockAt(x2, y + 3, z2, CHERRY_PLANKS);
         }
     }
 
     // balcony
     for (int x3 = x - 1; x3 <= x + 11; x3++) {
-        setBlockAt(x3, y + 3, z + 8, ROOF_TILES);
-        setBlockAt(x3, y + 3, z + 9, ROOF_TILES_1);
-        setBlockAt(x3, y + 3, z - 1, ROOF_TILES_2);
-        setBlockAt(x3, y + 3, z - 2, ROOF_TILES_2);
+        setStructureBlockAt(x3, y + 3, z + 8, ROOF_TILES);
+        setStructureBlockAt(x3, y + 3, z + 9, ROOF_TILES_1);
+        setStructureBlockAt(x3, y + 3, z - 1, ROOF_TILES_2);
+        setStructureBlockAt(x3, y + 3, z - 2, ROOF_TILES_2);
     }
     for (int z3 = z; z3 <= z + 7; z3++) {
-        setBlockAt(x - 1, y + 3, z3, ROOF_TILES_2);
-        setBlockAt(x + 11, y + 3, z3, ROOF_TILES_2);
+        setStructureBlockAt(x - 1, y + 3, z3, ROOF_TILES_2);
+        setStructureBlockAt(x + 11, y + 3, z3, ROOF_TILES_2);
     }
 
     // roof
-    for (int x3 = x - 1; x3 <= z + 12; x3++) {
+    for (int x3 = x - 1; x3 <= x + 11; x3++) {
         int dx = -2;
         for (int y3 = y + 7; y3 <= y + 9; y3++) {
-            setBlockAt(x3, y3, z + dx, ROOF_TILES_1);
-            setBlockAt(x3, y3, z + 7 - dx, ROOF_TILES_1);
+            setStructureBlockAt(x3, y3, z + dx, ROOF_TILES_1);
+            setStructureBlockAt(x3, y3, z + 7 - dx, ROOF_TILES_1);
             dx++;
-            setBlockAt(x3, y3, z + dx, ROOF_TILES);
-            setBlockAt(x3, y3, z + 7 - dx, ROOF_TILES);
+            setStructureBlockAt(x3, y3, z + dx, ROOF_TILES);
+            setStructureBlockAt(x3, y3, z + 7 - dx, ROOF_TILES);
             dx++;
         }
     }
 
     // stairs
-    setBlockAt(x + 5, y, z + 1, CHERRY_PLANKS_2);
-    setBlockAt(x + 5, y, z + 2, CHERRY_PLANKS_2);
-    setBlockAt(x + 6, y + 1, z + 1, CHERRY_PLANKS_2);
-    setBlockAt(x + 6, y + 1, z + 2, CHERRY_PLANKS_2);
-    setBlockAt(x + 7, y + 2, z + 1, CHERRY_PLANKS_2);
-    setBlockAt(x + 7, y + 2, z + 2, CHERRY_PLANKS_2);
-
-    setBlockAt(x + 5, y + 3, z + 1, EMPTY);
-    setBlockAt(x + 5, y + 3, z + 2, EMPTY);
-    setBlockAt(x + 6, y + 3, z + 1, EMPTY);
-    setBlockAt(x + 6, y + 3, z + 2, EMPTY);
-    setBlockAt(x + 7, y + 3, z + 1, EMPTY);
-    setBlockAt(x + 7, y + 3, z + 2, EMPTY);
+    setStructureBlockAt(x + 5, y, z + 1, CHERRY_PLANKS_2);
+    setStructureBlockAt(x + 5, y, z + 2, CHERRY_PLANKS_2);
+    setStructureBlockAt(x + 6, y + 1, z + 1, CHERRY_PLANKS_2);
+    setStructureBlockAt(x + 6, y + 1, z + 2, CHERRY_PLANKS_2);
+    setStructureBlockAt(x + 7, y + 2, z + 1, CHERRY_PLANKS_2);
+    setStructureBlockAt(x + 7, y + 2, z + 2, CHERRY_PLANKS_2);
+
+    setStructureBlockAt(x + 5, y + 3, z + 1, EMPTY);
+    setStructureBlockAt(x + 5, y + 3, z + 2, EMPTY);
+    setStructureBlockAt(x + 6, y + 3, z + 1, EMPTY);
+    setStructureBlockAt(x + 6, y + 3, z + 2, EMPTY);
+    setStructureBlockAt(x + 7, y + 3, z + 1, EMPTY);
+    setStructureBlockAt(x + 7, y + 3, z + 2, EMPTY);
 }
 
 void Chunk::createCottage2(int x, int y, int z)
@@ -2231,7 +3038,7 @@ void Chunk::createCottage2(int x, int y, int z)
     for (int x1 = x - 2; x1 <= x + 12; x1++) {
         for (int z1 = z - 2; z1 <= z + 11; z1++) {
             for (int y1 = y - 1; y1 <= y + 15; y1++) {
-                setBlockAt(x1, y1, z1, EMPTY);
+                setStructureBlockAt(x1, y1, z1, EMPTY);
             }
         }
     }
@@ -2239,124 +3046,124 @@ void Chunk::createCottage2(int x, int y, int z)
     // platform
     for (int x1 = x - 2; x1 <= x + 12; x1++) {
         for (int z1 = z - 2; z1 <= z + 11; z1++) {
-            setBlockAt(x1, y, z1, PINE_PLANKS_1);
+            setStructureBlockAt(x1, y, z1, PINE_PLANKS_1);
         }
     }
     for (int y1 = y - 1; y1 >= y - 4; y1--) {
-        setBlockAt(x - 2, y1, z - 2, MAPLE_WOOD_Y);
-        setBlockAt(x + 12, y1, z - 2, MAPLE_WOOD_Y);
-        setBlockAt(x - 2, y1, z + 11, MAPLE_WOOD_Y);
-        setBlockAt(x + 12, y1, z + 11, MAPLE_WOOD_Y);
+        setStructureBlockAt(x - 2, y1, z - 2, MAPLE_WOOD_Y);
+        setStructureBlockAt(x + 12, y1, z - 2, MAPLE_WOOD_Y);
+        setStructureBlockAt(x - 2, y1, z + 11, MAPLE_WOOD_Y);
+        setStructureBlockAt(x + 12, y1, z + 11, MAPLE_WOOD_Y);
     }
 
     // floor
     for (int x1 = x; x1 <= x + 10; x1++) {
         for (int z1 = z; z1 <= z + 9; z1++) {
-            setBlockAt(x1, y, z1, PINE_WOOD_X);
+            setStructureBlockAt(x1, y, z1, PINE_WOOD_X);
         }
     }
     for (int z1 = z; z1 <= z + 9; z1++) {
-        setBlockAt(x, y, z1, PINE_WOOD_Z);
-        setBlockAt(x + 10, y, z1, PINE_WOOD_Z);
+        setStructureBlockAt(x, y, z1, PINE_WOOD_Z);
+        setStructureBlockAt(x + 10, y, z1, PINE_WOOD_Z);
     }
 
     // walls
     for (int y1 = y + 1; y1 <= y + 7; y1++) {
         for (int x1 = x; x1 <= x + 10; x1++) {
-            setBlockAt(x1, y1, z, PLASTER);
-            setBlockAt(x1, y1, z + 9, PLASTER);
+            setStructureBlockAt(x1, y1, z, PLASTER);
+            setStructureBlockAt(x1, y1, z + 9, PLASTER);
         }
         for (int z1 = z; z1 <= z + 9; z1++) {
-            setBlockAt(x, y1, z1, PLASTER);
-            setBlockAt(x + 10, y1, z1, PLASTER);
+            setStructureBlockAt(x, y1, z1, PLASTER);
+            setStructureBlockAt(x + 10, y1, z1, PLASTER);
         }
     }
 
-    setBlockAt(x, y + 8, z + 4, PLASTER);
-    setBlockAt(x + 10, y + 8, z + 4, PLASTER);
-    setBlockAt(x, y + 8, z + 5, PLASTER);
-    setBlockAt(x + 10, y + 8, z + 5, PLASTER);
+    setStructureBlockAt(x, y + 8, z + 4, PLASTER);
+    setStructureBlockAt(x + 10, y + 8, z + 4, PLASTER);
+    setStructureBlockAt(x, y + 8, z + 5, PLASTER);
+    setStructureBlockAt(x + 10, y + 8, z + 5, PLASTER);
 
     for (int y1 = y + 1; y1 <= y + 2; y1++) {
         for (int z1 = z + 1; z1 <= z + 8; z1++) {
-            setBlockAt(x, y1, z1, MAPLE_PLANKS);
-            setBlockAt(x + 10, y1, z1, MAPLE_PLANKS);
-        }
-    }
-    setBlockAt(x + 1, y + 1, z, MAPLE_PLANKS);
-    setBlockAt(x + 1, y + 1, z + 9, MAPLE_PLANKS);
-    setBlockAt(x + 2, y + 1, z, MAPLE_PLANKS);
-    setBlockAt(x + 2, y + 1, z + 9, MAPLE_PLANKS);
-    setBlockAt(x + 8, y + 1, z, MAPLE_PLANKS);
-    setBlockAt(x + 8, y + 1, z + 9, MAPLE_PLANKS);
-    setBlockAt(x + 9, y + 1, z, MAPLE_PLANKS);
-    setBlockAt(x + 9, y + 1, z + 9, MAPLE_PLANKS);
-
-    setBlockAt(x + 1, y + 2, z, MAPLE_WINDOW_Z);
-    setBlockAt(x + 1, y + 3, z, MAPLE_WINDOW_Z);
-    setBlockAt(x + 2, y + 2, z, MAPLE_WINDOW_Z);
-    setBlockAt(x + 2, y + 3, z, MAPLE_WINDOW_Z);
-    setBlockAt(x + 8, y + 2, z, MAPLE_WINDOW_Z);
-    setBlockAt(x + 8, y + 3, z, MAPLE_WINDOW_Z);
-    setBlockAt(x + 9, y + 2, z, MAPLE_WINDOW_Z);
-    setBlockAt(x + 9, y + 3, z, MAPLE_WINDOW_Z);
-
-    setBlockAt(x + 1, y + 2, z + 9, MAPLE_WINDOW_Z);
-    setBlockAt(x + 1, y + 3, z + 9, MAPLE_WINDOW_Z);
-    setBlockAt(x + 2, y + 2, z + 9, MAPLE_WINDOW_Z);
-    setBlockAt(x + 2, y + 3, z + 9, MAPLE_WINDOW_Z);
-    setBlockAt(x + 8, y + 2, z + 9, MAPLE_WINDOW_Z);
-    setBlockAt(x + 8, y + 3, z + 9, MAPLE_WINDOW_Z);
-    setBlockAt(x + 9, y + 2, z + 9, MAPLE_WINDOW_Z);
-    setBlockAt(x + 9, y + 3, z + 9, MAPLE_WINDOW_Z);
+            setStructureBlockAt(x, y1, z1, MAPLE_PLANKS);
+            setStructureBlockAt(x + 10, y1, z1, MAPLE_PLANKS);
+        }
+    }
+    setStructureBlockAt(x + 1, y + 1, z, MAPLE_PLANKS);
+    setStructureBlockAt(x + 1, y + 1, z + 9, MAPLE_PLANKS);
+    setStructureBlockAt(x + 2, y + 1, z, MAPLE_PLANKS);
+    setStructureBlockAt(x + 2, y + 1, z + 9, MAPLE_PLANKS);
+    setStructureBlockAt(x + 8, y + 1, z, MAPLE_PLANKS);
+    setStructureBlockAt(x + 8, y + 1, z + 9, MAPLE_PLANKS);
+    setStructureBlockAt(x + 9, y + 1, z, MAPLE_PLANKS);
+    setStructureBlockAt(x + 9, y + 1, z + 9, MAPLE_PLANKS);
+
+    setStructureBlockAt(x + 1, y + 2, z, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 1, y + 3, z, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 2, y + 2, z, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 2, y + 3, z, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 8, y + 2, z, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 8, y + 3, z, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 9, y + 2, z, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 9, y + 3, z, MAPLE_WINDOW_Z);
+
+    setStructureBlockAt(x + 1, y + 2, z + 9, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 1, y + 3, z + 9, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 2, y + 2, z + 9, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 2, y + 3, z + 9, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 8, y + 2, z + 9, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 8, y + 3, z + 9, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 9, y + 2, z + 9, MAPLE_WINDOW_Z);
+    setStructureBlockAt(x + 9, y + 3, z + 9, MAPLE_WINDOW_Z);
 
     for (int y1 = y; y1 <= y + 7; y1++) {
-        setBlockAt(x, y1, z, WISTERIA_WOOD_Y);
-        setBlockAt(x + 10, y1, z, WISTERIA_WOOD_Y);
-        setBlockAt(x, y1, z + 9, WISTERIA_WOOD_Y);
-        setBlockAt(x + 10, y1, z + 9, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x, y1, z, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x + 10, y1, z, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x, y1, z + 9, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x + 10, y1, z + 9, WISTERIA_WOOD_Y);
 
-        setBlockAt(x, y1, z + 3, WISTERIA_WOOD_Y);
-        setBlockAt(x, y1, z + 6, WISTERIA_WOOD_Y);
-        setBlockAt(x + 10, y1, z + 3, WISTERIA_WOOD_Y);
-        setBlockAt(x + 10, y1, z + 6, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x, y1, z + 3, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x, y1, z + 6, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x + 10, y1, z + 3, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x + 10, y1, z + 6, WISTERIA_WOOD_Y);
 
-        setBlockAt(x + 3, y1, z, WISTERIA_WOOD_Y);
-        setBlockAt(x + 7, y1, z, WISTERIA_WOOD_Y);
-        setBlockAt(x + 3, y1, z + 9, WISTERIA_WOOD_Y);
-        setBlockAt(x + 7, y1, z + 9, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x + 3, y1, z, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x + 7, y1, z, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x + 3, y1, z + 9, WISTERIA_WOOD_Y);
+        setStructureBlockAt(x + 7, y1, z + 9, WISTERIA_WOOD_Y);
     }
     for (int x1 = x + 1; x1 <= x + 9; x1++) {
-        setBlockAt(x1, y + 4, z, WISTERIA_WOOD_X);
-        setBlockAt(x1, y + 4, z + 9, WISTERIA_WOOD_X);
-        setBlockAt(x1, y + 6, z, WISTERIA_WOOD_X);
-        setBlockAt(x1, y + 6, z + 9, WISTERIA_WOOD_X);
+        setStructureBlockAt(x1, y + 4, z, WISTERIA_WOOD_X);
+        setStructureBlockAt(x1, y + 4, z + 9, WISTERIA_WOOD_X);
+        setStructureBlockAt(x1, y + 6, z, WISTERIA_WOOD_X);
+        setStructureBlockAt(x1, y + 6, z + 9, WISTERIA_WOOD_X);
     }
     for (int z1 = z + 1; z1 <= z + 8; z1++) {
-        setBlockAt(x, y + 4, z1, WISTERIA_WOOD_Z);
-        setBlockAt(x + 10, y + 4, z1, WISTERIA_WOOD_Z);
-        setBlockAt(x, y + 6, z1, WISTERIA_WOOD_Z);
-        setBlockAt(x + 10, y + 6, z1, WISTERIA_WOOD_Z);
+        setStructureBlockAt(x, y + 4, z1, WISTERIA_WOOD_Z);
+        setStructureBlockAt(x + 10, y + 4, z1, WISTERIA_WOOD_Z);
+        setStructureBlockAt(x, y + 6, z1, WISTERIA_WOOD_Z);
+        setStructureBlockAt(x + 10, y + 6, z1, WISTERIA_WOOD_Z);
 
-        setBlockAt(x + 2, y + 6, z1, WISTERIA_WOOD_Z);
-        setBlockAt(x + 4, y + 6, z1, WISTERIA_WOOD_Z);
-        setBlockAt(x + 6, y + 6, z1, WISTERIA_WOOD_Z);
-        setBlockAt(x + 8, y + 6, z1, WISTERIA_WOOD_Z);
+        setStructureBlockAt(x + 2, y + 6, z1, WISTERIA_WOOD_Z);
+        setStructureBlockAt(x + 4, y + 6, z1, WISTERIA_WOOD_Z);
+        setStructureBlockAt(x + 6, y + 6, z1, WISTERIA_WOOD_Z);
+        setStructureBlockAt(x + 8, y + 6, z1, WISTERIA_WOOD_Z);
     }
-    setBlockAt(x + 10, y + 1, z + 1, EMPTY);
-    setBlockAt(x + 10, y + 2, z + 1, EMPTY);
-    setBlockAt(x + 10, y + 1, z + 2, WISTERIA_WINDOW_X);
-    setBlockAt(x + 10, y + 2, z + 2, WISTERIA_WINDOW_X);
+    setStructureBlockAt(x + 10, y + 1, z + 1, EMPTY);
+    setStructureBlockAt(x + 10, y + 2, z + 1, EMPTY);
+    setStructureBlockAt(x + 10, y + 1, z + 2, WISTERIA_WINDOW_X);
+    setStructureBlockAt(x + 10, y + 2, z + 2, WISTERIA_WINDOW_X);
 
     // roof
-    for (int x3 = x - 1; x3 <= z + 11; x3++) {
+    for (int x3 = x - 1; x3 <= x + 11; x3++) {
         int dx = -2;
         for (int y3 = y + 6; y3 <= y + 9; y3++) {
-            setBlockAt(x3, y3, z + dx, ROOF_TILES_1);
-            setBlockAt(x3, y3, z + 9 - dx, ROOF_TILES_1);
+            setStructureBlockAt(x3, y3, z + dx, ROOF_TILES_1);
+            setStructureBlockAt(x3, y3, z + 9 - dx, ROOF_TILES_1);
             dx++;
-            setBlockAt(x3, y3, z + dx, ROOF_TILES);
-            setBlockAt(x3, y3, z + 9 - dx, ROOF_TILES);
+            setStructureBlockAt(x3, y3, z + dx, ROOF_TILES);
+            setStructureBlockAt(x3, y3, z + 9 - dx, ROOF_TILES);
             dx++;
         }
     }
@@ -2364,36 +3171,36 @@ void Chunk::createCottage2(int x, int y, int z)
     // bed
     for (int x1 = x + 1; x1 <= x + 5; x1++) {
         for (int z1 = z + 1; z1 <= z + 6; z1++) {
-            setBlockAt(x1, y + 1, z1, WISTERIA_PLANKS_1);
+            setStructureBlockAt(x1, y + 1, z1, WISTERIA_PLANKS_1);
         }
     }
-    setBlockAt(x + 1, y + 1, z + 1, WISTERIA_PLANKS);
-    setBlockAt(x + 1, y + 1, z + 2, WISTERIA_PLANKS);
-    setBlockAt(x + 1, y + 1, z + 3, WISTERIA_PLANKS);
-    setBlockAt(x + 1, y + 1, z + 4, WISTERIA_PLANKS);
-    setBlockAt(x + 1, y + 1, z + 5, WISTERIA_PLANKS);
-    setBlockAt(x + 1, y + 1, z + 6, WISTERIA_PLANKS);
-
-    setBlockAt(x + 1, y + 2, z + 4, WISTERIA_PLANKS_1);
-    setBlockAt(x + 1, y + 2, z + 5, WISTERIA_PLANKS_1);
-    setBlockAt(x + 1, y + 2, z + 6, WISTERIA_PLANKS_1);
-    setBlockAt(x + 1, y + 2, z + 7, WISTERIA_PLANKS_1);
-    setBlockAt(x + 1, y + 2, z + 8, WISTERIA_PLANKS_1);
-
-    setBlockAt(x + 2, y + 1, z + 4, CLOTH_7);
-    setBlockAt(x + 2, y + 1, z + 5, CLOTH_7);
-    setBlockAt(x + 3, y + 1, z + 4, CLOTH_6);
-    setBlockAt(x + 3, y + 1, z + 5, CLOTH_6);
-    setBlockAt(x + 4, y + 1, z + 4, CLOTH_6);
-    setBlockAt(x + 4, y + 1, z + 5, CLOTH_6);
-
-    setBlockAt(x + 1, y + 2, z + 1, PLUM_BLOSSOM_IKEBANA);
-    setBlockAt(x + 1, y + 3, z + 4, PAINTING_6R_XP);
-    setBlockAt(x + 1, y + 3, z + 5, PAINTING_6L_XP);
-    setBlockAt(x + 1, y + 2, z + 3, PAPER_LANTERN);
-
-    setBlockAt(x + 9, y + 1, z + 8, WOOD_LANTERN);
-    setBlockAt(x + 9, y + 2, z + 8, LOTUS_IKEBANA);
+    setStructureBlockAt(x + 1, y + 1, z + 1, WISTERIA_PLANKS);
+    setStructureBlockAt(x + 1, y + 1, z + 2, WISTERIA_PLANKS);
+    setStructureBlockAt(x + 1, y + 1, z + 3, WISTERIA_PLANKS);
+    setStructureBlockAt(x + 1, y + 1, z + 4, WISTERIA_PLANKS);
+    setStructureBlockAt(x + 1, y + 1, z + 5, WISTERIA_PLANKS);
+    setStructureBlockAt(x + 1, y + 1, z + 6, WISTERIA_PLANKS);
+
+    setStructureBlockAt(x + 1, y + 2, z + 4, WISTERIA_PLANKS_1);
+    setStructureBlockAt(x + 1, y + 2, z + 5, WISTERIA_PLANKS_1);
+    setStructureBlockAt(x + 1, y + 2, z + 6, WISTERIA_PLANKS_1);
+    setStructureBlockAt(x + 1, y + 2, z + 7, WISTERIA_PLANKS_1);
+    setStructureBlockAt(x + 1, y + 2, z + 8, WISTERIA_PLANKS_1);
+
+    setStructureBlockAt(x + 2, y + 1, z + 4, CLOTH_7);
+    setStructureBlockAt(x + 2, y + 1, z + 5, CLOTH_7);
+    setStructureBlockAt(x + 3, y + 1, z + 4, CLOTH_6);
+    setStructureBlockAt(x + 3, y + 1, z + 5, CLOTH_6);
+    setStructureBlockAt(x + 4, y + 1, z + 4, CLOTH_6);
+    setStructureBlockAt(x + 4, y + 1, z + 5, CLOTH_6);
+
+    setStructureBlockAt(x + 1, y + 2, z + 1, PLUM_BLOSSOM_IKEBANA);
+    setStructureBlockAt(x + 1, y + 3, z + 4, PAINTING_6R_XP);
+    setStructureBlockAt(x + 1, y + 3, z + 5, PAINTING_6L_XP);
+    setStructureBlockAt(x + 1, y + 2, z + 3, PAPER_LANTERN);
+
+    setStructureBlockAt(x + 9, y + 1, z + 8, WOOD_LANTERN);
+    setStructureBlockAt(x + 9, y + 2, z + 8, LOTUS_IKEBANA);
 }
 
 void Chunk::createTeaHouse(int x, int y, int z)
@@ -2401,7 +3208,7 @@ void Chunk::createTeaHouse(int x, int y, int z)
     for (int x1 = x - 1; x1 <= x + 16; x1++) {
         for (int z1 = z - 1; z1 <= z + 11; z1++) {
             for (int y1 = y; y1 <= y + 15; y1++) {
-                setBlockAt(x1, y1, z1, EMPTY);
+                setStructureBlockAt(x1, y1, z1, EMPTY);
             }
         }
     }
@@ -2409,207 +3216,207 @@ void Chunk::createTeaHouse(int x, int y, int z)
     // platform
     for (int x1 = x - 2; x1 <= x + 16; x1++) {
         for (int z1 = z - 2; z1 <= z + 11; z1++) {
-            setBlockAt(x1, y, z1, PINE_PLANKS);
+            setStructureBlockAt(x1, y, z1, PINE_PLANKS);
         }
     }
 
     // floor
     for (int x2 = x + 1; x2 <= x + 13; x2++) {
         for (int z2 = z + 1; z2 <= z + 8; z2++) {
-            setBlockAt(x2, y + 1, z2, CEDAR_PLANKS);
+            setStructureBlockAt(x2, y + 1, z2, CEDAR_PLANKS);
         }
     }
 
     // walls
     for (int y3 = y + 2; y3 <= y + 7; y3++) {
         for (int x3 = x + 1; x3 <= x + 13; x3++) {
-            setBlockAt(x3, y3, z, PLASTER);
-            setBlockAt(x3, y3, z + 9, CEDAR_WINDOW_Z);
+            setStructureBlockAt(x3, y3, z, PLASTER);
+            setStructureBlockAt(x3, y3, z + 9, CEDAR_WINDOW_Z);
         }
         for (int z3 = z + 1; z3 <= z + 8; z3++) {
-            setBlockAt(x, y3, z3, PLASTER);
-            setBlockAt(x + 14, y3, z3, CEDAR_WINDOW_X);
-        }
-    }
-    setBlockAt(x + 10, y + 2, z + 9, PLASTER);
-    setBlockAt(x + 11, y + 2, z + 9, PLASTER);
-    setBlockAt(x + 12, y + 2, z + 9, PLASTER);
-    setBlockAt(x + 13, y + 2, z + 9, PLASTER);
-    setBlockAt(x + 10, y + 3, z + 9, PLASTER);
-    setBlockAt(x + 10, y + 4, z + 9, PLASTER);
-    setBlockAt(x + 13, y + 3, z + 9, PLASTER);
-    setBlockAt(x + 13, y + 4, z + 9, PLASTER);
-    setBlockAt(x + 10, y + 5, z + 9, PLASTER);
-    setBlockAt(x + 11, y + 5, z + 9, PLASTER);
-    setBlockAt(x + 12, y + 5, z + 9, PLASTER);
-    setBlockAt(x + 13, y + 5, z + 9, PLASTER);
+            setStructureBlockAt(x, y3, z3, PLASTER);
+            setStructureBlockAt(x + 14, y3, z3, CEDAR_WINDOW_X);
+        }
+    }
+    setStructureBlockAt(x + 10, y + 2, z + 9, PLASTER);
+    setStructureBlockAt(x + 11, y + 2, z + 9, PLASTER);
+    setStructureBlockAt(x + 12, y + 2, z + 9, PLASTER);
+    setStructureBlockAt(x + 13, y + 2, z + 9, PLASTER);
+    setStructureBlockAt(x + 10, y + 3, z + 9, PLASTER);
+    setStructureBlockAt(x + 10, y + 4, z + 9, PLASTER);
+    setStructureBlockAt(x + 13, y + 3, z + 9, PLASTER);
+    setStructureBlockAt(x + 13, y + 4, z + 9, PLASTER);
+    setStructureBlockAt(x + 10, y + 5, z + 9, PLASTER);
+    setStructureBlockAt(x + 11, y + 5, z + 9, PLASTER);
+    setStructureBlockAt(x + 12, y + 5, z + 9, PLASTER);
+    setStructureBlockAt(x + 13, y + 5, z + 9, PLASTER);
 
     for (int x3 = x + 1; x3 <= x + 13; x3++) {
-        setBlockAt(x3, y + 1, z, CEDAR_PLANKS);
-        setBlockAt(x3, y + 1, z + 9, CEDAR_PLANKS);
-        setBlockAt(x3, y + 6, z, CEDAR_PLANKS);
-        setBlockAt(x3, y + 6, z + 9, CEDAR_PLANKS);
-        setBlockAt(x3, y + 8, z, CEDAR_PLANKS);
-        setBlockAt(x3, y + 8, z + 9, CEDAR_PLANKS);
+        setStructureBlockAt(x3, y + 1, z, CEDAR_PLANKS);
+        setStructureBlockAt(x3, y + 1, z + 9, CEDAR_PLANKS);
+        setStructureBlockAt(x3, y + 6, z, CEDAR_PLANKS);
+        setStructureBlockAt(x3, y + 6, z + 9, CEDAR_PLANKS);
+        setStructureBlockAt(x3, y + 8, z, CEDAR_PLANKS);
+        setStructureBlockAt(x3, y + 8, z + 9, CEDAR_PLANKS);
     }
     for (int z3 = z + 1; z3 <= z + 8; z3++) {
-        setBlockAt(x, y + 1, z3, CEDAR_PLANKS);
-        setBlockAt(x + 14, y + 1, z3, CEDAR_PLANKS);
-        setBlockAt(x, y + 6, z3, CEDAR_PLANKS);
-        setBlockAt(x + 14, y + 6, z3, CEDAR_PLANKS);
-        setBlockAt(x, y + 8, z3, CEDAR_PLANKS);
-        setBlockAt(x + 14, y + 8, z3, CEDAR_PLANKS);
+        setStructureBlockAt(x, y + 1, z3, CEDAR_PLANKS);
+        setStructureBlockAt(x + 14, y + 1, z3, CEDAR_PLANKS);
+        setStructureBlockAt(x, y + 6, z3, CEDAR_PLANKS);
+        setStructureBlockAt(x + 14, y + 6, z3, CEDAR_PLANKS);
+        setStructureBlockAt(x, y + 8, z3, CEDAR_PLANKS);
+        setStructureBlockAt(x + 14, y + 8, z3, CEDAR_PLANKS);
     }
     for (int y3 = y + 1; y3 <= y + 8; y3++) {
-        setBlockAt(x, y3, z, CEDAR_PLANKS);
-        setBlockAt(x + 14, y3, z, CEDAR_PLANKS);
-        setBlockAt(x, y3, z + 9, CEDAR_PLANKS);
-        setBlockAt(x + 14, y3, z + 9, CEDAR_PLANKS);
-        setBlockAt(x + 9, y3, z, CEDAR_PLANKS);
-        setBlockAt(x + 9, y3, z + 9, CEDAR_PLANKS);
+        setStructureBlockAt(x, y3, z, CEDAR_PLANKS);
+        setStructureBlockAt(x + 14, y3, z, CEDAR_PLANKS);
+        setStructureBlockAt(x, y3, z + 9, CEDAR_PLANKS);
+        setStructureBlockAt(x + 14, y3, z + 9, CEDAR_PLANKS);
+        setStructureBlockAt(x + 9, y3, z, CEDAR_PLANKS);
+        setStructureBlockAt(x + 9, y3, z + 9, CEDAR_PLANKS);
     }
 
     for (int z3 = z + 2; z3 <= z + 7; z3++) {
-        setBlockAt(x, y + 9, z3, PLASTER);
-        setBlockAt(x + 14, y + 9, z3, PLASTER);
+        setStructureBlockAt(x, y + 9, z3, PLASTER);
+        setStructureBlockAt(x + 14, y + 9, z3, PLASTER);
     }
-    setBlockAt(x, y + 10, z + 4, PLASTER);
-    setBlockAt(x, y + 10, z + 5, PLASTER);
-    setBlockAt(x + 14, y + 10, z + 4, PLASTER);
-    setBlockAt(x + 14, y + 10, z + 5, PLASTER);
+    setStructureBlockAt(x, y + 10, z + 4, PLASTER);
+    setStructureBlockAt(x, y + 10, z + 5, PLASTER);
+    setStructureBlockAt(x + 14, y + 10, z + 4, PLASTER);
+    setStructureBlockAt(x + 14, y + 10, z + 5, PLASTER);
 
     // door
     for (int y3 = y + 2; y3 <= y + 5; y3++) {
         for (int z3 = z + 5; z3 <= z + 6; z3++) {
-            setBlockAt(x + 14, y3, z3, TEAK_WINDOW_X);
+            setStructureBlockAt(x + 14, y3, z3, TEAK_WINDOW_X);
         }
         for (int z3 = z + 3; z3 <= z + 4; z3++) {
-            setBlockAt(x + 14, y3, z3, EMPTY);
+            setStructureBlockAt(x + 14, y3, z3, EMPTY);
         }
     }
 
     // decor
-    setBlockAt(x + 3, y + 4, z + 1, PAINTING_1_ZP);
-    setBlockAt(x + 4, y + 4, z + 1, PAINTING_2_ZP);
-    setBlockAt(x + 5, y + 4, z + 1, PAINTING_3_ZP);
-    setBlockAt(x + 8, y + 2, z + 1, PAPER_LANTERN);
+    setStructureBlockAt(x + 3, y + 4, z + 1, PAINTING_1_ZP);
+    setStructureBlockAt(x + 4, y + 4, z + 1, PAINTING_2_ZP);
+    setStructureBlockAt(x + 5, y + 4, z + 1, PAINTING_3_ZP);
+    setStructureBlockAt(x + 8, y + 2, z + 1, PAPER_LANTERN);
 
-    setBlockAt(x + 7, y + 4, z + 1, PAINTING_5_ZP);
+    setStructureBlockAt(x + 7, y + 4, z + 1, PAINTING_5_ZP);
 
-    setBlockAt(x + 10, y + 2, z + 1, TEAK_PLANKS);
-    setBlockAt(x + 11, y + 2, z + 1, TEAK_PLANKS);
-    setBlockAt(x + 12, y + 2, z + 1, WOOD_LANTERN);
+    setStructureBlockAt(x + 10, y + 2, z + 1, TEAK_PLANKS);
+    setStructureBlockAt(x + 11, y + 2, z + 1, TEAK_PLANKS);
+    setStructureBlockAt(x + 12, y + 2, z + 1, WOOD_LANTERN);
 
-    float p1 = Biome::noise1D(glm::vec3(x + 10, y + 3, z + 1));
+    float p1 = Biome::noise1D(glm::vec3(x + 10, y + 3, z + 1), m_seed);
     if (p1 < 0.1) {
-        setBlockAt(x + 10, y + 3, z + 1, CHERRY_BLOSSOM_IKEBANA);
+        setStructureBlockAt(x + 10, y + 3, z + 1, CHERRY_BLOSSOM_IKEBANA);
     } else if (p1 < 0.2) {
-        setBlockAt(x + 10, y + 3, z + 1, MAGNOLIA_BUD_IKEBANA);
+        setStructureBlockAt(x + 10, y + 3, z + 1, MAGNOLIA_BUD_IKEBANA);
     } else if (p1 < 0.3) {
-        setBlockAt(x + 10, y + 3, z + 1, TULIP_IKEBANA);
+        setStructureBlockAt(x + 10, y + 3, z + 1, TULIP_IKEBANA);
     } else if (p1 < 0.4) {
-        setBlockAt(x + 10, y + 3, z + 1, MAPLE_IKEBANA);
+        setStructureBlockAt(x + 10, y + 3, z + 1, MAPLE_IKEBANA);
     } else if (p1 < 0.5) {
-        setBlockAt(x + 10, y + 3, z + 1, ONCIDIUM_IKEBANA);
+        setStructureBlockAt(x + 10, y + 3, z + 1, ONCIDIUM_IKEBANA);
     } else if (p1 < 0.6) {
-        setBlockAt(x + 10, y + 3, z + 1, DAFFODIL_IKEBANA);
+        setStructureBlockAt(x + 10, y + 3, z + 1, DAFFODIL_IKEBANA);
     } else if (p1 < 0.7) {
-        setBlockAt(x + 10, y + 3, z + 1, POPPY_IKEBANA);
+        setStructureBlockAt(x + 10, y + 3, z + 1, POPPY_IKEBANA);
     } else if (p1 < 0.8) {
-        setBlockAt(x + 10, y + 3, z + 1, BLUE_HYDRANGEA_IKEBANA);
+        setStructureBlockAt(x + 10, y + 3, z + 1, BLUE_HYDRANGEA_IKEBANA);
     } else if (p1 < 0.9) {
-        setBlockAt(x + 10, y + 3, z + 1, GREEN_HYDRANGEA_IKEBANA);
+        setStructureBlockAt(x + 10, y + 3, z + 1, GREEN_HYDRANGEA_IKEBANA);
     } else {
-        setBlockAt(x + 10, y + 3, z + 1, LOTUS_IKEBANA);
-    }
-
-    setBlockAt(x + 9, y + 2, z + 8, WOOD_LANTERN);
-    setBlockAt(x + 9, y + 3, z + 8, BONSAI_TREE);
-
-    setBlockAt(x + 11, y + 3, z + 1, PAINTING_7B_ZP);
-    setBlockAt(x + 11, y + 4, z + 1, PAINTING_7T_ZP);
-    setBlockAt(x + 9, y + 2, z + 1, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 2, z + 2, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 2, z + 3, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 3, z + 1, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 3, z + 2, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 3, z + 3, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 4, z + 1, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 4, z + 2, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 4, z + 3, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 5, z + 1, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 5, z + 2, TEAK_WINDOW_X);
-    setBlockAt(x + 9, y + 5, z + 3, TEAK_WINDOW_X);
-
-    setBlockAt(x + 1, y + 2, z + 1, TATAMI_ZT);
-    setBlockAt(x + 2, y + 2, z + 1, TATAMI_ZB);
-    setBlockAt(x + 3, y + 2, z + 1, TATAMI_ZT);
-    setBlockAt(x + 4, y + 2, z + 1, TATAMI_ZB);
-    setBlockAt(x + 5, y + 2, z + 1, TATAMI_ZT);
-    setBlockAt(x + 6, y + 2, z + 1, TATAMI_ZB);
-
-    setBlockAt(x + 1, y + 2, z + 8, TATAMI_ZT);
-    setBlockAt(x + 2, y + 2, z + 8, TATAMI_ZB);
-    setBlockAt(x + 3, y + 2, z + 8, TATAMI_ZT);
-    setBlockAt(x + 4, y + 2, z + 8, TATAMI_ZB);
-    setBlockAt(x + 5, y + 2, z + 8, TATAMI_ZT);
-    setBlockAt(x + 6, y + 2, z + 8, TATAMI_ZB);
-
-    setBlockAt(x + 1, y + 2, z + 2, TATAMI_XR);
-    setBlockAt(x + 1, y + 2, z + 3, TATAMI_XL);
-    setBlockAt(x + 1, y + 2, z + 4, TATAMI_XR);
-    setBlockAt(x + 1, y + 2, z + 5, TATAMI_XL);
-    setBlockAt(x + 1, y + 2, z + 6, TATAMI_XR);
-    setBlockAt(x + 1, y + 2, z + 7, TATAMI_XL);
-
-    setBlockAt(x + 6, y + 2, z + 2, TATAMI_XR);
-    setBlockAt(x + 6, y + 2, z + 3, TATAMI_XL);
-    setBlockAt(x + 6, y + 2, z + 4, TATAMI_XR);
-    setBlockAt(x + 6, y + 2, z + 5, TATAMI_XL);
-    setBlockAt(x + 6, y + 2, z + 6, TATAMI_XR);
-    setBlockAt(x + 6, y + 2, z + 7, TATAMI_XL);
-
-    setBlockAt(x + 2, y + 2, z + 2, TATAMI_ZT);
-    setBlockAt(x + 3, y + 2, z + 2, TATAMI_ZB);
-    setBlockAt(x + 4, y + 2, z + 2, TATAMI_ZT);
-    setBlockAt(x + 5, y + 2, z + 2, TATAMI_ZB);
-
-    setBlockAt(x + 2, y + 2, z + 7, TATAMI_ZT);
-    setBlockAt(x + 3, y + 2, z + 7, TATAMI_ZB);
-    setBlockAt(x + 4, y + 2, z + 7, TATAMI_ZT);
-    setBlockAt(x + 5, y + 2, z + 7, TATAMI_ZB);
-
-    setBlockAt(x + 2, y + 2, z + 3, TATAMI_XR);
-    setBlockAt(x + 2, y + 2, z + 4, TATAMI_XL);
-    setBlockAt(x + 2, y + 2, z + 5, TATAMI_XR);
-    setBlockAt(x + 2, y + 2, z + 6, TATAMI_XL);
-
-    setBlockAt(x + 5, y + 2, z + 3, TATAMI_XR);
-    setBlockAt(x + 5, y + 2, z + 4, TATAMI_XL);
-    setBlockAt(x + 5, y + 2, z + 5, TATAMI_XR);
-    setBlockAt(x + 5, y + 2, z + 6, TATAMI_XL);
-
-    setBlockAt(x + 3, y + 2, z + 3, TATAMI_ZT);
-    setBlockAt(x + 4, y + 2, z + 3, TATAMI_ZB);
-
-    setBlockAt(x + 3, y + 2, z + 6, TATAMI_ZT);
-    setBlockAt(x + 4, y + 2, z + 6, TATAMI_ZB);
-
-    setBlockAt(x + 3, y + 2, z + 4, TATAMI_XR);
-    setBlockAt(x + 3, y + 2, z + 5, TATAMI_XL);
-
-    setBlockAt(x + 4, y + 2, z + 4, TATAMI_XR);
-    setBlockAt(x + 4, y + 2, z + 5, TATAMI_XL);
+        setStructureBlockAt(x + 10, y + 3, z + 1, LOTUS_IKEBANA);
+    }
+
+    setStructureBlockAt(x + 9, y + 2, z + 8, WOOD_LANTERN);
+    setStructureBlockAt(x + 9, y + 3, z + 8, BONSAI_TREE);
+
+    setStructureBlockAt(x + 11, y + 3, z + 1, PAINTING_7B_ZP);
+    setStructureBlockAt(x + 11, y + 4, z + 1, PAINTING_7T_ZP);
+    setStructureBlockAt(x + 9, y + 2, z + 1, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 2, z + 2, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 2, z + 3, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 3, z + 1, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 3, z + 2, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 3, z + 3, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 4, z + 1, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 4, z + 2, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 4, z + 3, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 5, z + 1, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 5, z + 2, TEAK_WINDOW_X);
+    setStructureBlockAt(x + 9, y + 5, z + 3, TEAK_WINDOW_X);
+
+    setStructureBlockAt(x + 1, y + 2, z + 1, TATAMI_ZT);
+    setStructureBlockAt(x + 2, y + 2, z + 1, TATAMI_ZB);
+    setStructureBlockAt(x + 3, y + 2, z + 1, TATAMI_ZT);
+    setStructureBlockAt(x + 4, y + 2, z + 1, TATAMI_ZB);
+    setStructureBlockAt(x + 5, y + 2, z + 1, TATAMI_ZT);
+    setStructureBlockAt(x + 6, y + 2, z + 1, TATAMI_ZB);
+
+    setStructureBlockAt(x + 1, y + 2, z + 8, TATAMI_ZT);
+    setStructureBlockAt(x + 2, y + 2, z + 8, TATAMI_ZB);
+    setStructureBlockAt(x + 3, y + 2, z + 8, TATAMI_ZT);
+    setStructureBlockAt(x + 4, y + 2, z + 8, TATAMI_ZB);
+    setStructureBlockAt(x + 5, y + 2, z + 8, TATAMI_ZT);
+    setStructureBlockAt(x + 6, y + 2, z + 8, TATAMI_ZB);
+
+    setStructureBlockAt(x + 1, y + 2, z + 2, TATAMI_XR);
+    setStructureBlockAt(x + 1, y + 2, z + 3, TATAMI_XL);
+    setStructureBlockAt(x + 1, y + 2, z + 4, TATAMI_XR);
+    setStructureBlockAt(x + 1, y + 2, z + 5, TATAMI_XL);
+    setStructureBlockAt(x + 1, y + 2, z + 6, TATAMI_XR);
+    setStructureBlockAt(x + 1, y + 2, z + 7, TATAMI_XL);
+
+    setStructureBlockAt(x + 6, y + 2, z + 2, TATAMI_XR);
+    setStructureBlockAt(x + 6, y + 2, z + 3, TATAMI_XL);
+    setStructureBlockAt(x + 6, y + 2, z + 4, TATAMI_XR);
+    setStructureBlockAt(x + 6, y + 2, z + 5, TATAMI_XL);
+    setStructureBlockAt(x + 6, y + 2, z + 6, TATAMI_XR);
+    setStructureBlockAt(x + 6, y + 2, z + 7, TATAMI_XL);
+
+    setStructureBlockAt(x + 2, y + 2, z + 2, TATAMI_ZT);
+    setStructureBlockAt(x + 3, y + 2, z + 2, TATAMI_ZB);
+    setStructureBlockAt(x + 4, y + 2, z + 2, TATAMI_ZT);
+    setStructureBlockAt(x + 5, y + 2, z + 2, TATAMI_ZB);
+
+    setStructureBlockAt(x + 2, y + 2, z + 7, TATAMI_ZT);
+    setStructureBlockAt(x + 3, y + 2, z + 7, TATAMI_ZB);
+    setStructureBlockAt(x + 4, y + 2, z + 7, TATAMI_ZT);
+    setStructureBlockAt(x + 5, y + 2, z + 7, TATAMI_ZB);
+
+    setStructureBlockAt(x + 2, y + 2, z + 3, TATAMI_XR);
+    setStructureBlockAt(x + 2, y + 2, z + 4, TATAMI_XL);
+    setStructureBlockAt(x + 2, y + 2, z + 5, TATAMI_XR);
+    setStructureBlockAt(x + 2, y + 2, z + 6, TATAMI_XL);
+
+    setStructureBlockAt(x + 5, y + 2, z + 3, TATAMI_XR);
+    setStructureBlockAt(x + 5, y + 2, z + 4, TATAMI_XL);
+    setStructureBlockAt(x + 5, y + 2, z + 5, TATAMI_XR);
+    setStructureBlockAt(x + 5, y + 2, z + 6, TATAMI_XL);
+
+    setStructureBlockAt(x + 3, y + 2, z + 3, TATAMI_ZT);
+    setStructureBlockAt(x + 4, y + 2, z + 3, TATAMI_ZB);
+
+    setStructureBlockAt(x + 3, y + 2, z + 6, TATAMI_ZT);
+    setStructureBlockAt(x + 4, y + 2, z + 6, TATAMI_ZB);
+
+    setStructureBlockAt(x + 3, y + 2, z + 4, TATAMI_XR);
+    setStructureBlockAt(x + 3, y + 2, z + 5, TATAMI_XL);
+
+    setStructureBlockAt(x + 4, y + 2, z + 4, TATAMI_XR);
+    setStructureBlockAt(x + 4, y + 2, z + 5, TATAMI_XL);
 
     // roof
     for (int x3 = x - 1; x3 <= x + 15; x3++) {
         int dx = -2;
         for (int y3 = y + 8; y3 <= y + 11; y3++) {
-            setBlockAt(x3, y3, z + dx, ROOF_TILES_1);
-            setBlockAt(x3, y3, z + 9 - dx, ROOF_TILES_1);
+            setStructureBlockAt(x3, y3, z + dx, ROOF_TILES_1);
+            setStructureBlockAt(x3, y3, z + 9 - dx, ROOF_TILES_1);
             dx++;
-            setBlockAt(x3, y3, z + dx, ROOF_TILES);
-            setBlockAt(x3, y3, z + 9 - dx, ROOF_TILES);
+            setStructureBlockAt(x3, y3, z + dx, ROOF_TILES);
+            setStructureBlockAt(x3, y3, z + 9 - dx, ROOF_TILES);
             dx++;
         }
     }
@@ -2617,263 +3424,214 @@ void Chunk::createTeaHouse(int x, int y, int z)
 
 void Chunk::createConifer1(int x, int y, int z, BlockType leaf, BlockType wood)
 {
-    for (int x1 = x - 3; x1 <= x + 3; x1++) {
-        for (int z1 = z - 3; z1 <= z + 3; z1++) {
-            for (int y1 = y + 1; y1 <= y + 7; y1++) {
-                if (getBlockAt(x1, y1, z1) != EMPTY) {
-                    return;
-                }
-            }
-        }
-    }
     // leaves
     for (int x3 = x - 1; x3 <= x + 1; x3++) {
         for (int z3 = z - 1; z3 <= z + 1; z3++) {
-            setBlockAt(x3, y + 3, z3, leaf);
-            setBlockAt(x3, y + 5, z3, leaf);
-            setBlockAt(x3, y + 7, z3, leaf);
-        }
-    }
-    setBlockAt(x - 1, y + 3, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 3, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 3, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 3, z + 1, EMPTY);
-    setBlockAt(x - 1, y + 5, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 5, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 5, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 5, z + 1, EMPTY);
-    setBlockAt(x - 1, y + 7, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 7, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 7, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 7, z + 1, EMPTY);
+            setStructureBlockAt(x3, y + 3, z3, leaf);
+            setStructureBlockAt(x3, y + 5, z3, leaf);
+            setStructureBlockAt(x3, y + 7, z3, leaf);
+        }
+    }
+    setStructureBlockAt(x - 1, y + 3, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 3, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 3, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 3, z + 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 5, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 5, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 5, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 5, z + 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 7, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 7, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 7, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 7, z + 1, EMPTY);
 
     for (int x2 = x - 2; x2 <= x + 2; x2++) {
         for (int z2 = z - 2; z2 <= z + 2; z2++) {
-            setBlockAt(x2, y + 2, z2, leaf);
-            setBlockAt(x2, y + 4, z2, leaf);
+            setStructureBlockAt(x2, y + 2, z2, leaf);
+            setStructureBlockAt(x2, y + 4, z2, leaf);
         }
     }
-    setBlockAt(x - 2, y + 2, z - 2, EMPTY);
-    setBlockAt(x - 2, y + 2, z + 2, EMPTY);
-    setBlockAt(x + 2, y + 2, z - 2, EMPTY);
-    setBlockAt(x + 2, y + 2, z + 2, EMPTY);
-    setBlockAt(x - 2, y + 4, z - 2, EMPTY);
-    setBlockAt(x - 2, y + 4, z + 2, EMPTY);
-    setBlockAt(x + 2, y + 4, z - 2, EMPTY);
-    setBlockAt(x + 2, y + 4, z + 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 2, z - 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 2, z + 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 2, z - 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 2, z + 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 4, z - 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 4, z + 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 4, z - 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 4, z + 2, EMPTY);
 
     for (int x1 = x - 3; x1 <= x + 3; x1++) {
         for (int z1 = z - 3; z1 <= z + 3; z1++) {
-            setBlockAt(x1, y + 1, z1, leaf);
+            setStructureBlockAt(x1, y + 1, z1, leaf);
         }
     }
-    setBlockAt(x - 3, y + 1, z - 3, EMPTY);
-    setBlockAt(x - 3, y + 1, z + 3, EMPTY);
-    setBlockAt(x + 3, y + 1, z - 3, EMPTY);
-    setBlockAt(x + 3, y + 1, z + 3, EMPTY);
+    setStructureBlockAt(x - 3, y + 1, z - 3, EMPTY);
+    setStructureBlockAt(x - 3, y + 1, z + 3, EMPTY);
+    setStructureBlockAt(x + 3, y + 1, z - 3, EMPTY);
+    setStructureBlockAt(x + 3, y + 1, z + 3, EMPTY);
 
     // trunk
     for (int y1 = y; y1 <= y + 6; y1++) {
-        setBlockAt(x, y1, z, wood);
+        setStructureBlockAt(x, y1, z, wood);
     }
 }
 
 void Chunk::createConifer2(int x, int y, int z, BlockType leaf, BlockType wood)
 {
-    for (int x1 = x - 2; x1 <= x + 2; x1++) {
-        for (int z1 = z - 2; z1 <= z + 2; z1++) {
-            for (int y1 = y + 1; y1 <= y + 9; y1++) {
-                if (getBlockAt(x1, y1, z1) != EMPTY) {
-                    return;
-                }
-            }
-        }
-    }
-
     for (int x3 = x - 1; x3 <= x + 1; x3++) {
         for (int z3 = z - 1; z3 <= z + 1; z3++) {
-            setBlockAt(x3, y + 1, z3, leaf);
-            setBlockAt(x3, y + 3, z3, leaf);
-            setBlockAt(x3, y + 5, z3, leaf);
-            setBlockAt(x3, y + 7, z3, leaf);
-            setBlockAt(x3, y + 9, z3, leaf);
-        }
-    }
-    setBlockAt(x - 1, y + 1, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 1, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 1, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 1, z + 1, EMPTY);
-    setBlockAt(x - 1, y + 3, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 3, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 3, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 3, z + 1, EMPTY);
-    setBlockAt(x - 1, y + 5, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 5, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 5, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 5, z + 1, EMPTY);
-    setBlockAt(x - 1, y + 7, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 7, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 7, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 7, z + 1, EMPTY);
-    setBlockAt(x - 1, y + 9, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 9, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 9, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 9, z + 1, EMPTY);
+            setStructureBlockAt(x3, y + 1, z3, leaf);
+            setStructureBlockAt(x3, y + 3, z3, leaf);
+            setStructureBlockAt(x3, y + 5, z3, leaf);
+            setStructureBlockAt(x3, y + 7, z3, leaf);
+            setStructureBlockAt(x3, y + 9, z3, leaf);
+        }
+    }
+    setStructureBlockAt(x - 1, y + 1, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 1, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 1, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 1, z + 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 3, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 3, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 3, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 3, z + 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 5, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 5, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 5, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 5, z + 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 7, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 7, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 7, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 7, z + 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 9, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 9, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 9, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 9, z + 1, EMPTY);
 
     for (int x2 = x - 2; x2 <= x + 2; x2++) {
         for (int z2 = z - 2; z2 <= z + 2; z2++) {
-            setBlockAt(x2, y + 2, z2, leaf);
-            setBlockAt(x2, y + 4, z2, leaf);
-            setBlockAt(x2, y + 6, z2, leaf);
-        }
-    }
-    setBlockAt(x - 2, y + 2, z - 2, EMPTY);
-    setBlockAt(x - 2, y + 2, z + 2, EMPTY);
-    setBlockAt(x + 2, y + 2, z - 2, EMPTY);
-    setBlockAt(x + 2, y + 2, z + 2, EMPTY);
-    setBlockAt(x - 2, y + 4, z - 2, EMPTY);
-    setBlockAt(x - 2, y + 4, z + 2, EMPTY);
-    setBlockAt(x + 2, y + 4, z - 2, EMPTY);
-    setBlockAt(x + 2, y + 4, z + 2, EMPTY);
-    setBlockAt(x - 2, y + 6, z - 2, EMPTY);
-    setBlockAt(x - 2, y + 6, z + 2, EMPTY);
-    setBlockAt(x + 2, y + 6, z - 2, EMPTY);
-    setBlockAt(x + 2, y + 6, z + 2, EMPTY);
+            setStructureBlockAt(x2, y + 2, z2, leaf);
+            setStructureBlockAt(x2, y + 4, z2, leaf);
+            setStructureBlockAt(x2, y + 6, z2, leaf);
+        }
+    }
+    setStructureBlockAt(x - 2, y + 2, z - 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 2, z + 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 2, z - 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 2, z + 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 4, z - 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 4, z + 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 4, z - 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 4, z + 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 6, z - 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 6, z + 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 6, z - 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 6, z + 2, EMPTY);
 
     // trunk
     for (int y1 = y; y1 <= y + 8; y1++) {
-        setBlockAt(x, y1, z, wood);
+        setStructureBlockAt(x, y1, z, wood);
     }
 }
 
 void Chunk::createConifer3(int x, int y, int z, BlockType leaf, BlockType wood)
 {
-    for (int x1 = x - 2; x1 <= x + 2; x1++) {
-        for (int z1 = z - 2; z1 <= z + 2; z1++) {
-            for (int y1 = y + 1; y1 <= y + 6; y1++) {
-                if (getBlockAt(x1, y1, z1) != EMPTY) {
-                    return;
-                }
-            }
-        }
-    }
-
     for (int y3 = y + 1; y3 <= y + 5; y3++) {
         for (int x3 = x - 1; x3 <= x + 1; x3++) {
             for (int z3 = z - 1; z3 <= z + 1; z3++) {
-                setBlockAt(x3, y3, z3, leaf);
+                setStructureBlockAt(x3, y3, z3, leaf);
             }
         }
     }
-    setBlockAt(x + 2, y + 2, z, leaf);
-    setBlockAt(x, y + 2, z - 2, leaf);
-    setBlockAt(x - 2, y + 2, z, leaf);
-    setBlockAt(x, y + 2, z - 2, leaf);
-    setBlockAt(x + 2, y + 4, z, leaf);
-    setBlockAt(x, y + 4, z - 2, leaf);
-    setBlockAt(x - 2, y + 4, z, leaf);
-    setBlockAt(x, y + 4, z - 2, leaf);
-
-    setBlockAt(x - 1, y + 1, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 1, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 1, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 1, z + 1, EMPTY);
-    setBlockAt(x - 1, y + 3, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 3, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 3, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 3, z + 1, EMPTY);
-    setBlockAt(x - 1, y + 5, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 5, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 5, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 5, z + 1, EMPTY);
-
-    setBlockAt(x, y + 6, z, leaf);
+    setStructureBlockAt(x + 2, y + 2, z, leaf);
+    setStructureBlockAt(x, y + 2, z - 2, leaf);
+    setStructureBlockAt(x - 2, y + 2, z, leaf);
+    setStructureBlockAt(x, y + 2, z - 2, leaf);
+    setStructureBlockAt(x + 2, y + 4, z, leaf);
+    setStructureBlockAt(x, y + 4, z - 2, leaf);
+    setStructureBlockAt(x - 2, y + 4, z, leaf);
+    setStructureBlockAt(x, y + 4, z - 2, leaf);
+
+    setStructureBlockAt(x - 1, y + 1, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 1, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 1, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 1, z + 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 3, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 3, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 3, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 3, z + 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 5, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 5, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 5, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 5, z + 1, EMPTY);
+
+    setStructureBlockAt(x, y + 6, z, leaf);
 
     // trunk
     for (int y1 = y; y1 <= y + 5; y1++) {
-        setBlockAt(x, y1, z, wood);
+        setStructureBlockAt(x, y1, z, wood);
     }
 }
 
 void Chunk::createDeciduous1(int x, int y, int z, BlockType leaf, BlockType wood)
 {
-    for (int x1 = x - 2; x1 <= x + 2; x1++) {
-        for (int z1 = z - 2; z1 <= z + 2; z1++) {
-            for (int y1 = y + 1; y1 <= y + 6; y1++) {
-                if (getBlockAt(x1, y1, z1) != EMPTY && getBlockAt(x1, y1, z1) != BAMBOO_1) {
-                    return;
-                }
-            }
-        }
-    }
-
     for (int y2 = y + 3; y2 <= y + 4; y2++) {
         for (int x2 = x - 2; x2 <= x + 2; x2++) {
             for (int z2 = z - 2; z2 <= z + 2; z2++) {
-                setBlockAt(x2, y2, z2, leaf);
+                setStructureBlockAt(x2, y2, z2, leaf);
             }
         }
-        setBlockAt(x - 2, y2, z - 2, EMPTY);
-        setBlockAt(x + 2, y2, z - 2, EMPTY);
-        setBlockAt(x - 2, y2, z + 2, EMPTY);
-        setBlockAt(x + 2, y2, z + 2, EMPTY);
+        setStructureBlockAt(x - 2, y2, z - 2, EMPTY);
+        setStructureBlockAt(x + 2, y2, z - 2, EMPTY);
+        setStructureBlockAt(x - 2, y2, z + 2, EMPTY);
+        setStructureBlockAt(x + 2, y2, z + 2, EMPTY);
     }
 
     for (int y3 = y + 5; y3 <= y + 6; y3++) {
         for (int x3 = x - 1; x3 <= x + 1; x3++) {
             for (int z3 = z - 1; z3 <= z + 1; z3++) {
-                setBlockAt(x3, y3, z3, leaf);
+                setStructureBlockAt(x3, y3, z3, leaf);
             }
         }
     }
-    setBlockAt(x - 1, y + 6, z - 1, EMPTY);
-    setBlockAt(x - 1, y + 6, z + 1, EMPTY);
-    setBlockAt(x + 1, y + 6, z - 1, EMPTY);
-    setBlockAt(x + 1, y + 6, z + 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 6, z - 1, EMPTY);
+    setStructureBlockAt(x - 1, y + 6, z + 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 6, z - 1, EMPTY);
+    setStructureBlockAt(x + 1, y + 6, z + 1, EMPTY);
 
     for (int y1 = y; y1 <= y + 5; y1++) {
-        setBlockAt(x, y1, z, wood);
+        setStructureBlockAt(x, y1, z, wood);
     }
 }
 
 void Chunk::createDeciduous2(int x, int y, int z, BlockType leaf, BlockType wood)
 {
-    for (int x1 = x - 3; x1 <= x + 3; x1++) {
-        for (int z1 = z - 3; z1 <= z + 3; z1++) {
-            for (int y1 = y + 1; y1 <= y + 6; y1++) {
-                if (getBlockAt(x1, y1, z1) != EMPTY && getBlockAt(x1, y1, z1) != BAMBOO_1) {
-                    return;
-                }
-            }
-        }
-    }
-
     for (int y2 = y + 2; y2 <= y + 3; y2++) {
         for (int x2 = x - 3; x2 <= x + 3; x2++) {
             for (int z2 = z - 3; z2 <= z + 3; z2++) {
-                setBlockAt(x2, y2, z2, leaf);
+                setStructureBlockAt(x2, y2, z2, leaf);
             }
         }
-        setBlockAt(x - 3, y2, z - 3, EMPTY);
-        setBlockAt(x + 3, y2, z - 3, EMPTY);
-        setBlockAt(x - 3, y2, z + 3, EMPTY);
-        setBlockAt(x + 3, y2, z + 3, EMPTY);
+        setStructureBlockAt(x - 3, y2, z - 3, EMPTY);
+        setStructureBlockAt(x + 3, y2, z - 3, EMPTY);
+        setStructureBlockAt(x - 3, y2, z + 3, EMPTY);
+        setStructureBlockAt(x + 3, y2, z + 3, EMPTY);
     }
 
     for (int y3 = y + 4; y3 <= y + 5; y3++) {
         for (int x3 = x - 2; x3 <= x + 2; x3++) {
             for (int z3 = z - 2; z3 <= z + 2; z3++) {
-                setBlockAt(x3, y3, z3, leaf);
+                setStructureBlockAt(x3, y3, z3, leaf);
             }
         }
     }
-    setBlockAt(x - 2, y + 5, z - 2, EMPTY);
-    setBlockAt(x - 2, y + 5, z + 2, EMPTY);
-    setBlockAt(x + 2, y + 5, z - 2, EMPTY);
-    setBlockAt(x + 2, y + 5, z + 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 5, z - 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 5, z + 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 5, z - 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 5, z + 2, EMPTY);
 
     for (int y1 = y; y1 <= y + 4; y1++) {
-        setBlockAt(x, y1, z, wood);
+        setStructureBlockAt(x, y1, z, wood);
     }
 }
 
@@ -2881,30 +3639,20 @@ void Chunk::createDeciduous3(int x, int y, int z, BlockType leaf, BlockType wood
 {
     for (int x1 = x - 2; x1 <= x + 2; x1++) {
         for (int z1 = z - 2; z1 <= z + 2; z1++) {
-            for (int y1 = y + 1; y1 <= y + 4; y1++) {
-                if (getBlockAt(x1, y1, z1) != EMPTY && getBlockAt(x1, y1, z1) != BAMBOO_1) {
-                    return;
-                }
-            }
-        }
-    }
-
-    for (int x1 = x - 2; x1 <= x + 2; x1++) {
-        for (int z1 = z - 2; z1 <= z + 2; z1++) {
-            setBlockAt(x1, y + 1, z1, leaf);
+            setStructureBlockAt(x1, y + 1, z1, leaf);
         }
     }
-    setBlockAt(x - 2, y + 1, z + 2, EMPTY);
-    setBlockAt(x + 2, y + 1, z + 2, EMPTY);
-    setBlockAt(x + 2, y + 1, z - 2, EMPTY);
+    setStructureBlockAt(x - 2, y + 1, z + 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 1, z + 2, EMPTY);
+    setStructureBlockAt(x + 2, y + 1, z - 2, EMPTY);
 
     for (int x2 = x - 1; x2 <= x + 1; x2++) {
         for (int z2 = z - 1; z2 <= z + 1; z2++) {
-            setBlockAt(x2, y + 2, z2, leaf);
+            setStructureBlockAt(x2, y + 2, z2, leaf);
         }
     }
-    setBlockAt(x + 1, y + 2, z - 1, EMPTY);
-    setBlockAt(x, y + 3, z, leaf);
-    setBlockAt(x, y, z, wood);
-    setBlockAt(x, y + 1, z, wood);
+    setStructureBlockAt(x + 1, y + 2, z - 1, EMPTY);
+    setStructureBlockAt(x, y + 3, z, leaf);
+    setStructureBlockAt(x, y, z, wood);
+    setStructureBlockAt(x, y + 1, z, wood);
 }
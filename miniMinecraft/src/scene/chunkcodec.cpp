@@ -0,0 +1,266 @@
+#include "chunkcodec.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+static constexpr std::size_t MIN_MATCH = 4;
+// Longest match one sequence covers. The encoder only looks for matches this far
+// behind the newest run-length byte, so that a match is never cut short by bytes
+// that haven't been put yet.
+static constexpr std::size_t MAX_MATCH = 1024;
+static constexpr std::size_t MAX_OFFSET = 65535;
+static constexpr int HASH_BITS = 12;
+// Far more run-length bytes than a Chunk can produce, so a corrupt stream
+// can't make the decoder allocate without bound
+static constexpr std::size_t MAX_RLE_BYTES = std::size_t(1) << 22;
+
+static uint32_t hashBytes(const unsigned char* p)
+{
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return (v * 2654435761u) >> (32 - HASH_BITS);
+}
+
+// Appends a length of at least 15 as LZ4 does, in bytes of up to 255 after the nibble
+static void appendLength(std::vector<unsigned char>& out, std::size_t length)
+{
+    length -= 15;
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<unsigned char>(length));
+}
+
+BlockStreamEncoder::BlockStreamEncoder(std::vector<unsigned char>& out)
+    : m_out(out)
+    , m_start(out.size())
+    , m_runType(EMPTY)
+    , m_runLength(0)
+    , m_rle()
+    , m_anchor(0)
+    , m_pos(0)
+    , m_hashTable(std::size_t(1) << HASH_BITS, -1)
+{
+    m_out.resize(m_start + sizeof(uint32_t));
+}
+
+void BlockStreamEncoder::put(BlockType t, uint32_t count)
+{
+    if (count == 0) {
+        return;
+    }
+    if (m_runLength > 0 && t == m_runType
+        && m_runLength <= std::numeric_limits<uint32_t>::max() - count) {
+        m_runLength += count;
+        return;
+    }
+
+    flushRun();
+    m_runType = t;
+    m_runLength = count;
+}
+
+void BlockStreamEncoder::flushRun()
+{
+    if (m_runLength == 0) {
+        return;
+    }
+
+    m_rle.push_back(m_runType);
+    uint32_t v = m_runLength - 1;
+    while (v >= 0x80) {
+        m_rle.push_back(static_cast<unsigned char>(v | 0x80));
+        v >>= 7;
+    }
+    m_rle.push_back(static_cast<unsigned char>(v));
+    m_runLength = 0;
+
+    if (m_rle.size() - m_pos > MAX_MATCH) {
+        compress(m_rle.size() - MAX_MATCH);
+    }
+}
+
+void BlockStreamEncoder::compress(std::size_t limit)
+{
+    while (m_pos + MIN_MATCH <= limit) {
+        uint32_t h = hashBytes(&m_rle[m_pos]);
+        int32_t candidate = m_hashTable[h];
+        m_hashTable[h] = static_cast<int32_t>(m_pos);
+
+        if (candidate < 0 || m_pos - candidate > MAX_OFFSET
+            || std::memcmp(&m_rle[candidate], &m_rle[m_pos], MIN_MATCH) != 0) {
+            m_pos++;
+            continue;
+        }
+
+        // The match may overlap the bytes it's copied to, as the decoder copies forwards
+        std::size_t length = MIN_MATCH;
+        while (length < MAX_MATCH && m_pos + length < m_rle.size()
+               && m_rle[candidate + length] == m_rle[m_pos + length]) {
+            length++;
+        }
+        emitSequence(m_pos, length, m_pos - candidate);
+        m_pos += length;
+        m_anchor = m_pos;
+    }
+}
+
+void BlockStreamEncoder::emitSequence(std::size_t literalEnd,
+                                      std::size_t matchLength,
+                                      std::size_t offset)
+{
+    std::size_t literals = literalEnd - m_anchor;
+    std::size_t matchCode = matchLength == 0 ? 0 : matchLength - MIN_MATCH;
+
+    m_out.push_back(static_cast<unsigned char>(std::min<std::size_t>(literals, 15) << 4
+                                               | std::min<std::size_t>(matchCode, 15)));
+    if (literals >= 15) {
+        appendLength(m_out, literals);
+    }
+    m_out.insert(m_out.end(), m_rle.begin() + m_anchor, m_rle.begin() + literalEnd);
+
+    // The last sequence ends the stream after its literals
+    if (matchLength == 0) {
+        return;
+    }
+    m_out.push_back(static_cast<unsigned char>(offset & 0xFF));
+    m_out.push_back(static_cast<unsigned char>(offset >> 8));
+    if (matchCode >= 15) {
+        appendLength(m_out, matchCode);
+    }
+}
+
+void BlockStreamEncoder::finish()
+{
+    flushRun();
+    compress(m_rle.size());
+    emitSequence(m_rle.size(), 0, 0);
+
+    uint32_t size = static_cast<uint32_t>(m_out.size() - m_start - sizeof(uint32_t));
+    std::memcpy(m_out.data() + m_start, &size, sizeof(size));
+}
+
+BlockStreamDecoder::BlockStreamDecoder(const unsigned char* data, const unsigned char* end)
+    : m_in(data)
+    , m_inEnd(data)
+    , m_failed(false)
+    , m_rle()
+    , m_rlePos(0)
+{
+    uint32_t size = 0;
+    if (end - data < static_cast<std::ptrdiff_t>(sizeof(size))) {
+        fail();
+        return;
+    }
+    std::memcpy(&size, data, sizeof(size));
+    if (size > static_cast<std::size_t>(end - data) - sizeof(size)) {
+        fail();
+        return;
+    }
+    m_in = data + sizeof(size);
+    m_inEnd = m_in + size;
+}
+
+bool BlockStreamDecoder::failed() const
+{
+    return m_failed;
+}
+
+const unsigned char* BlockStreamDecoder::end() const
+{
+    return m_inEnd;
+}
+
+bool BlockStreamDecoder::fail()
+{
+    m_failed = true;
+    return false;
+}
+
+bool BlockStreamDecoder::decodeSequence()
+{
+    if (m_failed || m_in == m_inEnd) {
+        return false;
+    }
+
+    // Reads the rest of a length whose nibble was 15
+    auto readLength = [&](std::size_t& length) {
+        unsigned char b;
+        do {
+            if (m_in == m_inEnd || length > MAX_RLE_BYTES) {
+                return false;
+            }
+            b = *m_in++;
+            length += b;
+        } while (b == 255);
+        return true;
+    };
+
+    unsigned char token = *m_in++;
+    std::size_t literals = token >> 4;
+    if (literals == 15 && !readLength(literals)) {
+        return fail();
+    }
+    if (literals > static_cast<std::size_t>(m_inEnd - m_in)
+        || m_rle.size() + literals > MAX_RLE_BYTES) {
+        return fail();
+    }
+    m_rle.insert(m_rle.end(), m_in, m_in + literals);
+    m_in += literals;
+
+    if (m_in == m_inEnd) {
+        return true;
+    }
+
+    if (m_inEnd - m_in < 2) {
+        return fail();
+    }
+    std::size_t offset = m_in[0] | std::size_t(m_in[1]) << 8;
+    m_in += 2;
+    std::size_t length = token & 15;
+    if (length == 15 && !readLength(length)) {
+        return fail();
+    }
+    length += MIN_MATCH;
+    if (offset == 0 || offset > m_rle.size() || m_rle.size() + length > MAX_RLE_BYTES) {
+        return fail();
+    }
+
+    // Byte by byte, since the match may overlap the bytes it's copied to
+    std::size_t from = m_rle.size() - offset;
+    for (std::size_t i = 0; i < length; i++) {
+        m_rle.push_back(m_rle[from + i]);
+    }
+    return true;
+}
+
+bool BlockStreamDecoder::next(BlockType& t, uint32_t& count)
+{
+    // A run is at most 6 bytes: its BlockType and a varint of up to 5
+    while (m_rle.size() - m_rlePos < 6 && decodeSequence()) {}
+    if (m_failed || m_rlePos == m_rle.size()) {
+        return false;
+    }
+
+    std::size_t p = m_rlePos + 1;
+    uint64_t v = 0;
+    for (int shift = 0;; shift += 7) {
+        if (p == m_rle.size() || shift > 28) {
+            return fail();
+        }
+        unsigned char b = m_rle[p++];
+        v |= uint64_t(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            break;
+        }
+    }
+    if (v >= std::numeric_limits<uint32_t>::max()) {
+        return fail();
+    }
+
+    t = static_cast<BlockType>(m_rle[m_rlePos]);
+    count = static_cast<uint32_t>(v) + 1;
+    m_rlePos = p;
+    return true;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include "blocktype.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// A compressed stream of BlockTypes, written a run at a time by BlockStreamEncoder and
+// read back a run at a time by BlockStreamDecoder, so neither side ever holds a whole
+// Chunk's blocks uncompressed. Chunk uses it y-major, one horizontal layer after another,
+// where air above the ground, water and stone below it come out as a handful of runs.
+//
+// Compression happens in two stages:
+//   1. run-length: each run is its BlockType as one byte, then its length minus one as
+//      a varint (7 bits per byte, low bits first, the high bit set on all but the last)
+//   2. LZ: the run-length bytes are split into LZ4-style sequences, each a token byte
+//      (literal count in the high nibble, match length minus 4 in the low nibble, 15 in
+//      either meaning more length follows in bytes of up to 255), the literals, then a
+//      16-bit little-endian offset back to the match. The last sequence has literals only.
+// The stream starts with the LZ stage's size in bytes as a 32-bit int in native byte order.
+class BlockStreamEncoder
+{
+public:
+    // Appends the stream to out as runs are put
+    explicit BlockStreamEncoder(std::vector<unsigned char>& out);
+
+    // Adds count blocks of t, merging them with the previous run if it's also t
+    void put(BlockType t, uint32_t count = 1);
+    // Writes out everything still buffered. Must be called once all the runs are in.
+    void finish();
+
+private:
+    std::vector<unsigned char>& m_out;
+    std::size_t m_start;  // where the stream's size goes in m_out
+
+    BlockType m_runType;
+    uint32_t m_runLength;  // 0 before the first put
+
+    // Every run-length byte so far, the history LZ matches are looked up in
+    std::vector<unsigned char> m_rle;
+    std::size_t m_anchor;  // first run-length byte not yet written out, as a literal or match
+    std::size_t m_pos;     // next position to look for a match at
+    std::vector<int32_t> m_hashTable;  // last position of each hashed 4-byte sequence
+
+    void flushRun();
+    // Emits sequences for m_rle up to limit. Matches may run past limit, but not past
+    // the end of m_rle.
+    void compress(std::size_t limit);
+    void emitSequence(std::size_t literalEnd, std::size_t matchLength, std::size_t offset);
+};
+
+class BlockStreamDecoder
+{
+public:
+    // Reads the stream starting at data, which mustn't run past end
+    BlockStreamDecoder(const unsigned char* data, const unsigned char* end);
+
+    // Reads the next run into t and count. Returns false at the end of the stream,
+    // or if the stream is malformed, which failed() then tells apart.
+    bool next(BlockType& t, uint32_t& count);
+    bool failed() const;
+    // Just past the end of the stream, once the stream has been read to its end
+    const unsigned char* end() const;
+
+private:
+    const unsigned char* m_in;
+    const unsigned char* m_inEnd;
+    bool m_failed;
+
+    std::vector<unsigned char> m_rle;  // run-length bytes decoded so far
+    std::size_t m_rlePos;              // next run-length byte to parse a run from
+
+    // Decodes one more LZ sequence into m_rle. Returns false if there's none left.
+    bool decodeSequence();
+    bool fail();
+};
@@ -0,0 +1,154 @@
+#include "chunkjobscheduler.h"
+#include "jobsystem.h"
+#include <algorithm>
+#include <iterator>
+#include <thread>
+
+double JobLatency::meanMs() const
+{
+    return count == 0 ? 0.0 : totalMs / count;
+}
+
+ChunkJobScheduler::ChunkJobScheduler()
+    : m_lock()
+    , m_pending()
+    , m_focusPos(0.f)
+    , m_focusDir(0.f)
+    , m_latency()
+    , m_clock()
+    , m_runners(0)
+{
+    m_clock.start();
+}
+
+ChunkJobScheduler::~ChunkJobScheduler()
+{
+    m_lock.lock();
+    m_pending.clear();
+    m_lock.unlock();
+
+    // The remaining runners find nothing to do, but still point at this scheduler
+    while (m_runners.load() > 0) {
+        std::this_thread::yield();
+    }
+}
+
+bool ChunkJobScheduler::schedule(JobClass jobClass,
+                                 int64_t key,
+                                 glm::ivec2 corner,
+                                 int size,
+                                 std::function<void()> work)
+{
+    m_lock.lock();
+    for (const Job& job : m_pending) {
+        if (job.jobClass == jobClass && job.key == key) {
+            m_lock.unlock();
+            return false;
+        }
+    }
+    m_pending.push_back(Job{jobClass, key, corner, size, m_clock.nsecsElapsed(), std::move(work)});
+    m_lock.unlock();
+
+    // One runner per job; it performs whichever job is most urgent once it starts
+    m_runners++;
+    JobSystem::instance().runDetached([this]() {
+        runNext();
+        m_runners--;
+    });
+    return true;
+}
+
+void ChunkJobScheduler::setFocus(glm::vec3 pos, glm::vec3 forward)
+{
+    glm::vec2 dir(forward.x, forward.z);
+    float len = glm::length(dir);
+
+    m_lock.lock();
+    m_focusPos = glm::vec2(pos.x, pos.z);
+    // Looking straight up or down, no direction is favored
+    m_focusDir = len > 0.001f ? dir / len : glm::vec2(0.f);
+    m_lock.unlock();
+}
+
+std::vector<ChunkJobScheduler::Job> ChunkJobScheduler::cancelIf(
+    const std::function<bool(const Job&)>& shouldCancel)
+{
+    std::vector<Job> cancelled;
+
+    m_lock.lock();
+    auto toCancel = std::partition(m_pending.begin(), m_pending.end(), [&](const Job& job) {
+        return !shouldCancel(job);
+    });
+    std::move(toCancel, m_pending.end(), std::back_inserter(cancelled));
+    m_pending.erase(toCancel, m_pending.end());
+    m_lock.unlock();
+
+    return cancelled;
+}
+
+std::size_t ChunkJobScheduler::pendingCount(JobClass jobClass) const
+{
+    m_lock.lock();
+    std::size_t count = std::count_if(m_pending.begin(), m_pending.end(), [&](const Job& job) {
+        return job.jobClass == jobClass;
+    });
+    m_lock.unlock();
+    return count;
+}
+
+JobLatency ChunkJobScheduler::latency(JobClass jobClass) const
+{
+    m_lock.lock();
+    JobLatency result = m_latency[static_cast<int>(jobClass)];
+    m_lock.unlock();
+    return result;
+}
+
+void ChunkJobScheduler::resetLatency()
+{
+    m_lock.lock();
+    m_latency.fill(JobLatency());
+    m_lock.unlock();
+}
+
+float ChunkJobScheduler::priority(const Job& job) const
+{
+    glm::vec2 center = glm::vec2(job.corner) + glm::vec2(job.size * 0.5f);
+    glm::vec2 offset = center - m_focusPos;
+    float dist2 = glm::dot(offset, offset);
+
+    // Scale the distance by 0.5 for areas straight ahead, up to 1.5 for areas straight behind.
+    // Areas within a Chunk's width are never put off, whichever way the player faces.
+    float facing = 0.f;
+    if (dist2 > 256.f) {
+        facing = glm::dot(offset / glm::sqrt(dist2), m_focusDir);
+    }
+    return dist2 * (1.f - 0.5f * facing);
+}
+
+void ChunkJobScheduler::runNext()
+{
+    m_lock.lock();
+    if (m_pending.empty()) {
+        // this runner's job was cancelled
+        m_lock.unlock();
+        return;
+    }
+
+    auto next = std::min_element(m_pending.begin(),
+                                 m_pending.end(),
+                                 [&](const Job& a, const Job& b) {
+                                     return priority(a) < priority(b);
+                                 });
+    Job job = std::move(*next);
+    m_pending.erase(next);
+
+    JobLatency& latency = m_latency[static_cast<int>(job.jobClass)];
+    double waitedMs = (m_clock.nsecsElapsed() - job.scheduledNs) / 1000000.0;
+    latency.count++;
+    latency.totalMs += waitedMs;
+    latency.maxMs = std::max(latency.maxMs, waitedMs);
+    m_lock.unlock();
+
+    job.work();
+}
@@ -0,0 +1,82 @@
+#pragma once
+#include "glm_includes.h"
+#include <QElapsedTimer>
+#include <QMutex>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// The kinds of work Terrain sends to worker threads
+enum class JobClass : unsigned char { BLOCK_DATA, MESH };
+
+// Queue latency of one JobClass: how long jobs waited between being
+// scheduled and a worker thread starting them
+struct JobLatency
+{
+    uint64_t count = 0;
+    double totalMs = 0.0;
+    double maxMs = 0.0;
+
+    double meanMs() const;
+};
+
+// Orders the BDWorkers and VBOWorkers Terrain creates by how close they are to the player
+// and how directly the player is looking at them, instead of the thread pool's FIFO order.
+// Each scheduled job adds one runner Task to JobSystem::instance(), but which job a runner
+// performs is only decided when it starts, using the player position at that moment,
+// so jobs are re-prioritized as the player moves. Jobs that haven't started yet can be
+// cancelled, e.g. once the player turns away from their zone.
+class ChunkJobScheduler
+{
+public:
+    // A job that hasn't been started
+    struct Job
+    {
+        JobClass jobClass;
+        int64_t key;  // zone key for BLOCK_DATA, chunk key for MESH
+        glm::ivec2 corner;  // lower-left corner of the zone or Chunk in world space
+        int size;  // width of the zone or Chunk
+        int64_t scheduledNs;
+        std::function<void()> work;
+    };
+
+    ChunkJobScheduler();
+    // Drops every pending job and waits for the running ones to finish
+    ~ChunkJobScheduler();
+
+    // Queues work for the area of the given size with its lower-left corner at corner.
+    // Returns false, dropping work, if the same job class and key is already pending.
+    bool schedule(JobClass jobClass,
+                  int64_t key,
+                  glm::ivec2 corner,
+                  int size,
+                  std::function<void()> work);
+
+    // Sets the position and view direction that pending jobs are prioritized by
+    void setFocus(glm::vec3 pos, glm::vec3 forward);
+
+    // Cancels the pending jobs for which shouldCancel returns true
+    // and returns them, so the caller can redo them later
+    std::vector<Job> cancelIf(const std::function<bool(const Job&)>& shouldCancel);
+
+    std::size_t pendingCount(JobClass jobClass) const;
+    JobLatency latency(JobClass jobClass) const;
+    void resetLatency();
+
+private:
+    // Called by a runner Task: removes the highest priority job and performs it
+    void runNext();
+    // Lower is sooner. Must be called with m_lock held.
+    float priority(const Job& job) const;
+
+    mutable QMutex m_lock;
+    std::vector<Job> m_pending;
+    glm::vec2 m_focusPos;
+    glm::vec2 m_focusDir;
+    std::array<JobLatency, 2> m_latency;
+    QElapsedTimer m_clock;
+    // Runner Tasks that haven't returned yet, each of which points at this scheduler
+    std::atomic<int> m_runners;
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include "blocktype.h"
+#include "glm_includes.h"
+#include <array>
+#include <vector>
+
+// An immutable copy of one Chunk's blocks, padded by one block on every horizontal side
+// with the bordering blocks of its four neighbors. Meshing reads only from a snapshot,
+// taken once when the job starts, so it never chases neighbor pointers and never sees
+// a block that a generation worker is halfway through writing.
+// Coordinates are the Chunk's own local coordinates: x and z range over [-1, 16],
+// anything outside the neighbors (or above / below the world) reads as EMPTY.
+struct ChunkSnapshot
+{
+    static constexpr int WIDTH = 18;
+    static constexpr int HEIGHT = 256;
+
+    std::vector<BlockType> blocks;
+    std::array<glm::vec4, 256> biomes;
+
+    ChunkSnapshot()
+        : blocks(WIDTH * WIDTH * HEIGHT, EMPTY)
+        , biomes()
+    {}
+
+    // y-major, so that one horizontal slice of the padded chunk is contiguous
+    static int index(int x, int y, int z)
+    {
+        return (x + 1) + WIDTH * (z + 1) + WIDTH * WIDTH * y;
+    }
+
+    BlockType getBlockAt(int x, int y, int z) const
+    {
+        if (y < 0 || y >= HEIGHT) {
+            return EMPTY;
+        }
+        return blocks[index(x, y, z)];
+    }
+
+    glm::vec4 getBiomeAt(int x, int z) const
+    {
+        return biomes[x + 16 * z];
+    }
+};
@@ -0,0 +1,110 @@
+#include "columnnoisecache.h"
+#include <algorithm>
+
+// Enough for the coarse cave lattice columns of about a thousand Chunks
+static constexpr std::size_t DEFAULT_CAPACITY = 16384;
+
+ColumnNoiseCache::ColumnNoiseCache(std::size_t capacity)
+    : m_shardCapacity(std::max<std::size_t>(1, capacity / SHARDS))
+    , m_shards()
+    , m_hits(0)
+    , m_misses(0)
+{}
+
+ColumnNoiseCache& ColumnNoiseCache::instance()
+{
+    static ColumnNoiseCache cache(DEFAULT_CAPACITY);
+    return cache;
+}
+
+ColumnNoiseCache::Key ColumnNoiseCache::toKey(ColumnNoise kind, uint32_t seed, int x, int z)
+{
+    // 28 bits each of x and z cover 134 million blocks either way from the origin
+    return Key{uint64_t(kind) << 56 | (uint64_t(uint32_t(x)) & 0xFFFFFFF) << 28
+                   | (uint64_t(uint32_t(z)) & 0xFFFFFFF),
+               seed};
+}
+
+ColumnNoiseCache::Shard& ColumnNoiseCache::shardFor(const Key& key)
+{
+    // Neighboring columns differ in their low bits, so mix them all in
+    return m_shards[(KeyHash()(key) * 0x9E3779B97F4A7C15ull) >> 60];
+}
+
+bool ColumnNoiseCache::find(ColumnNoise kind,
+                            uint32_t seed,
+                            int x,
+                            int z,
+                            std::vector<float>& out)
+{
+    Key key = toKey(kind, seed, x, z);
+    Shard& shard = shardFor(key);
+    shard.lock.lock();
+    auto it = shard.entries.find(key);
+    if (it == shard.entries.end()) {
+        shard.lock.unlock();
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    shard.usage.splice(shard.usage.begin(), shard.usage, it->second.lastUsed);
+    out = it->second.values;
+    shard.lock.unlock();
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void ColumnNoiseCache::insert(ColumnNoise kind,
+                              uint32_t seed,
+                              int x,
+                              int z,
+                              const std::vector<float>& values)
+{
+    Key key = toKey(kind, seed, x, z);
+    Shard& shard = shardFor(key);
+    shard.lock.lock();
+    auto it = shard.entries.find(key);
+    if (it != shard.entries.end()) {
+        // Another worker computed the same column first
+        shard.usage.splice(shard.usage.begin(), shard.usage, it->second.lastUsed);
+        shard.lock.unlock();
+        return;
+    }
+    if (shard.entries.size() >= m_shardCapacity) {
+        shard.entries.erase(shard.usage.back());
+        shard.usage.pop_back();
+    }
+    shard.usage.push_front(key);
+    shard.entries.emplace(key, Entry{values, shard.usage.begin()});
+    shard.lock.unlock();
+}
+
+void ColumnNoiseCache::clear()
+{
+    for (Shard& shard : m_shards) {
+        shard.lock.lock();
+        shard.entries.clear();
+        shard.usage.clear();
+        shard.lock.unlock();
+    }
+}
+
+uint64_t ColumnNoiseCache::hits() const
+{
+    return m_hits.load(std::memory_order_relaxed);
+}
+
+uint64_t ColumnNoiseCache::misses() const
+{
+    return m_misses.load(std::memory_order_relaxed);
+}
+
+std::size_t ColumnNoiseCache::size() const
+{
+    std::size_t total = 0;
+    for (const Shard& shard : m_shards) {
+        shard.lock.lock();
+        total += shard.entries.size();
+        shard.lock.unlock();
+    }
+    return total;
+}
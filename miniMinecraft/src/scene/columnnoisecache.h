@@ -0,0 +1,106 @@
+#pragma once
+#include <QMutex>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// What a ColumnNoiseCache entry holds, so different noise at the same column doesn't collide
+enum class ColumnNoise : unsigned char {
+    CAVES_MEDIUM,
+    CAVES_COARSE,
+    SURFACE,  // a Chunk's heights and biomes, at its origin
+    // The structure sites on a Chunk, at its origin. Wisteria grow in caves,
+    // so there's one kind for each CaveQuality.
+    SITES_FULL,
+    SITES_MEDIUM,
+    SITES_COARSE
+};
+
+// Noise evaluated down a world column (x, z), kept so that the Chunks generated around it
+// don't evaluate it again. Neighboring Chunks share the lattice points along their border,
+// and each BDWorker generates its Chunks independently, so without it those points'
+// noise would be worked out once for each Chunk that uses them.
+// It also keeps what's worked out for a whole Chunk that its neighbors need too, keyed by the
+// Chunk's origin: its surface, and where its structures grow from.
+// It's shared by every BDWorker, so its entries are split between shards, each with its
+// own lock, to keep the workers from waiting on one another. Each shard holds a bounded
+// number of entries and evicts the least recently used first.
+// Noise is a pure function of the world's seed and its position, so entries are keyed by
+// both, and a worker that misses may safely compute an entry another worker is also computing.
+class ColumnNoiseCache
+{
+public:
+    // capacity is the most entries kept across all the shards
+    explicit ColumnNoiseCache(std::size_t capacity);
+
+    ColumnNoiseCache(const ColumnNoiseCache&) = delete;
+    ColumnNoiseCache& operator=(const ColumnNoiseCache&) = delete;
+
+    // The cache the game's terrain generation shares, created on first use
+    static ColumnNoiseCache& instance();
+
+    // Copies the values cached for kind at column (x, z) of the world generated from seed
+    // into out and returns true, or returns false if there are none
+    bool find(ColumnNoise kind, uint32_t seed, int x, int z, std::vector<float>& out);
+    // Caches values for kind at column (x, z) of the world generated from seed, evicting the
+    // shard's least recently used entry if it's full
+    void insert(ColumnNoise kind,
+                uint32_t seed,
+                int x,
+                int z,
+                const std::vector<float>& values);
+    // Drops every entry. The hit and miss counts are kept.
+    void clear();
+
+    uint64_t hits() const;
+    uint64_t misses() const;
+    std::size_t size() const;
+
+private:
+    static constexpr std::size_t SHARDS = 16;
+
+    struct Key
+    {
+        uint64_t column;  // kind and column packed together
+        uint32_t seed;
+
+        bool operator==(const Key& other) const
+        {
+            return column == other.column && seed == other.seed;
+        }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            return std::hash<uint64_t>()(key.column ^ uint64_t(key.seed) << 32);
+        }
+    };
+
+    struct Entry
+    {
+        std::vector<float> values;
+        std::list<Key>::iterator lastUsed;
+    };
+
+    struct Shard
+    {
+        mutable QMutex lock;
+        std::unordered_map<Key, Entry, KeyHash> entries;
+        std::list<Key> usage;  // most recently used first
+    };
+
+    std::size_t m_shardCapacity;
+    std::array<Shard, SHARDS> m_shards;
+    std::atomic<uint64_t> m_hits;
+    std::atomic<uint64_t> m_misses;
+
+    static Key toKey(ColumnNoise kind, uint32_t seed, int x, int z);
+    Shard& shardFor(const Key& key);
+};
@@ -0,0 +1,197 @@
+#include "editjournal.h"
+#include "chunk.h"
+#include "terrain.h"
+#include <QByteArray>
+#include <QDebug>
+#include <QSaveFile>
+#include <cstring>
+
+static constexpr char MAGIC[4] = {'M', 'M', 'E', 'J'};
+static constexpr int HEADER_SIZE = 8;
+static constexpr int RECORD_SIZE = 16;
+// The file is only compacted once it has at least this many records
+static constexpr std::size_t COMPACT_MIN_RECORDS = 4096;
+
+static QByteArray encodeHeader()
+{
+    QByteArray header(HEADER_SIZE, '\0');
+    uint32_t version = EditJournal::VERSION;
+    std::memcpy(header.data(), MAGIC, sizeof(MAGIC));
+    std::memcpy(header.data() + 4, &version, sizeof(version));
+    return header;
+}
+
+static QByteArray encodeRecord(int x, int y, int z, BlockType t)
+{
+    QByteArray record(RECORD_SIZE, '\0');
+    int32_t pos[3] = {x, y, z};
+    std::memcpy(record.data(), pos, sizeof(pos));
+    record[12] = static_cast<char>(t);
+    return record;
+}
+
+// Lower-left corner of the Chunk containing world position (x, z)
+static glm::ivec2 chunkOf(int x, int z)
+{
+    return glm::ivec2(16 * static_cast<int>(glm::floor(x / 16.f)),
+                      16 * static_cast<int>(glm::floor(z / 16.f)));
+}
+
+EditJournal::EditJournal(const QString& path)
+    : m_path(path)
+    , m_file(path)
+    , m_recordCount(0)
+    , m_hasCleared(false)
+    , m_lock()
+    , m_edits()
+{
+    if (read()) {
+        m_file.open(QIODevice::WriteOnly | QIODevice::Append);
+    } else {
+        rewrite();
+    }
+}
+
+EditJournal::~EditJournal()
+{
+    flush();
+}
+
+bool EditJournal::read()
+{
+    QFile file(m_path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    if (file.size() < HEADER_SIZE) {
+        return false;
+    }
+
+    uchar* data = file.map(0, file.size());
+    if (!data) {
+        return false;
+    }
+
+    uint32_t version = 0;
+    std::memcpy(&version, data + 4, sizeof(version));
+    if (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0 || version != VERSION) {
+        qWarning() << "Starting a new edit journal in place of" << m_path;
+        file.unmap(data);
+        return false;
+    }
+
+    // A record cut short by a crash is dropped
+    std::size_t count = (file.size() - HEADER_SIZE) / RECORD_SIZE;
+    m_lock.lock();
+    for (std::size_t i = 0; i < count; i++) {
+        const uchar* record = data + HEADER_SIZE + i * RECORD_SIZE;
+        int32_t pos[3];
+        std::memcpy(pos, record, sizeof(pos));
+        apply(pos[0], pos[1], pos[2], static_cast<BlockType>(record[12]));
+    }
+    m_lock.unlock();
+    m_recordCount = count;
+
+    file.unmap(data);
+    return static_cast<std::size_t>(file.size()) == HEADER_SIZE + count * RECORD_SIZE;
+}
+
+void EditJournal::rewrite()
+{
+    m_file.close();
+
+    QByteArray data = encodeHeader();
+    std::size_t count = 0;
+    m_lock.lock();
+    for (const auto& chunk : m_edits) {
+        glm::ivec2 corner = toCoords(chunk.first);
+        for (const auto& edit : chunk.second) {
+            data.append(encodeRecord(corner.x + edit.first % 16,
+                                     edit.first / 16 % 256,
+                                     corner.y + edit.first / 4096,
+                                     edit.second));
+            count++;
+        }
+    }
+    m_lock.unlock();
+
+    // Replaced in one go, so a crash leaves either the old journal or the new one
+    QSaveFile out(m_path);
+    if (!out.open(QIODevice::WriteOnly) || out.write(data) != data.size() || !out.commit()) {
+        qWarning() << "Could not write edit journal" << m_path;
+    }
+    m_recordCount = count;
+    m_hasCleared = false;
+
+    m_file.open(QIODevice::WriteOnly | QIODevice::Append);
+}
+
+void EditJournal::apply(int x, int y, int z, BlockType t)
+{
+    glm::ivec2 corner = chunkOf(x, z);
+    uint32_t index = (x - corner.x) + 16 * y + 4096 * (z - corner.y);
+    m_edits[toKey(corner.x, corner.y)][index] = t;
+}
+
+void EditJournal::record(int x, int y, int z, BlockType t)
+{
+    m_lock.lock();
+    apply(x, y, z, t);
+    m_lock.unlock();
+
+    m_file.write(encodeRecord(x, y, z, t));
+    m_recordCount++;
+}
+
+void EditJournal::replay(Chunk* c) const
+{
+    glm::ivec2 corner = c->getWorldPos();
+
+    // Copied out so that the lock isn't held while c's blocks are locked
+    ChunkEdits edits;
+    m_lock.lock();
+    auto it = m_edits.find(toKey(corner.x, corner.y));
+    if (it != m_edits.end()) {
+        edits = it->second;
+    }
+    m_lock.unlock();
+
+    for (const auto& edit : edits) {
+        c->setBlockAt(edit.first % 16, edit.first / 16 % 256, edit.first / 4096, edit.second);
+    }
+}
+
+std::size_t EditJournal::editCount(int x, int z) const
+{
+    m_lock.lock();
+    auto it = m_edits.find(toKey(x, z));
+    std::size_t count = it == m_edits.end() ? 0 : it->second.size();
+    m_lock.unlock();
+    return count;
+}
+
+void EditJournal::clear(int x, int z)
+{
+    m_lock.lock();
+    m_hasCleared = m_edits.erase(toKey(x, z)) > 0 || m_hasCleared;
+    m_lock.unlock();
+}
+
+void EditJournal::flush()
+{
+    m_file.flush();
+}
+
+void EditJournal::compact()
+{
+    std::size_t live = 0;
+    m_lock.lock();
+    for (const auto& chunk : m_edits) {
+        live += chunk.second.size();
+    }
+    m_lock.unlock();
+
+    if (m_hasCleared || (m_recordCount >= COMPACT_MIN_RECORDS && m_recordCount > 2 * live)) {
+        rewrite();
+    }
+}
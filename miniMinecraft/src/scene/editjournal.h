@@ -0,0 +1,72 @@
+#pragma once
+#include "blocktype.h"
+#include <QFile>
+#include <QMutex>
+#include <QString>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class Chunk;
+
+// An append-only log of the blocks the player has changed. Terrain is generated
+// deterministically, so a Chunk is rebuilt by generating it again and replaying its edits,
+// and the saved world only grows with what the player does, not with how far they travel.
+//
+// The file is "MMEJ" and the format version, followed by one 16-byte record per edit:
+// the block's world x, y and z as 32-bit ints, its new BlockType, and 3 bytes of padding,
+// all in native byte order. In memory only the latest edit of each block is kept.
+class EditJournal
+{
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    // Reads the edits already in the journal at path and opens it for appending,
+    // starting a new journal if there isn't one
+    explicit EditJournal(const QString& path);
+    ~EditJournal();
+
+    EditJournal(const EditJournal&) = delete;
+    EditJournal& operator=(const EditJournal&) = delete;
+
+    // GL thread. Appends an edit setting the block at world position (x, y, z) to t.
+    void record(int x, int y, int z, BlockType t);
+    // Any thread. Sets every block of c that has been edited to its latest edit.
+    void replay(Chunk* c) const;
+    // Number of distinct blocks of the Chunk with its lower-left corner at (x, z) that
+    // have been edited
+    std::size_t editCount(int x, int z) const;
+    // GL thread. Forgets the Chunk's edits, once a snapshot of it holds them instead.
+    // They stay in the file until the next compact, which then always rewrites it.
+    void clear(int x, int z);
+
+    // GL thread. Writes out any records still buffered.
+    void flush();
+    // GL thread. Rewrites the file with just one record per edited block, once most of
+    // its records have been overwritten or any Chunk's edits have been cleared, so that
+    // they aren't replayed over its snapshot after a restart. Snapshots of cleared Chunks
+    // have to be on disk first.
+    void compact();
+
+private:
+    // Latest BlockType of each edited block of a Chunk, keyed by PalettedSection-style
+    // index x + 16 * y + 4096 * z, with y running up the whole Chunk
+    using ChunkEdits = std::unordered_map<uint32_t, BlockType>;
+
+    QString m_path;
+    QFile m_file;
+    std::size_t m_recordCount;  // records in the file, including overwritten ones
+    bool m_hasCleared;          // whether the file still holds edits clear has dropped
+
+    mutable QMutex m_lock;  // guards m_edits, which workers read while replaying
+    std::unordered_map<int64_t, ChunkEdits> m_edits;
+
+    // Loads the edits in the file. Returns false if it's missing, unreadable or ends
+    // in a partial record, in which case it has to be rewritten before it's appended to.
+    bool read();
+    // Replaces the file with one record per edit in m_edits and reopens it for appending
+    void rewrite();
+    // Must be called with m_lock held
+    void apply(int x, int y, int z, BlockType t);
+};
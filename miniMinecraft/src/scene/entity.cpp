@@ -423,8 +423,7 @@ bool Entity::gridMarch(glm::vec3 rayOrigin,
             continue;
         }
 
-        if (cellType != EMPTY && !Chunk::isHPlane(cellType) && !Chunk::isCross2(cellType)
-            && !Chunk::isCross4(cellType) && cellType != WATER && cellType != LAVA) {
+        if (BlockTraits::isCollidable(cellType)) {
             if (out_type) {
                 *out_type = cellType;
             }
@@ -473,10 +472,7 @@ void Entity::isOnGround(Terrain& terrain)
                                     bottomLeftVertex.y - 0.05f,
                                     bottomLeftVertex.z + playerDimensions[z]);
 
-            if (terrain.getBlockAt(p) != EMPTY && !Chunk::isHPlane(terrain.getBlockAt(p))
-                && !Chunk::isCross2(terrain.getBlockAt(p))
-                && !Chunk::isCross4(terrain.getBlockAt(p)) && terrain.getBlockAt(p) != WATER
-                && terrain.getBlockAt(p) != LAVA) {
+            if (BlockTraits::isCollidable(terrain.getBlockAt(p))) {
                 acc = acc || true;
             } else {
                 acc = acc || false;
@@ -523,8 +519,7 @@ void Entity::drawPath(Terrain& terrain)
 
         BlockType cellType = terrain.getBlockAt(bottomCell);
 
-        if (cellType != EMPTY && cellType != WATER && cellType != LAVA && !Chunk::isHPlane(cellType)
-            && !Chunk::isCross2(cellType) && !Chunk::isCross4(cellType)) {
+        if (BlockTraits::isCollidable(cellType)) {
             terrain.changeBlockAt(bottomCell.x, bottomCell.y, bottomCell.z, MOSS_STONE);
         }
     }
@@ -0,0 +1,126 @@
+#include "faceculling.h"
+#include "blocktraits.h"
+
+namespace
+{
+constexpr auto isHPlane = &BlockTraits::isHPlane;
+constexpr auto isCross2 = &BlockTraits::isCross2;
+constexpr auto isCross4 = &BlockTraits::isCross4;
+constexpr auto isPartialX = &BlockTraits::isPartialX;
+constexpr auto isPartialY = &BlockTraits::isPartialY;
+constexpr auto isPartialZ = &BlockTraits::isPartialZ;
+constexpr auto isFullCube = &BlockTraits::isFullCube;
+constexpr auto isTransparent = &BlockTraits::isTransparent;
+}  // namespace
+
+FaceCulling::FaceCulling()
+    : m_visible()
+{
+    for (int d = 0; d < NUM_DIRECTIONS; d++) {
+        for (int bt = 0; bt < 256; bt++) {
+            for (int adj = 0; adj < 256; adj++) {
+                if (computeVisible(static_cast<BlockType>(bt),
+                                   static_cast<BlockType>(adj),
+                                   static_cast<Direction>(d))) {
+                    unsigned int i = (d * 256 + bt) * 256 + adj;
+                    m_visible[i >> 6] |= uint64_t(1) << (i & 63);
+                }
+            }
+        }
+    }
+}
+
+const FaceCulling& FaceCulling::instance()
+{
+    // built on first use; thread-safe, since meshing workers may get here at the same time
+    static const FaceCulling table;
+    return table;
+}
+
+bool FaceCulling::computeVisible(BlockType bt, BlockType adjBlockType, Direction d)
+{
+    if (adjBlockType == EMPTY) {
+        return true;
+    }
+
+    if (isFullCube(bt) && isFullCube(adjBlockType) && !isTransparent(adjBlockType)) {
+        return false;
+    }
+
+    if ((bt == WATER || bt == LAVA || bt == ICE)
+        && (bt == adjBlockType
+            || ((isCross4(adjBlockType) || isCross2(adjBlockType)) && d != YPOS))) {
+        return false;
+    }
+
+    if (bt == WATER && (adjBlockType == RICE_01 || adjBlockType == RICE_02)) {
+        return false;
+    }
+
+    if ((d == XPOS || d == XNEG) && isPartialX(bt) && !isPartialY(bt) && !isPartialZ(bt)
+        && bt == adjBlockType) {
+        return false;
+    }
+
+    if ((d == YPOS || d == YNEG) && isPartialY(bt) && !isPartialX(bt) && !isPartialZ(bt)
+        && bt == adjBlockType) {
+        return false;
+    }
+
+    if ((d == ZPOS || d == ZNEG) && isPartialZ(bt) && !isPartialX(bt) && !isPartialY(bt)
+        && bt == adjBlockType) {
+        return false;
+    }
+    // if the block adjacent to this face is EMPTY or transparent and is of a different type
+    if (isTransparent(adjBlockType) && adjBlockType != bt) {
+        return true;
+    }
+
+    if ((bt == CEDAR_LEAVES || bt == TEAK_LEAVES || bt == CHERRY_BLOSSOMS_1
+         || bt == CHERRY_BLOSSOMS_2 || bt == CHERRY_BLOSSOMS_3 || bt == CHERRY_BLOSSOMS_4
+         || bt == MAPLE_LEAVES_1 || bt == MAPLE_LEAVES_2 || bt == MAPLE_LEAVES_3 || bt == PINE_LEAVES
+         || bt == WISTERIA_BLOSSOMS_1 || bt == WISTERIA_BLOSSOMS_2 || bt == WISTERIA_BLOSSOMS_3)
+        && bt == adjBlockType) {
+        return true;
+    }
+
+    if (isHPlane(adjBlockType) || isCross2(adjBlockType) || isCross4(adjBlockType)) {
+        return true;
+    }
+
+    // if not a cube or partial block
+    if (isHPlane(bt) || isCross2(bt) || isCross4(bt)) {
+        return true;
+    }
+
+    // if this face or adjacent block face doesn't reach the bounds of a full block
+    if (((d == XPOS || d == XNEG)
+         && (isPartialX(bt) || isPartialX(adjBlockType) || isPartialY(adjBlockType)
+             || isPartialZ(adjBlockType)))
+        || ((d == YPOS) && (isPartialY(bt) || isPartialX(adjBlockType) || isPartialZ(adjBlockType)))
+        || ((d == YNEG)
+            && (isPartialX(adjBlockType) || isPartialY(adjBlockType) || isPartialZ(adjBlockType)))
+        || ((d == ZPOS || d == ZNEG)
+            && (isPartialZ(bt) || isPartialX(adjBlockType) || isPartialY(adjBlockType)
+                || isPartialZ(adjBlockType)))) {
+        return true;
+    }
+
+    if (d == YNEG
+        && (bt == CEDAR_PLANKS_2 || bt == TEAK_PLANKS_2 || bt == CHERRY_PLANKS_2
+            || bt == MAPLE_PLANKS_2 || bt == PINE_PLANKS_2 || bt == WISTERIA_PLANKS_2
+            || bt == ROOF_TILES_2 || bt == STRAW_2)) {
+        return true;
+    }
+
+    if (d == YPOS
+        && (adjBlockType == CEDAR_PLANKS_2 || adjBlockType == TEAK_PLANKS_2
+            || adjBlockType == CHERRY_PLANKS_2 || adjBlockType == MAPLE_PLANKS_2
+            || adjBlockType == PINE_PLANKS_2 || adjBlockType == WISTERIA_PLANKS_2
+            || adjBlockType == ROOF_TILES_2 || adjBlockType == STRAW_2)) {
+        return true;
+    }
+
+
+    return false;
+}
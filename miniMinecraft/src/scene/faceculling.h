@@ -0,0 +1,32 @@
+#pragma once
+#include "blocktype.h"
+#include <array>
+#include <cstdint>
+
+// Whether the face of a block pointing along one of the six axis directions is drawn,
+// given the block on the other side of it, for every pair of BlockTypes.
+// The per-BlockType rules are evaluated once, when the table is first used,
+// so culling a face while meshing costs a single bit test.
+// A block that is enclosed on all sides draws no faces at all; that depends on more
+// than one neighbor, so Chunk checks it separately.
+class FaceCulling
+{
+public:
+    // d must be one of XPOS, XNEG, YPOS, YNEG, ZPOS or ZNEG
+    static bool isVisible(BlockType bt, BlockType adj, Direction d)
+    {
+        unsigned int i = (unsigned(d) * 256 + bt) * 256 + adj;
+        return (instance().m_visible[i >> 6] >> (i & 63)) & 1;
+    }
+
+private:
+    static constexpr int NUM_DIRECTIONS = 6;
+
+    // one bit per (Direction, BlockType, adjacent BlockType)
+    std::array<uint64_t, NUM_DIRECTIONS * 256 * 256 / 64> m_visible;
+
+    FaceCulling();
+    static const FaceCulling& instance();
+    // The rules the table is built from
+    static bool computeVisible(BlockType bt, BlockType adjBlockType, Direction d);
+};
@@ -0,0 +1,120 @@
+#pragma once
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+// A SIMD register's worth of floats: 8 with AVX2, 4 with SSE2, and a single float on
+// anything else. Adds, subtracts and multiplies round the same way in every lane as they
+// do in scalar code, so code written with them gives bit-identical results on every path,
+// as long as the compiler isn't allowed to fuse multiplies and adds.
+#if defined(__AVX2__)
+struct FloatLanes
+{
+    static constexpr int COUNT = 8;
+    __m256 v;
+
+    static FloatLanes load(const float* p)
+    {
+        return {_mm256_loadu_ps(p)};
+    }
+    static FloatLanes broadcast(float f)
+    {
+        return {_mm256_set1_ps(f)};
+    }
+    // table[index[i]] in lane i
+    static FloatLanes gather(const float* table, const int* index)
+    {
+        __m256i i = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(index));
+        return {_mm256_i32gather_ps(table, i, sizeof(float))};
+    }
+    void store(float* p) const
+    {
+        _mm256_storeu_ps(p, v);
+    }
+    FloatLanes operator+(FloatLanes o) const
+    {
+        return {_mm256_add_ps(v, o.v)};
+    }
+    FloatLanes operator-(FloatLanes o) const
+    {
+        return {_mm256_sub_ps(v, o.v)};
+    }
+    FloatLanes operator*(FloatLanes o) const
+    {
+        return {_mm256_mul_ps(v, o.v)};
+    }
+};
+#elif defined(__SSE2__) || defined(_M_X64)
+struct FloatLanes
+{
+    static constexpr int COUNT = 4;
+    __m128 v;
+
+    static FloatLanes load(const float* p)
+    {
+        return {_mm_loadu_ps(p)};
+    }
+    static FloatLanes broadcast(float f)
+    {
+        return {_mm_set1_ps(f)};
+    }
+    static FloatLanes gather(const float* table, const int* index)
+    {
+        return {_mm_setr_ps(table[index[0]], table[index[1]], table[index[2]], table[index[3]])};
+    }
+    void store(float* p) const
+    {
+        _mm_storeu_ps(p, v);
+    }
+    FloatLanes operator+(FloatLanes o) const
+    {
+        return {_mm_add_ps(v, o.v)};
+    }
+    FloatLanes operator-(FloatLanes o) const
+    {
+        return {_mm_sub_ps(v, o.v)};
+    }
+    FloatLanes operator*(FloatLanes o) const
+    {
+        return {_mm_mul_ps(v, o.v)};
+    }
+};
+#else
+struct FloatLanes
+{
+    static constexpr int COUNT = 1;
+    float v;
+
+    static FloatLanes load(const float* p)
+    {
+        return {*p};
+    }
+    static FloatLanes broadcast(float f)
+    {
+        return {f};
+    }
+    static FloatLanes gather(const float* table, const int* index)
+    {
+        return {table[index[0]]};
+    }
+    void store(float* p) const
+    {
+        *p = v;
+    }
+    FloatLanes operator+(FloatLanes o) const
+    {
+        return {v + o.v};
+    }
+    FloatLanes operator-(FloatLanes o) const
+    {
+        return {v - o.v};
+    }
+    FloatLanes operator*(FloatLanes o) const
+    {
+        return {v * o.v};
+    }
+};
+#endif
@@ -0,0 +1,350 @@
+#include "jobsystem.h"
+#include <QThread>
+#include <algorithm>
+
+int JobSystem::s_defaultWorkerCount = 0;
+
+// Index of the calling thread among its JobSystem's workers, or -1 if it isn't a worker
+static thread_local int t_workerIndex = -1;
+static thread_local const JobSystem* t_workerOwner = nullptr;
+
+WorkStealingDeque::WorkStealingDeque()
+    : m_top(0)
+    , m_bottom(0)
+    , m_tasks()
+{}
+
+bool WorkStealingDeque::push(Task* task)
+{
+    int64_t b = m_bottom.load(std::memory_order_relaxed);
+    int64_t t = m_top.load(std::memory_order_acquire);
+    if (b - t >= CAPACITY) {
+        return false;
+    }
+
+    // released so that whichever thread takes the Task also sees what's inside it
+    m_tasks[b & (CAPACITY - 1)].store(task, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+}
+
+Task* WorkStealingDeque::pop()
+{
+    int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = m_top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        // empty
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Task* task = m_tasks[b & (CAPACITY - 1)].load(std::memory_order_acquire);
+    if (t == b) {
+        // The last Task: race any thief for it
+        if (!m_top.compare_exchange_strong(t,
+                                           t + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed)) {
+            task = nullptr;
+        }
+        m_bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+}
+
+Task* WorkStealingDeque::steal()
+{
+    int64_t t = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = m_bottom.load(std::memory_order_acquire);
+
+    if (t >= b) {
+        return nullptr;
+    }
+
+    Task* task = m_tasks[t & (CAPACITY - 1)].load(std::memory_order_acquire);
+    if (!m_top.compare_exchange_strong(t,
+                                       t + 1,
+                                       std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return task;
+}
+
+JobSystem::JobSystem(int workerCount)
+    : m_workers()
+    , m_stopping(false)
+    , m_injectedLock()
+    , m_injected()
+    , m_sleepLock()
+    , m_wake()
+    , m_sleeping(0)
+    , m_queued(0)
+{
+    if (workerCount <= 0) {
+        workerCount = std::max(1, QThread::idealThreadCount() - 1);
+    }
+
+    // All the deques exist before any worker starts looking for something to steal
+    for (int i = 0; i < workerCount; i++) {
+        m_workers.push_back(new Worker());
+    }
+    for (int i = 0; i < workerCount; i++) {
+        m_workers[i]->thread = std::thread(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    m_stopping.store(true);
+    m_sleepLock.lock();
+    m_wake.wakeAll();
+    m_sleepLock.unlock();
+
+    for (Worker* w : m_workers) {
+        w->thread.join();
+    }
+
+    // With the workers gone, nothing is left to run what's still queued. The Tasks are
+    // deleted outright: the calling thread's cache may already be gone at exit.
+    auto drop = [](Task* task) {
+        task->m_destroy(task);
+        delete task;
+    };
+    for (Task* task : m_injected) {
+        drop(task);
+    }
+    m_injected.clear();
+    for (Worker* w : m_workers) {
+        while (Task* task = w->deque.steal()) {
+            drop(task);
+        }
+        delete w;
+    }
+}
+
+JobSystem& JobSystem::instance()
+{
+    static JobSystem jobSystem(s_defaultWorkerCount);
+    return jobSystem;
+}
+
+void JobSystem::setDefaultWorkerCount(int workerCount)
+{
+    s_defaultWorkerCount = workerCount;
+}
+
+int JobSystem::workerCount() const
+{
+    return static_cast<int>(m_workers.size());
+}
+
+bool JobSystem::isWorkerThread() const
+{
+    return t_workerOwner == this;
+}
+
+void JobSystem::run(Task* task)
+{
+    if (isWorkerThread()) {
+        if (!m_workers[t_workerIndex]->deque.push(task)) {
+            // Our deque is full, so there's plenty for everyone else to steal
+            execute(task);
+            return;
+        }
+    } else {
+        m_injectedLock.lock();
+        m_injected.push_back(task);
+        m_injectedLock.unlock();
+    }
+    m_queued++;
+    wakeOne();
+}
+
+void JobSystem::wait(Task* task)
+{
+    int index = isWorkerThread() ? t_workerIndex : -1;
+
+    while (task->m_unfinished.load(std::memory_order_acquire) > 0) {
+        // Workers help out while they wait. Other threads only wait: the GL thread
+        // mustn't end up running a whole zone's generation in the middle of a frame.
+        // Nor do workers take from the shared queue, where the Terrain's jobs come in:
+        // those wait on children of their own, so they'd nest on this worker's stack, and
+        // whatever job this one is waiting for would finish only after all of them.
+        Task* other = index >= 0 ? findTask(index, false) : nullptr;
+        if (other) {
+            execute(other);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    freeTask(task);
+}
+
+void JobSystem::workerLoop(int index)
+{
+    t_workerIndex = index;
+    t_workerOwner = this;
+
+    while (!m_stopping.load()) {
+        Task* task = findTask(index, true);
+        if (task) {
+            execute(task);
+            continue;
+        }
+
+        // Nothing to do: sleep until a Task is run. A Task run after findTask failed is
+        // either counted in m_queued by now, or its run sees this worker in m_sleeping
+        // and wakes it, which it can only do once the worker is waiting.
+        m_sleepLock.lock();
+        m_sleeping++;
+        if (!m_stopping.load() && m_queued.load() <= 0) {
+            m_wake.wait(&m_sleepLock);
+        }
+        m_sleeping--;
+        m_sleepLock.unlock();
+    }
+}
+
+Task* JobSystem::findTask(int index, bool takeInjected)
+{
+    Task* task = m_workers[index]->deque.pop();
+    if (task) {
+        m_queued--;
+        return task;
+    }
+
+    if (takeInjected) {
+        m_injectedLock.lock();
+        if (!m_injected.empty()) {
+            task = m_injected.front();
+            m_injected.pop_front();
+        }
+        m_injectedLock.unlock();
+        if (task) {
+            m_queued--;
+            return task;
+        }
+    }
+
+    // Start stealing from a different victim on each worker to spread out contention
+    int n = workerCount();
+    for (int i = 1; i < n; i++) {
+        task = m_workers[(index + i) % n]->deque.steal();
+        if (task) {
+            m_queued--;
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::execute(Task* task)
+{
+    task->m_invoke(task);
+    task->m_destroy(task);
+    finish(task);
+}
+
+void JobSystem::finish(Task* task)
+{
+    // Read before the count drops, since a waiter may free the Task as soon as it reaches 0
+    Task* parent = task->m_parent;
+    bool detached = task->m_detached;
+
+    if (task->m_unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+        return;
+    }
+
+    if (detached) {
+        freeTask(task);
+    }
+    if (parent) {
+        finish(parent);
+    }
+}
+
+void JobSystem::wakeOne()
+{
+    if (m_sleeping.load() > 0) {
+        m_sleepLock.lock();
+        m_wake.wakeOne();
+        m_sleepLock.unlock();
+    }
+}
+
+// Frees the pool's Tasks at exit, once every thread that trades with it is gone
+struct TaskPool
+{
+    std::vector<Task*> tasks;
+
+    ~TaskPool()
+    {
+        for (Task* t : tasks) {
+            delete t;
+        }
+    }
+};
+
+// Shared pool that the per-thread caches trade Tasks with
+static QMutex s_taskPoolLock;
+static TaskPool s_taskPool;
+static constexpr std::size_t TASK_BATCH = 32;
+
+// Frees the cache's Tasks when its thread exits
+struct TaskCache
+{
+    std::vector<Task*> tasks;
+
+    ~TaskCache()
+    {
+        for (Task* t : tasks) {
+            delete t;
+        }
+    }
+};
+
+static thread_local TaskCache t_taskCache;
+
+Task* JobSystem::allocateTask()
+{
+    std::vector<Task*>& cache = t_taskCache.tasks;
+
+    if (cache.empty()) {
+        s_taskPoolLock.lock();
+        std::vector<Task*>& pool = s_taskPool.tasks;
+        std::size_t n = std::min(TASK_BATCH, pool.size());
+        cache.insert(cache.end(), pool.end() - n, pool.end());
+        pool.resize(pool.size() - n);
+        s_taskPoolLock.unlock();
+    }
+
+    if (cache.empty()) {
+        return new Task();
+    }
+
+    Task* task = cache.back();
+    cache.pop_back();
+    return task;
+}
+
+void JobSystem::freeTask(Task* task)
+{
+    std::vector<Task*>& cache = t_taskCache.tasks;
+    cache.push_back(task);
+
+    // Tasks are mostly made on one thread and finished on another,
+    // so full caches hand a batch back for the thread that makes them
+    if (cache.size() >= 2 * TASK_BATCH) {
+        s_taskPoolLock.lock();
+        s_taskPool.tasks.insert(s_taskPool.tasks.end(), cache.end() - TASK_BATCH, cache.end());
+        s_taskPoolLock.unlock();
+        cache.resize(cache.size() - TASK_BATCH);
+    }
+}
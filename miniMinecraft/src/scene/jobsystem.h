@@ -0,0 +1,199 @@
+#pragma once
+#include <QMutex>
+#include <QWaitCondition>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// A unit of work for the JobSystem. Tasks are made with JobSystem::create or createChild,
+// which store the callable inside the Task itself, so a Task never allocates.
+// A Task isn't finished until its callable has returned and all of its children have finished.
+class Task
+{
+public:
+    static constexpr std::size_t STORAGE = 64;
+
+private:
+    void (*m_invoke)(Task*);
+    void (*m_destroy)(Task*);
+    Task* m_parent;
+    bool m_detached;  // freed as soon as it finishes, rather than by wait
+    std::atomic<int> m_unfinished;  // 1 for the Task itself, plus 1 per unfinished child
+    alignas(std::max_align_t) unsigned char m_storage[STORAGE];
+
+    friend class JobSystem;
+};
+
+// A bounded Chase-Lev work-stealing deque. Its owning worker pushes and pops tasks at the
+// bottom, like a stack, so it works depth first on whatever it split most recently;
+// other workers steal from the top, taking the oldest, and usually largest, pieces of work.
+class WorkStealingDeque
+{
+public:
+    static constexpr int64_t CAPACITY = 4096;
+
+    WorkStealingDeque();
+
+    // Owner only. Returns false if the deque is full.
+    bool push(Task* task);
+    // Owner only. Returns nullptr if the deque is empty.
+    Task* pop();
+    // Any thread. Returns nullptr if the deque is empty or another thread got there first.
+    Task* steal();
+
+private:
+    alignas(64) std::atomic<int64_t> m_top;
+    alignas(64) std::atomic<int64_t> m_bottom;
+    std::array<std::atomic<Task*>, CAPACITY> m_tasks;
+};
+
+// A pool of worker threads that share out Tasks by work stealing. Every worker keeps its
+// own deque of Tasks; Tasks made on a worker go to its own deque, and Tasks made on any
+// other thread (e.g. the GL thread) go to a shared queue. A worker with nothing to do takes
+// from the shared queue, then steals from the other workers.
+// A Task may split itself into child Tasks and wait for them. A worker that waits keeps
+// running Tasks from the deques in the meantime, so nesting never ties up a thread, but
+// leaves the shared queue alone: a Task from there is a whole new piece of work, and
+// running it inside the wait would hold up the one waiting until it was done.
+class JobSystem
+{
+public:
+    // workerCount <= 0 picks one fewer worker than there are cores, leaving one for the GL thread
+    explicit JobSystem(int workerCount = 0);
+    // Stops the workers. Tasks that haven't started by then are dropped, and what their
+    // callables hold is destroyed.
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // The JobSystem the game's terrain work runs on, created on first use
+    static JobSystem& instance();
+    // Sets how many workers instance() starts with. Only has an effect before its first call.
+    static void setDefaultWorkerCount(int workerCount);
+
+    // A Task that runs f, to be passed to run and then to wait
+    template<typename F>
+    Task* create(F&& f);
+    // A Task that runs f as a child of parent, which won't finish until it does.
+    // It's freed once it finishes, so it's only passed to run, never to wait.
+    template<typename F>
+    Task* createChild(Task* parent, F&& f);
+
+    void run(Task* task);
+    // Runs other Tasks until task and its children are finished, then frees task
+    void wait(Task* task);
+    // Runs f once, at some point, with nothing waiting on it
+    template<typename F>
+    void runDetached(F&& f);
+    // Calls f(i) for every i in [0, count), split across the workers,
+    // and returns once they've all been called
+    template<typename F>
+    void parallelFor(int count, F&& f);
+
+    int workerCount() const;
+    // Whether the calling thread is one of this JobSystem's workers
+    bool isWorkerThread() const;
+
+private:
+    struct Worker
+    {
+        WorkStealingDeque deque;
+        std::thread thread;
+    };
+
+    std::vector<Worker*> m_workers;
+    std::atomic<bool> m_stopping;
+
+    // Tasks run from threads that aren't workers
+    QMutex m_injectedLock;
+    std::deque<Task*> m_injected;
+
+    // Workers with nothing to do sleep here until more Tasks are run
+    QMutex m_sleepLock;
+    QWaitCondition m_wake;
+    std::atomic<int> m_sleeping;
+    // Tasks run and not yet taken, which a worker checks before it falls asleep.
+    // It's counted after a Task is queued, so it can dip below 0 for a moment.
+    std::atomic<int> m_queued;
+
+    static int s_defaultWorkerCount;
+
+    void workerLoop(int index);
+    // Pops from the calling worker's own deque, then the shared queue unless takeInjected is
+    // false, then steals
+    Task* findTask(int index, bool takeInjected);
+    void execute(Task* task);
+    void finish(Task* task);
+    void wakeOne();
+
+    template<typename F>
+    Task* make(F&& f, Task* parent, bool detached);
+
+    // Task allocation. Each thread keeps a small cache of free Tasks and trades
+    // them with a shared pool in batches, so most allocations touch no lock at all.
+    static Task* allocateTask();
+    static void freeTask(Task* task);
+};
+
+template<typename F>
+Task* JobSystem::make(F&& f, Task* parent, bool detached)
+{
+    using Fn = std::decay_t<F>;
+    static_assert(sizeof(Fn) <= Task::STORAGE,
+                  "Task callable is too large; capture less by value");
+
+    Task* task = allocateTask();
+    new (task->m_storage) Fn(std::forward<F>(f));
+    task->m_invoke = [](Task* t) {
+        (*std::launder(reinterpret_cast<Fn*>(t->m_storage)))();
+    };
+    task->m_destroy = [](Task* t) {
+        std::launder(reinterpret_cast<Fn*>(t->m_storage))->~Fn();
+    };
+    task->m_parent = parent;
+    task->m_detached = detached;
+    task->m_unfinished.store(1);
+
+    if (parent) {
+        parent->m_unfinished++;
+    }
+    return task;
+}
+
+template<typename F>
+Task* JobSystem::create(F&& f)
+{
+    return make(std::forward<F>(f), nullptr, false);
+}
+
+template<typename F>
+Task* JobSystem::createChild(Task* parent, F&& f)
+{
+    return make(std::forward<F>(f), parent, true);
+}
+
+template<typename F>
+void JobSystem::runDetached(F&& f)
+{
+    run(make(std::forward<F>(f), nullptr, true));
+}
+
+template<typename F>
+void JobSystem::parallelFor(int count, F&& f)
+{
+    Task* root = create([]() {});
+    for (int i = 0; i < count; i++) {
+        run(createChild(root, [&f, i]() { f(i); }));
+    }
+    // root itself has nothing to do; running it here just marks that part finished
+    execute(root);
+    wait(root);
+}
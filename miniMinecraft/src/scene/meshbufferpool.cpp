@@ -0,0 +1,38 @@
+#include "meshbufferpool.h"
+
+QMutex MeshBufferPool::s_lock;
+std::vector<uPtr<ChunkVBOData>> MeshBufferPool::s_free;
+
+uPtr<ChunkVBOData> MeshBufferPool::acquire()
+{
+    s_lock.lock();
+    if (s_free.empty()) {
+        s_lock.unlock();
+        return mkU<ChunkVBOData>();
+    }
+
+    uPtr<ChunkVBOData> data = std::move(s_free.back());
+    s_free.pop_back();
+    s_lock.unlock();
+    return data;
+}
+
+void MeshBufferPool::release(uPtr<ChunkVBOData> data)
+{
+    if (!data) {
+        return;
+    }
+
+    data->chunk = nullptr;
+    data->meshed = 0;
+    for (SectionVBOData& section : data->sections) {
+        section.clear();
+    }
+
+    s_lock.lock();
+    if (s_free.size() < MAX_POOLED) {
+        s_free.push_back(std::move(data));
+    }
+    s_lock.unlock();
+    // otherwise data is freed here, outside the lock
+}
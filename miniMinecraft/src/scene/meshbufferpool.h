@@ -0,0 +1,25 @@
+#pragma once
+#include "chunk.h"
+#include "smartpointerhelp.h"
+#include <QMutex>
+#include <vector>
+
+// Recycles the CPU-side buffers that Chunk meshes are built in on their way to the GPU.
+// A VBOWorker acquires a ChunkVBOData, fills it, and hands it over by pointer; once the
+// GL thread has uploaded it, the buffers are released back here, keeping their capacity
+// for the next mesh. Only a handful are kept, so idle memory stays bounded; it's the only
+// CPU-side copy of a mesh there is.
+class MeshBufferPool
+{
+public:
+    // Returns an empty ChunkVBOData, reusing a released one if there is one
+    static uPtr<ChunkVBOData> acquire();
+    // Clears data and keeps it for reuse, or frees it if the pool is already full
+    static void release(uPtr<ChunkVBOData> data);
+
+private:
+    static constexpr std::size_t MAX_POOLED = 16;
+
+    static QMutex s_lock;
+    static std::vector<uPtr<ChunkVBOData>> s_free;
+};
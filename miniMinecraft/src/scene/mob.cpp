@@ -1,15 +1,15 @@
 #include "mob.h"
-#include "biome.h"
 #include <iostream>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
 
-Mob::Mob(OpenGLContext* context)
+Mob::Mob(OpenGLContext* context, Pcg32 rng)
     : Entity(context)
     , m_showPathArrow(false)
     , m_pathArrow(context)
     , m_lastPosition(m_position)
+    , m_rng(rng)
     , needsRespawn(true)
 
 {
@@ -20,11 +20,11 @@ Mob::Mob(OpenGLContext* context)
 
 void Mob::respawn(Chunk* c)
 {
-    int randomViableBlock = Biome::getRandomIntInRange(0, c->viableSpawnBlocks.size() - 1);
+    int randomViableBlock = m_rng.nextInRange(0, c->viableSpawnBlocks.size() - 1);
 
     this->m_position = c->viableSpawnBlocks[randomViableBlock]
                        + glm::vec3(c->getWorldPos().x, 5, c->getWorldPos().y);
-    this->rotateOnUpGlobal(Biome::getRandomIntInRange(0, 359));
+    this->rotateOnUpGlobal(m_rng.nextInRange(0, 359));
     this->needsRespawn = false;
 
     glm::mat4 bodyRotateMatrix = glm::lookAt(glm::vec3(),
@@ -93,15 +93,15 @@ void Mob::pathFind()
     } else {
         if (timeSinceLastPathRecompute > 3.f) {
             timeSinceLastPathRecompute = 0.f;
-            if (Biome::getRandomIntInRange(0, 2) > 0 || (m_inputs.inLiquid)) {
-                directionOfTravel = glm::vec3(Biome::getRandomIntInRange(-5, 5),
-                                              Biome::getRandomIntInRange(-5, 5),
-                                              Biome::getRandomIntInRange(-5, 5));
+            if (m_rng.nextInRange(0, 2) > 0 || (m_inputs.inLiquid)) {
+                directionOfTravel = glm::vec3(m_rng.nextInRange(-5, 5),
+                                              m_rng.nextInRange(-5, 5),
+                                              m_rng.nextInRange(-5, 5));
                 directionOfTravel = glm::normalize(
                     glm::vec3(directionOfTravel.x, 0, directionOfTravel.z));
             } else {
                 directionOfTravel = glm::vec3();
-                this->rotateOnUpGlobal(Biome::getRandomIntInRange(0, 359));
+                this->rotateOnUpGlobal(m_rng.nextInRange(0, 359));
             }
         }
     }
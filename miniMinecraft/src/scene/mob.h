@@ -2,6 +2,7 @@
 
 #include "entity.h"
 #include "scene/chunk.h"
+#include "scene/pcg32.h"
 
 class Mob : public Entity
 {
@@ -10,6 +11,8 @@ private:
     PathArrow m_pathArrow;
     glm::vec3 m_lastPosition;
     glm::vec3 m_realDirection;
+    // Where the mob respawns and wanders. Its own stream, so the other mobs don't affect it.
+    Pcg32 m_rng;
 
 public:
     float timeSinceLastPathRecompute;
@@ -17,7 +20,7 @@ public:
     bool needsRespawn;
     glm::vec3 directionOfTravel;
 
-    Mob(OpenGLContext*);
+    Mob(OpenGLContext*, Pcg32 rng);
 
     void tick(float dT, Terrain& terrain) override;
 
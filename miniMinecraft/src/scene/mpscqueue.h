@@ -0,0 +1,119 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <utility>
+
+// A bounded, lock-free queue for many producer threads and a single consumer thread.
+// Worker threads push their results here and the GL thread pops them, so neither side
+// ever waits on a mutex the other holds.
+//
+// Every cell carries a sequence number telling whose turn it is: a cell at position pos is
+// free for the producer that claims pos when its sequence is pos, and holds a value for the
+// consumer when its sequence is pos + 1. Producers claim positions with a single CAS on
+// m_enqueuePos; the consumer owns m_dequeuePos outright, so popping needs no CAS at all.
+template<typename T, std::size_t Capacity>
+class MPSCQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "MPSCQueue capacity must be a power of two");
+
+public:
+    MPSCQueue()
+        : m_cells()
+        , m_enqueuePos(0)
+        , m_dequeuePos(0)
+    {
+        for (std::size_t i = 0; i < Capacity; i++) {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    // Any thread. Moves value into the queue and returns true,
+    // or returns false, leaving value untouched, if the queue is full.
+    bool tryPush(T&& value)
+    {
+        std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true) {
+            cell = &m_cells[pos & MASK];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+            if (diff == 0) {
+                // The cell is free; try to claim it
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                // The consumer hasn't popped this cell since the last lap
+                return false;
+            } else {
+                // Another producer claimed pos first
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Any thread. Pushes value, yielding the thread for as long as the queue is full.
+    // That only happens if the consumer falls a whole Capacity of results behind.
+    void push(T&& value)
+    {
+        while (!tryPush(std::move(value))) {
+            std::this_thread::yield();
+        }
+    }
+
+    void push(const T& value)
+    {
+        T copy = value;
+        push(std::move(copy));
+    }
+
+    // Consumer thread only. Moves the oldest value into out and returns true,
+    // or returns false if the queue is empty.
+    bool tryPop(T& out)
+    {
+        Cell& cell = m_cells[m_dequeuePos & MASK];
+        std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+
+        if (seq != m_dequeuePos + 1) {
+            return false;
+        }
+
+        out = std::move(cell.value);
+        // Hand the cell back to the producers for the next lap
+        cell.sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+        m_dequeuePos++;
+        return true;
+    }
+
+    static constexpr std::size_t capacity()
+    {
+        return Capacity;
+    }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    std::array<Cell, Capacity> m_cells;
+    // Kept on separate cache lines so producers and the consumer don't contend on them
+    alignas(64) std::atomic<std::size_t> m_enqueuePos;
+    alignas(64) std::size_t m_dequeuePos;
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+// Integer hashes that Biome's noise is built on, in place of the usual
+// fract(sin(dot(p, k)) * 43758.5453). Those depend on how precisely the C library
+// works out sin for large arguments, which differs between compilers and platforms,
+// and a double sin is much slower than a few integer multiplies.
+// Each hash mixes its inputs and seed the way xxHash32 mixes a short input, so every
+// input bit affects every output bit. Coordinates are hashed by their float bits, so
+// any position, not just lattice points, gets its own value.
+class NoiseHash
+{
+public:
+    static constexpr uint32_t PRIME1 = 0x9E3779B1u;
+    static constexpr uint32_t PRIME2 = 0x85EBCA77u;
+    static constexpr uint32_t PRIME3 = 0xC2B2AE3Du;
+    static constexpr uint32_t PRIME4 = 0x27D4EB2Fu;
+    static constexpr uint32_t PRIME5 = 0x165667B1u;
+
+    static uint32_t hash(uint32_t a, uint32_t seed)
+    {
+        return finish(round(seed + PRIME5 + 4u, a));
+    }
+    static uint32_t hash(uint32_t a, uint32_t b, uint32_t seed)
+    {
+        return finish(round(round(seed + PRIME5 + 8u, a), b));
+    }
+    static uint32_t hash(uint32_t a, uint32_t b, uint32_t c, uint32_t seed)
+    {
+        return finish(round(round(round(seed + PRIME5 + 12u, a), b), c));
+    }
+
+    // Another hash of the same inputs, for noise that needs more than one value per point
+    static uint32_t next(uint32_t h)
+    {
+        return finish(h + PRIME1);
+    }
+
+    // The bits of a coordinate, with -0 the same as 0 so they hash the same
+    static uint32_t bits(float f)
+    {
+        f += 0.f;
+        uint32_t b;
+        std::memcpy(&b, &f, sizeof(b));
+        return b;
+    }
+
+    // A hash as a float in [0, 1), from its top 24 bits so every value is exact
+    static float unit(uint32_t h)
+    {
+        return float(h >> 8) * (1.f / 16777216.f);
+    }
+
+private:
+    static uint32_t rotl(uint32_t v, int r)
+    {
+        return (v << r) | (v >> (32 - r));
+    }
+    static uint32_t round(uint32_t h, uint32_t v)
+    {
+        return rotl(h + v * PRIME3, 17) * PRIME4;
+    }
+    static uint32_t finish(uint32_t h)
+    {
+        h ^= h >> 15;
+        h *= PRIME2;
+        h ^= h >> 13;
+        h *= PRIME3;
+        h ^= h >> 16;
+        return h;
+    }
+};
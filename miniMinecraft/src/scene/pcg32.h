@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+
+// A small, fast random number generator (PCG32, with XSH RR output) for gameplay randomness.
+// Unlike a std::random_device and std::mt19937, it costs nothing to set up, so each owner
+// keeps one and draws from it as often as it likes. Each of its 2^63 streams gives its own
+// sequence from the same seed, so seeding them all from the world's seed, one stream per
+// owner, makes a world behave the same every time it's played.
+class Pcg32
+{
+public:
+    Pcg32(uint64_t seed, uint64_t stream)
+        : m_state(0)
+        , m_increment(stream << 1 | 1u)
+    {
+        next();
+        m_state += seed;
+        next();
+    }
+
+    uint32_t next()
+    {
+        uint64_t old = m_state;
+        m_state = old * 6364136223846793005ull + m_increment;
+        uint32_t xorShifted = uint32_t(((old >> 18) ^ old) >> 27);
+        uint32_t rot = uint32_t(old >> 59);
+        return (xorShifted >> rot) | (xorShifted << ((32 - rot) & 31));
+    }
+
+    // Uniformly distributed in [min, max]
+    int nextInRange(int min, int max)
+    {
+        uint32_t range = uint32_t(max) - uint32_t(min) + 1u;
+        if (range == 0) {
+            return int(next());  // every int
+        }
+        // Drops the values below 2^32 % range, which would make the low results
+        // more likely than the others
+        uint32_t threshold = (0u - range) % range;
+        uint32_t r = next();
+        while (r < threshold) {
+            r = next();
+        }
+        return int(uint32_t(min) + r % range);
+    }
+
+private:
+    uint64_t m_state;
+    uint64_t m_increment;  // always odd
+};
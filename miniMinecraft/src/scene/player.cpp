@@ -125,11 +125,7 @@ BlockType Player::removeBlock(Terrain* terrain)
     if (gridMarch(rayOrigin, rayDirection, &outDist, &outBlockHit, *terrain)) {
         BlockType blockType = terrain->getBlockAt(outBlockHit.x, outBlockHit.y, outBlockHit.z);
         inventory.addItem(blockType);
-        terrain->setBlockAt(outBlockHit.x, outBlockHit.y, outBlockHit.z, EMPTY);
-        Chunk* ch = terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get();
-        ch->destroyVBOdata();
-        ch->generateVBOData();
-        ch->loadVBO();
+        terrain->changeBlockAt(outBlockHit.x, outBlockHit.y, outBlockHit.z, EMPTY);
         return blockType;
     }
 
@@ -158,13 +154,10 @@ BlockType Player::placeBlock(Terrain* terrain, BlockType currBlockType)
                                                                outBlockHit.z
                                                                    - glm::sign(rayDirection.z));
                     if (foundBlock == EMPTY || foundBlock == WATER || foundBlock == LAVA) {
-                        terrain->setBlockAt(outBlockHit.x,
-                                            outBlockHit.y,
-                                            outBlockHit.z - glm::sign(rayDirection.z),
-                                            currBlockType);
-                        terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get()->destroyVBOdata();
-                        terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get()->generateVBOData();
-                        terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get()->loadVBO();
+                        terrain->changeBlockAt(outBlockHit.x,
+                                               outBlockHit.y,
+                                               outBlockHit.z - glm::sign(rayDirection.z),
+                                               currBlockType);
                         return currBlockType;
                     }
                 } else if (infAxis == 1) {
@@ -173,13 +166,10 @@ BlockType Player::placeBlock(Terrain* terrain, BlockType currBlockType)
                                                                    - glm::sign(rayDirection.y),
                                                                outBlockHit.z);
                     if (foundBlock == EMPTY || foundBlock == WATER || foundBlock == LAVA) {
-                        terrain->setBlockAt(outBlockHit.x,
-                                            outBlockHit.y - glm::sign(rayDirection.y),
-                                            outBlockHit.z,
-                                            currBlockType);
-                        terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get()->destroyVBOdata();
-                        terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get()->generateVBOData();
-                        terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get()->loadVBO();
+                        terrain->changeBlockAt(outBlockHit.x,
+                                               outBlockHit.y - glm::sign(rayDirection.y),
+                                               outBlockHit.z,
+                                               currBlockType);
                         return currBlockType;
                     }
                 } else if (infAxis == 0) {
@@ -188,13 +178,10 @@ BlockType Player::placeBlock(Terrain* terrain, BlockType currBlockType)
                                                                outBlockHit.y,
                                                                outBlockHit.z);
                     if (foundBlock == EMPTY || foundBlock == WATER || foundBlock == LAVA) {
-                        terrain->setBlockAt(outBlockHit.x - glm::sign(rayDirection.x),
-                                            outBlockHit.y,
-                                            outBlockHit.z,
-                                            currBlockType);
-                        terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get()->destroyVBOdata();
-                        terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get()->generateVBOData();
-                        terrain->getChunkAt(outBlockHit.x, outBlockHit.z).get()->loadVBO();
+                        terrain->changeBlockAt(outBlockHit.x - glm::sign(rayDirection.x),
+                                               outBlockHit.y,
+                                               outBlockHit.z,
+                                               currBlockType);
                         return currBlockType;
                     }
                 }
@@ -0,0 +1,217 @@
+#include "regionstore.h"
+#include "terrain.h"
+#include <QByteArray>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <cstring>
+
+static constexpr char MAGIC[4] = {'M', 'M', 'R', 'G'};
+// The magic, version, corner and seed, before the offset table
+static constexpr int FIELDS_SIZE = 5 * 4;
+static constexpr int HEADER_SIZE = FIELDS_SIZE + 16 * 8;
+
+RegionStore::RegionStore(const QString& directory, uint32_t seed)
+    : m_directory(directory)
+    , m_seed(seed)
+    , m_lock()
+    , m_pending()
+    , m_order()
+    , m_writingKey(0)
+    , m_writing()
+    , m_isWriting(false)
+    , m_stopping(false)
+    , m_wake()
+    , m_idle()
+    , m_writer()
+{
+    QDir().mkpath(m_directory);
+    m_writer = std::thread(&RegionStore::writerLoop, this);
+}
+
+RegionStore::~RegionStore()
+{
+    // The writer drains the queue before it stops
+    m_lock.lock();
+    m_stopping = true;
+    m_wake.wakeAll();
+    m_lock.unlock();
+    m_writer.join();
+}
+
+QString RegionStore::zonePath(int x, int z) const
+{
+    return QDir(m_directory)
+        .filePath(QString("zone_%1_%2.region").arg(x / 64).arg(z / 64));
+}
+
+int RegionStore::chunkIndex(int x, int z, int chunkX, int chunkZ)
+{
+    return (chunkX - x) / 16 + 4 * ((chunkZ - z) / 16);
+}
+
+// Copies the non-empty payloads of from over to
+static bool overlay(RegionStore::ZonePayloads& to, const RegionStore::ZonePayloads& from)
+{
+    bool any = false;
+    for (int i = 0; i < 16; i++) {
+        if (!from[i].empty()) {
+            to[i] = from[i];
+            any = true;
+        }
+    }
+    return any;
+}
+
+void RegionStore::saveChunks(int x, int z, ZonePayloads chunks)
+{
+    int64_t key = toKey(x, z);
+
+    m_lock.lock();
+    auto it = m_pending.find(key);
+    if (it == m_pending.end()) {
+        m_order.push_back(key);
+        m_pending[key] = std::move(chunks);
+    } else {
+        overlay(it->second, chunks);
+    }
+    m_wake.wakeOne();
+    m_lock.unlock();
+}
+
+bool RegionStore::loadZone(int x, int z, ZonePayloads& chunks) const
+{
+    int64_t key = toKey(x, z);
+
+    // Newer saves of the zone may be queued or being written. They're copied before the
+    // disk is read, so one the writer finishes in the meantime is still picked up.
+    ZonePayloads writing;
+    ZonePayloads pending;
+    m_lock.lock();
+    if (m_isWriting && m_writingKey == key) {
+        writing = m_writing;
+    }
+    auto it = m_pending.find(key);
+    if (it != m_pending.end()) {
+        pending = it->second;
+    }
+    m_lock.unlock();
+
+    bool found = readZone(x, z, chunks);
+    found = overlay(chunks, writing) || found;
+    found = overlay(chunks, pending) || found;
+    return found;
+}
+
+void RegionStore::flush()
+{
+    m_lock.lock();
+    while (!m_order.empty() || m_isWriting) {
+        m_idle.wait(&m_lock);
+    }
+    m_lock.unlock();
+}
+
+void RegionStore::writerLoop()
+{
+    m_lock.lock();
+    while (true) {
+        while (m_order.empty() && !m_stopping) {
+            m_wake.wait(&m_lock);
+        }
+        if (m_order.empty()) {
+            break;
+        }
+
+        m_writingKey = m_order.front();
+        m_order.pop_front();
+        m_writing = std::move(m_pending.at(m_writingKey));
+        m_pending.erase(m_writingKey);
+        m_isWriting = true;
+        m_lock.unlock();
+
+        // m_writing is only replaced by this thread, so it's safe to read unlocked
+        writeZone(m_writingKey, m_writing);
+
+        m_lock.lock();
+        m_isWriting = false;
+        m_writing = ZonePayloads();
+        m_idle.wakeAll();
+    }
+    m_lock.unlock();
+}
+
+void RegionStore::writeZone(int64_t zone, const ZonePayloads& chunks) const
+{
+    glm::ivec2 corner = toCoords(zone);
+
+    ZonePayloads merged;
+    readZone(corner.x, corner.y, merged);
+    overlay(merged, chunks);
+
+    QByteArray header(HEADER_SIZE, '\0');
+    QByteArray body;
+    uint32_t fields[5];
+    std::memcpy(&fields[0], MAGIC, sizeof(MAGIC));
+    fields[1] = VERSION;
+    fields[2] = static_cast<uint32_t>(corner.x);
+    fields[3] = static_cast<uint32_t>(corner.y);
+    fields[4] = m_seed;
+    std::memcpy(header.data(), fields, sizeof(fields));
+
+    for (int i = 0; i < 16; i++) {
+        uint32_t entry[2] = {0, 0};
+        if (!merged[i].empty()) {
+            QByteArray compressed = qCompress(merged[i].data(), static_cast<int>(merged[i].size()));
+            entry[0] = HEADER_SIZE + body.size();
+            entry[1] = compressed.size();
+            body.append(compressed);
+        }
+        std::memcpy(header.data() + FIELDS_SIZE + 8 * i, entry, sizeof(entry));
+    }
+
+    QSaveFile file(zonePath(corner.x, corner.y));
+    if (!file.open(QIODevice::WriteOnly) || file.write(header) != header.size()
+        || file.write(body) != body.size() || !file.commit()) {
+        qWarning() << "Could not save region file" << file.fileName();
+    }
+}
+
+bool RegionStore::readZone(int x, int z, ZonePayloads& chunks) const
+{
+    QFile file(zonePath(x, z));
+    if (!file.open(QIODevice::ReadOnly) || file.size() < HEADER_SIZE) {
+        return false;
+    }
+
+    uchar* data = file.map(0, file.size());
+    if (!data) {
+        return false;
+    }
+
+    uint32_t fields[5];
+    std::memcpy(fields, data, sizeof(fields));
+    if (std::memcmp(&fields[0], MAGIC, sizeof(MAGIC)) != 0 || fields[1] != VERSION
+        || static_cast<int>(fields[2]) != x || static_cast<int>(fields[3]) != z
+        || fields[4] != m_seed) {
+        file.unmap(data);
+        return false;
+    }
+
+    for (int i = 0; i < 16; i++) {
+        uint32_t entry[2];
+        std::memcpy(entry, data + FIELDS_SIZE + 8 * i, sizeof(entry));
+        if (entry[1] == 0 || entry[0] < HEADER_SIZE
+            || uint64_t(entry[0]) + entry[1] > uint64_t(file.size())) {
+            continue;
+        }
+
+        // qUncompress returns an empty array if the payload is corrupt
+        QByteArray raw = qUncompress(data + entry[0], static_cast<int>(entry[1]));
+        chunks[i].assign(raw.constData(), raw.constData() + raw.size());
+    }
+
+    file.unmap(data);
+    return true;
+}
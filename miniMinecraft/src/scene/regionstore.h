@@ -0,0 +1,79 @@
+#pragma once
+#include <QMutex>
+#include <QString>
+#include <QWaitCondition>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Saves snapshots of Chunks to disk and reads them back, one region file per zone.
+// A region file starts with a header:
+//   "MMRG", the format version, the x and z of the zone's lower-left corner,
+//   and the seed the world was generated from                                    - 20 bytes
+//   an offset table of 16 (offset, size) pairs, one per Chunk                     - 128 bytes
+// Entry i is the Chunk at (x + 16 * (i % 4), z + 16 * (i / 4)), and a size of 0 means it
+// wasn't saved. Each payload is the Chunk's serialize output, compressed with qCompress.
+// All integers are in native byte order. A file saved with another seed, or in another
+// version, reads back as if nothing had been saved, so its Chunks are generated afresh.
+//
+// Region files are read through QFile::map, so reading one costs no more than the pages
+// it touches. Writes are made on a background thread, which compresses the payloads and
+// replaces the whole file at once through QSaveFile, so a crash never leaves half a zone.
+class RegionStore
+{
+public:
+    // Serialized Chunks of one zone, indexed as in the offset table
+    using ZonePayloads = std::array<std::vector<unsigned char>, 16>;
+
+    static constexpr uint32_t VERSION = 3;
+
+    // Keeps region files of the world generated from seed in directory,
+    // creating it if need be
+    RegionStore(const QString& directory, uint32_t seed);
+    // Finishes every write that's been queued
+    ~RegionStore();
+
+    RegionStore(const RegionStore&) = delete;
+    RegionStore& operator=(const RegionStore&) = delete;
+
+    // Queues the Chunks of the zone with its lower-left corner at (x, z) to be written.
+    // Chunks whose payload is empty keep whatever was saved of them before.
+    void saveChunks(int x, int z, ZonePayloads chunks);
+    // Any thread. Reads the zone back, including saves that are still waiting to be written.
+    // Returns false if nothing of the zone has been saved. A Chunk that wasn't saved,
+    // or whose payload is corrupt, comes back empty.
+    bool loadZone(int x, int z, ZonePayloads& chunks) const;
+    // Blocks until every queued write has finished
+    void flush();
+
+    QString zonePath(int x, int z) const;
+    // Index of the Chunk at world position (chunkX, chunkZ) within the zone at (x, z)
+    static int chunkIndex(int x, int z, int chunkX, int chunkZ);
+
+private:
+    QString m_directory;
+    uint32_t m_seed;
+
+    // Saves waiting to be written, by zone key. loadZone looks here before the disk,
+    // so a zone that's loaded again before its write finishes isn't lost.
+    mutable QMutex m_lock;
+    std::unordered_map<int64_t, ZonePayloads> m_pending;
+    std::deque<int64_t> m_order;
+    // The save the writer is in the middle of
+    int64_t m_writingKey;
+    ZonePayloads m_writing;
+    bool m_isWriting;
+    bool m_stopping;
+
+    QWaitCondition m_wake;  // a save was queued, or the store is stopping
+    QWaitCondition m_idle;  // the writer finished a save
+    std::thread m_writer;
+
+    void writerLoop();
+    // Writes chunks over what's saved of the zone on disk
+    void writeZone(int64_t zone, const ZonePayloads& chunks) const;
+    bool readZone(int x, int z, ZonePayloads& chunks) const;
+};
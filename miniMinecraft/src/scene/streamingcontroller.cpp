@@ -0,0 +1,184 @@
+#include "streamingcontroller.h"
+#include "terrain.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+// Time constant of the velocity smoothing, in seconds
+static constexpr float VELOCITY_SMOOTHING = 0.25f;
+// Faster than this between two frames is a teleport or respawn, not movement
+static constexpr float MAX_SPEED = 500.f;
+// Below this speed the view direction counts as the direction of travel
+static constexpr float MIN_TRAVEL_SPEED = 2.f;
+
+StreamingController::StreamingController()
+    : m_radius(3)
+    , m_behindRadius(2)
+    , m_lookahead(2.f)
+    , m_position(0.f)
+    , m_velocity(0.f)
+    , m_direction(0.f, 1.f)
+    , m_zones()
+    , m_zoneSet()
+    , m_lastZone(0)
+    , m_lastPredictedZone(0)
+    , m_lastOctant(-1)
+    , m_settingsChanged(true)
+{}
+
+glm::ivec2 StreamingController::zoneOf(glm::vec2 p)
+{
+    return glm::ivec2(64 * static_cast<int>(glm::floor(p.x / 64.f)),
+                      64 * static_cast<int>(glm::floor(p.y / 64.f)));
+}
+
+bool StreamingController::update(glm::vec3 pos, glm::vec3 prevPos, glm::vec3 forward, float dt)
+{
+    m_position = pos;
+
+    if (dt > 0.f) {
+        glm::vec3 instant = (pos - prevPos) / dt;
+        if (glm::length(instant) < MAX_SPEED) {
+            m_velocity += (instant - m_velocity) * (1.f - std::exp(-dt / VELOCITY_SMOOTHING));
+        }
+    }
+
+    glm::vec2 travel(m_velocity.x, m_velocity.z);
+    glm::vec2 view(forward.x, forward.z);
+    if (glm::length(travel) > MIN_TRAVEL_SPEED) {
+        m_direction = glm::normalize(travel);
+    } else if (glm::length(view) > 0.001f) {
+        m_direction = glm::normalize(view);
+    }
+
+    // Only recompute when something that decides the zones has changed enough to matter
+    glm::ivec2 zone = zoneOf(glm::vec2(pos.x, pos.z));
+    glm::vec3 predicted = getPredictedPosition();
+    glm::ivec2 predictedZone = zoneOf(glm::vec2(predicted.x, predicted.z));
+    int octant = static_cast<int>(
+                     std::lround(std::atan2(m_direction.y, m_direction.x) / (M_PI / 4.0)) + 8)
+                 % 8;
+
+    if (!m_settingsChanged && zone == m_lastZone && predictedZone == m_lastPredictedZone
+        && octant == m_lastOctant) {
+        return false;
+    }
+
+    m_lastZone = zone;
+    m_lastPredictedZone = predictedZone;
+    m_lastOctant = octant;
+    m_settingsChanged = false;
+
+    std::unordered_set<int64_t> previous = std::move(m_zoneSet);
+    recomputeZones();
+    return m_zoneSet != previous;
+}
+
+void StreamingController::recomputeZones()
+{
+    glm::vec2 pos(m_position.x, m_position.z);
+    glm::vec3 predicted3 = getPredictedPosition();
+    glm::vec2 predicted(predicted3.x, predicted3.z);
+    glm::ivec2 curr = zoneOf(pos);
+
+    // Sample the predicted path no more than a radius apart,
+    // so that the squares of zones around the samples overlap
+    float step = 64.f * std::max(m_radius, 1);
+    int steps = static_cast<int>(std::ceil(glm::length(predicted - pos) / step));
+    std::vector<glm::ivec2> samples;
+    for (int i = 0; i <= steps; i++) {
+        samples.push_back(zoneOf(steps == 0 ? pos : glm::mix(pos, predicted, i / float(steps))));
+    }
+
+    std::vector<std::pair<float, int64_t>> ordered;
+    m_zoneSet.clear();
+    int behindRadius = getBehindRadius();
+
+    for (glm::ivec2 sample : samples) {
+        for (int i = -m_radius; i <= m_radius; i++) {
+            for (int j = -m_radius; j <= m_radius; j++) {
+                glm::ivec2 zone = sample + 64 * glm::ivec2(i, j);
+                int64_t key = toKey(zone.x, zone.y);
+                if (m_zoneSet.count(key)) {
+                    continue;
+                }
+
+                // Zones behind the player only within the smaller radius
+                glm::vec2 offset = glm::vec2(zone) + glm::vec2(32.f) - pos;
+                int distance = std::max(std::abs(zone.x - curr.x), std::abs(zone.y - curr.y)) / 64;
+                if (glm::dot(offset, m_direction) < 0.f && distance > behindRadius) {
+                    continue;
+                }
+
+                m_zoneSet.insert(key);
+                ordered.push_back({glm::dot(offset, offset), key});
+            }
+        }
+    }
+
+    std::sort(ordered.begin(), ordered.end());
+    m_zones.clear();
+    for (const auto& z : ordered) {
+        m_zones.push_back(z.second);
+    }
+}
+
+const std::vector<int64_t>& StreamingController::getZones() const
+{
+    return m_zones;
+}
+
+bool StreamingController::isWanted(int64_t zone) const
+{
+    return m_zoneSet.count(zone) > 0;
+}
+
+glm::vec3 StreamingController::getVelocity() const
+{
+    return m_velocity;
+}
+
+glm::vec2 StreamingController::getDirection() const
+{
+    return m_direction;
+}
+
+glm::vec3 StreamingController::getPredictedPosition() const
+{
+    return m_position + m_velocity * m_lookahead;
+}
+
+void StreamingController::setRadius(int zones)
+{
+    m_radius = std::max(zones, 1);
+    m_settingsChanged = true;
+}
+
+int StreamingController::getRadius() const
+{
+    return m_radius;
+}
+
+void StreamingController::setBehindRadius(int zones)
+{
+    // Always keep the zones right around the player. It's only capped at m_radius where
+    // it's used, so shrinking the radius and growing it again brings it back.
+    m_behindRadius = std::max(zones, 1);
+    m_settingsChanged = true;
+}
+
+int StreamingController::getBehindRadius() const
+{
+    return std::min(m_behindRadius, m_radius);
+}
+
+void StreamingController::setLookahead(float seconds)
+{
+    m_lookahead = std::max(seconds, 0.f);
+    m_settingsChanged = true;
+}
+
+float StreamingController::getLookahead() const
+{
+    return m_lookahead;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "glm_includes.h"
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+// Decides which 64 x 64 terrain generation zones Terrain should have generated and meshed.
+// Rather than only reacting to the zone the player is standing in, it predicts where the
+// player will be a short time from now, from their smoothed velocity, and streams in the
+// zones along the way. Zones behind the direction of travel are kept to a smaller radius,
+// so their jobs don't compete with the ones the player is heading towards.
+class StreamingController
+{
+public:
+    StreamingController();
+
+    // Called every frame with the player's position after and before this frame's tick.
+    // Returns true if the set of wanted zones changed.
+    bool update(glm::vec3 pos, glm::vec3 prevPos, glm::vec3 forward, float dt);
+
+    // Keys (see toKey) of the wanted zones' lower-left corners, nearest the player first
+    const std::vector<int64_t>& getZones() const;
+    bool isWanted(int64_t zone) const;
+
+    // Smoothed velocity in blocks per second
+    glm::vec3 getVelocity() const;
+    // Unit x-z direction of travel, or of view when the player is (nearly) standing still
+    glm::vec2 getDirection() const;
+    // Where the player is expected to be after the lookahead time
+    glm::vec3 getPredictedPosition() const;
+
+    // Zones streamed in around the player and their predicted path, in every direction
+    // except behind them
+    void setRadius(int zones);
+    int getRadius() const;
+    // Zones streamed in behind the player, never more than the radius
+    void setBehindRadius(int zones);
+    int getBehindRadius() const;
+    // How many seconds ahead to predict the player's position
+    void setLookahead(float seconds);
+    float getLookahead() const;
+
+    // Lower-left corner of the zone containing world position p
+    static glm::ivec2 zoneOf(glm::vec2 p);
+
+private:
+    int m_radius;
+    int m_behindRadius;  // as requested, which may be more than m_radius
+    float m_lookahead;
+
+    glm::vec3 m_position;
+    glm::vec3 m_velocity;
+    glm::vec2 m_direction;
+
+    std::vector<int64_t> m_zones;
+    std::unordered_set<int64_t> m_zoneSet;
+
+    // What the wanted zones were last computed from; they're only recomputed when it changes
+    glm::ivec2 m_lastZone;
+    glm::ivec2 m_lastPredictedZone;
+    int m_lastOctant;
+    bool m_settingsChanged;
+
+    void recomputeZones();
+};
@@ -1,11 +1,73 @@
 #include "terrain.h"
+#include "meshbufferpool.h"
+#include <QDebug>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QSaveFile>
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <random>
 #include <stdexcept>
 
+std::size_t Terrain::s_defaultMemoryBudget = std::size_t(512) << 20;
+QString Terrain::s_defaultWorldDirectory = "world";
+uint32_t Terrain::s_defaultSeed = std::random_device()();
+
+// How often heavily edited Chunks are snapshotted, in seconds
+static constexpr float AUTOSAVE_INTERVAL = 30.f;
+// Edited blocks a Chunk needs before it's snapshotted. Each edit costs a 16-byte record,
+// so this many is around the size of a compressed snapshot.
+static constexpr std::size_t SNAPSHOT_EDITS = 1024;
+// Zones more than this many zones from the player's have their Chunks' blocks packed.
+// Only the player's own zone is unpacked, so that a player on the edge of a zone
+// doesn't make the zones around it pack and unpack over and over.
+static constexpr int PACK_DISTANCE = 2;
+// Time spent packing and unpacking per call, which takes around half a millisecond a Chunk
+static constexpr float PACK_BUDGET_MS = 2.f;
+
+// The seed of the world saved in directory. A world saved before it had a seed file,
+// or one that's new, is given seed, which is saved along with it.
+static uint32_t loadWorldSeed(const QString& directory, uint32_t seed)
+{
+    if (directory.isEmpty()) {
+        return seed;
+    }
+
+    QString path = QDir(directory).filePath("seed");
+    QFile saved(path);
+    if (saved.open(QIODevice::ReadOnly)) {
+        bool ok = false;
+        uint32_t savedSeed = saved.readAll().trimmed().toUInt(&ok);
+        if (ok) {
+            return savedSeed;
+        }
+        qWarning() << "Ignoring unreadable world seed" << path;
+    }
+
+    QDir().mkpath(directory);
+    QSaveFile file(path);
+    QByteArray text = QByteArray::number(seed) + '\n';
+    if (!file.open(QIODevice::WriteOnly) || file.write(text) != text.size() || !file.commit()) {
+        qWarning() << "Could not save world seed" << path;
+    }
+    return seed;
+}
+
 Terrain::Terrain(OpenGLContext* context)
     : m_chunks()
     , m_generatedTerrain()
+    , m_zonesToPack()
+    , m_memoryBudget(s_defaultMemoryBudget)
+    , m_seed(loadWorldSeed(s_defaultWorldDirectory, s_defaultSeed))
+    , m_spawnRng(m_seed, 0)
+    , m_regions(s_defaultWorldDirectory.isEmpty()
+                    ? nullptr
+                    : mkU<RegionStore>(s_defaultWorldDirectory, m_seed))
+    , m_journal(s_defaultWorldDirectory.isEmpty()
+                    ? nullptr
+                    : mkU<EditJournal>(QDir(s_defaultWorldDirectory).filePath("edits.journal")))
     , mp_context(context)
 {}
 
@@ -120,97 +182,438 @@ const uPtr<Chunk>& Terrain::getChunkAt(int x, int z) const
     return m_chunks.at(toKey(16 * xFloor, 16 * zFloor));
 }
 
-void Terrain::multithreadedWork(glm::vec3 currPlayerPos, glm::vec3 prevPlayerPos, float dt)
+void Terrain::multithreadedWork(glm::vec3 currPlayerPos,
+                                glm::vec3 prevPlayerPos,
+                                glm::vec3 playerForward,
+                                float dt)
 {
+    bool zonesChanged = m_streaming.update(currPlayerPos, prevPlayerPos, playerForward, dt);
+    glm::vec2 direction = m_streaming.getDirection();
+    m_jobScheduler.setFocus(currPlayerPos, glm::vec3(direction.x, 0.f, direction.y));
+
+    // Expand as soon as the wanted zones change, and periodically to pick up
+    // Chunks that need meshing again
     m_chunkTimer += dt;
-    if (m_chunkTimer >= 0.5f) {
-        tryExpansion(currPlayerPos, prevPlayerPos);
+    if (zonesChanged || m_chunkTimer >= 0.5f) {
+        tryExpansion();
+        packDistantZones(currPlayerPos);
+        evictZones(currPlayerPos);
         m_chunkTimer = 0.0f;
     }
-    checkThreadResults();
+
+    m_saveTimer += dt;
+    if (m_saveTimer >= AUTOSAVE_INTERVAL) {
+        snapshotEditedChunks();
+        m_saveTimer = 0.f;
+    }
+    checkThreadResults(currPlayerPos);
 }
 
-QSet<long long> Terrain::borderingZone(glm::ivec2 coords, int radius, bool atEdge)
+void Terrain::tryExpansion()
 {
-    int radiusScale = radius * 64;
-    QSet<long long> result;
-
-    // Adds Zones only at the radius
-    if (atEdge) {
-        for (int i = -radiusScale; i <= radiusScale; i += 64) {
-            result.insert(toKey(coords.x + radiusScale, coords.y + i));
-            result.insert(toKey(coords.x - radiusScale, coords.y + i));
-            result.insert(toKey(coords.x + i, coords.y + radiusScale));
-            result.insert(toKey(coords.x + i, coords.y + radiusScale));
+    // Drop the jobs that haven't started yet for zones the player is no longer heading to.
+    // Their Chunks go back to the state they were in before the job was scheduled,
+    // so that they're scheduled again if they come back.
+    std::vector<ChunkJobScheduler::Job> cancelled
+        = m_jobScheduler.cancelIf([&](const ChunkJobScheduler::Job& job) {
+              glm::ivec2 zone = StreamingController::zoneOf(glm::vec2(job.corner));
+              return !m_streaming.isWanted(toKey(zone.x, zone.y));
+          });
+    for (const ChunkJobScheduler::Job& job : cancelled) {
+        if (job.jobClass == JobClass::BLOCK_DATA) {
+            m_cancelledZones.insert(job.key);
+            for (int x = job.corner.x; x < job.corner.x + 64; x += 16) {
+                for (int z = job.corner.y; z < job.corner.y + 64; z += 16) {
+                    getChunkAt(x, z)->setState(ChunkState::ALLOCATED);
+                }
+            }
+        } else {
+            Chunk* c = m_chunks.at(job.key).get();
+            c->setState(c->isInDrawList ? ChunkState::DIRTY : ChunkState::GENERATED);
         }
+    }
 
-        // Adds Zones upto and including the radius
-    } else {
-        for (int i = -radiusScale; i <= radiusScale; i += 64) {
-            for (int j = -radiusScale; j <= radiusScale; j += 64) {
-                result.insert(toKey(coords.x + i, coords.y + j));
+    // Figure out if the wanted zones need VBO data or Block data, nearest first.
+    // createVBOWorker skips the Chunks whose mesh is already up to date or underway.
+    m_expansionTick++;
+    for (int64_t zone : m_streaming.getZones()) {
+        m_zoneLastUsed[zone] = m_expansionTick;
+
+        if (m_chunks.find(zone) != m_chunks.end() && m_cancelledZones.count(zone) == 0) {
+            glm::ivec2 coord = toCoords(zone);
+
+            for (int x = coord.x; x < coord.x + 64; x += 16) {
+                for (int z = coord.y; z < coord.y + 64; z += 16) {
+                    createVBOWorker(getChunkAt(x, z).get());
+                }
             }
+        } else {
+            createBDWorker(zone);
         }
     }
-    return result;
 }
 
-void Terrain::tryExpansion(glm::vec3 pos, glm::vec3 prevPos)
+void Terrain::packDistantZones(glm::vec3 playerPos)
 {
-    // Find the 64 x 64 zone the player is on
-    glm::ivec2 curr(64.f * floor(pos.x / 64.f), 64.f * floor(pos.z / 64.f));
-    glm::ivec2 prev(64.f * floor(prevPos.x / 64.f), 64.f * floor(prevPos.z / 64.f));
-    // Figure out which zones border this zone and the previous zone
-    QSet<long long> borderingCurr = borderingZone(curr, 3, false);
-    QSet<long long> borderingPrev = borderingZone(prev, 3, false);
+    glm::ivec2 playerZone = StreamingController::zoneOf(glm::vec2(playerPos.x, playerPos.z));
+
+    if (m_zonesToPack.empty()) {
+        m_zonesToPack.assign(m_generatedTerrain.begin(), m_generatedTerrain.end());
+    }
 
-    // Figure out if the current zones need VBO data or Block data
-    for (long long zone : borderingCurr) {
-        if (m_chunks.find(zone) != m_chunks.end()) {
-            if (!borderingPrev.contains(zone)) {
-                glm::ivec2 coord = toCoords(zone);
+    QElapsedTimer timer;
+    timer.start();
+    while (!m_zonesToPack.empty() && timer.nsecsElapsed() < PACK_BUDGET_MS * 1000000.f) {
+        int64_t zone = m_zonesToPack.back();
+        m_zonesToPack.pop_back();
+        // Evicted since the pass started
+        if (m_generatedTerrain.count(zone) == 0) {
+            continue;
+        }
 
-                for (int x = coord.x; x < coord.x + 64; x += 16) {
-                    for (int z = coord.y; z < coord.y + 64; z += 16) {
-                        auto& c = getChunkAt(x, z);
-                        createVBOWorker(c.get());
+        glm::ivec2 coord = toCoords(zone);
+        glm::ivec2 offset = glm::abs(coord - playerZone) / 64;
+        int distance = std::max(offset.x, offset.y);
+        if (distance > 0 && distance <= PACK_DISTANCE) {
+            continue;
+        }
+
+        for (int x = coord.x; x < coord.x + 64; x += 16) {
+            for (int z = coord.y; z < coord.y + 64; z += 16) {
+                Chunk* c = getChunkAt(x, z).get();
+                // Chunks without their blocks yet have nothing to pack
+                ChunkState state = c->getState();
+                if (state == ChunkState::ALLOCATED || state == ChunkState::GENERATING) {
+                    continue;
+                }
+                if (distance > PACK_DISTANCE) {
+                    // One still being read would only be unpacked again
+                    if (!c->clearRecentlyRead()) {
+                        c->packBlocks();
                     }
+                } else {
+                    c->unpackBlocks();
                 }
             }
-        } else {
-            createBDWorker(zone);
         }
     }
 }
 
-void Terrain::checkThreadResults()
+void Terrain::evictZones(glm::vec3 playerPos)
+{
+    std::vector<std::pair<int64_t, std::size_t>> zones;
+    m_memoryUsage = 0;
+    for (int64_t zone : m_generatedTerrain) {
+        glm::ivec2 coord = toCoords(zone);
+        std::size_t bytes = 0;
+        for (int x = coord.x; x < coord.x + 64; x += 16) {
+            for (int z = coord.y; z < coord.y + 64; z += 16) {
+                bytes += getChunkAt(x, z)->memoryUsage();
+            }
+        }
+        zones.push_back({zone, bytes});
+        m_memoryUsage += bytes;
+    }
+
+    if (m_memoryUsage <= m_memoryBudget) {
+        return;
+    }
+
+    glm::vec2 playerXZ(playerPos.x, playerPos.z);
+    auto lastUsed = [&](int64_t zone) {
+        auto it = m_zoneLastUsed.find(zone);
+        return it == m_zoneLastUsed.end() ? 0 : it->second;
+    };
+    auto distance2 = [&](int64_t zone) {
+        glm::vec2 offset = glm::vec2(toCoords(zone)) + glm::vec2(32.f) - playerXZ;
+        return glm::dot(offset, offset);
+    };
+    std::sort(zones.begin(),
+              zones.end(),
+              [&](const std::pair<int64_t, std::size_t>& a,
+                  const std::pair<int64_t, std::size_t>& b) {
+                  uint64_t usedA = lastUsed(a.first);
+                  uint64_t usedB = lastUsed(b.first);
+                  if (usedA != usedB) {
+                      return usedA < usedB;
+                  }
+                  return distance2(a.first) > distance2(b.first);
+              });
+
+    for (const auto& zone : zones) {
+        if (m_memoryUsage <= m_memoryBudget) {
+            break;
+        }
+        // Zones that are busy now get another chance on the next pass
+        if (m_streaming.isWanted(zone.first) || !canEvictZone(zone.first)) {
+            continue;
+        }
+        evictZone(zone.first);
+        m_memoryUsage -= zone.second;
+    }
+}
+
+// Whether a job or a queue may still hold a pointer to c
+static bool isChunkBusy(const Chunk* c)
 {
-    // First, send chunks processed by BlockWorkers to VBOWorkers
-    if (!m_blockDataChunks.empty()) {
-        m_blockDataChunksLock.lock();
+    ChunkState state = c->getState();
+    return state == ChunkState::GENERATING || state == ChunkState::MESHING
+           || state == ChunkState::MESH_READY;
+}
 
-        for (auto& c : m_blockDataChunks) {
-            for (auto& n : c->m_neighbors) {
-                if (n.second) {
-                    m_blockDataChunks.insert(n.second);
+bool Terrain::canEvictZone(int64_t zone) const
+{
+    glm::ivec2 coord = toCoords(zone);
+    for (int x = coord.x; x < coord.x + 64; x += 16) {
+        for (int z = coord.y; z < coord.y + 64; z += 16) {
+            const Chunk* c = getChunkAt(x, z).get();
+            if (isChunkBusy(c)) {
+                return false;
+            }
+            // A neighbor's VBOWorker reads c's border
+            for (const auto& n : c->m_neighbors) {
+                if (n.second && isChunkBusy(n.second)) {
+                    return false;
                 }
             }
         }
+    }
+    return true;
+}
 
-        createVBOWorkers(m_blockDataChunks);
-        m_blockDataChunks.clear();
-        m_blockDataChunksLock.unlock();
+void Terrain::evictZone(int64_t zone)
+{
+    glm::ivec2 coord = toCoords(zone);
+    std::unordered_set<Chunk*> evicted;
+    for (int x = coord.x; x < coord.x + 64; x += 16) {
+        for (int z = coord.y; z < coord.y + 64; z += 16) {
+            evicted.insert(getChunkAt(x, z).get());
+        }
     }
 
-    // Second, take the chunks that have VBO data and send data to GPU
-    m_VBODataChunksLock.lock();
+    m_drawList.erase(std::remove_if(m_drawList.begin(),
+                                    m_drawList.end(),
+                                    [&](Chunk* c) { return evicted.count(c) > 0; }),
+                     m_drawList.end());
+
+    for (Chunk* c : evicted) {
+        // The meshes of the neighbors left behind no longer match their borders
+        for (const auto& n : c->m_neighbors) {
+            if (n.second && evicted.count(n.second) == 0) {
+                n.second->markEdited();
+            }
+        }
+        c->unlinkNeighbors();
+        c->destroyVBOdata();
+
+        glm::ivec2 pos = c->getWorldPos();
+        m_chunks.erase(toKey(pos.x, pos.y));
+    }
+
+    m_generatedTerrain.erase(zone);
+    m_cancelledZones.erase(zone);
+    m_zoneLastUsed.erase(zone);
+}
+
+void Terrain::snapshotEditedChunks()
+{
+    if (!m_journal) {
+        return;
+    }
+
+    std::unordered_map<int64_t, RegionStore::ZonePayloads> snapshots;
+    for (auto& entry : m_chunks) {
+        Chunk* c = entry.second.get();
+        glm::ivec2 pos = c->getWorldPos();
+        ChunkState state = c->getState();
+        if (state == ChunkState::ALLOCATED || state == ChunkState::GENERATING
+            || m_journal->editCount(pos.x, pos.y) < SNAPSHOT_EDITS) {
+            continue;
+        }
 
-    for (auto& data : m_vboDataChunks) {
-        data->loadVBO();
+        glm::ivec2 zone = StreamingController::zoneOf(glm::vec2(pos));
+        RegionStore::ZonePayloads& payloads = snapshots[toKey(zone.x, zone.y)];
+        payloads[RegionStore::chunkIndex(zone.x, zone.y, pos.x, pos.y)] = c->serialize();
+        m_journal->clear(pos.x, pos.y);
     }
 
-    m_vboDataChunks.clear();
-    m_VBODataChunksLock.unlock();
+    for (auto& zone : snapshots) {
+        glm::ivec2 coord = toCoords(zone.first);
+        m_regions->saveChunks(coord.x, coord.y, std::move(zone.second));
+    }
+    // The snapshots have to be on disk before compaction drops their edits from the file
+    if (!snapshots.empty()) {
+        m_regions->flush();
+    }
+    m_journal->flush();
+    m_journal->compact();
+}
+
+void Terrain::checkThreadResults(glm::vec3 playerPos)
+{
+    // First, send chunks processed by BlockWorkers to VBOWorkers, along with their
+    // neighbors, whose meshes are now out of date along the edge they share
+    std::unordered_set<Chunk*> generated;
+    Chunk* c;
+    while (m_blockDataQueue.tryPop(c)) {
+        c->transitionState(ChunkState::GENERATING, ChunkState::GENERATED);
+        generated.insert(c);
+    }
+
+    std::unordered_set<Chunk*> toMesh = generated;
+    for (Chunk* g : generated) {
+        for (auto& n : g->m_neighbors) {
+            if (n.second && generated.count(n.second) == 0) {
+                n.second->markEdited();
+                toMesh.insert(n.second);
+            }
+        }
+    }
+    createVBOWorkers(toMesh);
+
+    // Second, collect the meshes the VBOWorkers have finished,
+    // dropping any that were overtaken by an edit while they were being made
+    uPtr<ChunkVBOData> finished;
+    while (m_meshQueue.tryPop(finished)) {
+        if (finished->epoch != finished->chunk->getEditEpoch()) {
+            discardStaleMesh(std::move(finished));
+        } else {
+            m_uploadQueue.push_back(std::move(finished));
+        }
+    }
+
+    // Finally, send them to the GPU nearest first, until this frame's budget runs out.
+    // At least one mesh goes up every frame so that the queue always drains.
+    if (m_uploadQueue.empty()) {
+        return;
+    }
+
+    glm::vec2 playerXZ(playerPos.x, playerPos.z);
+    auto distance2 = [&](const uPtr<ChunkVBOData>& mesh) {
+        glm::vec2 center = glm::vec2(mesh->chunk->getWorldPos()) + glm::vec2(8.f);
+        glm::vec2 offset = center - playerXZ;
+        return glm::dot(offset, offset);
+    };
+    std::sort(m_uploadQueue.begin(),
+              m_uploadQueue.end(),
+              [&](const uPtr<ChunkVBOData>& a, const uPtr<ChunkVBOData>& b) {
+                  return distance2(a) < distance2(b);
+              });
+
+    QElapsedTimer timer;
+    timer.start();
+    std::size_t next = 0;
+    std::size_t uploaded = 0;
+
+    while (next < m_uploadQueue.size()) {
+        if (uploaded > 0 && timer.nsecsElapsed() >= m_uploadBudgetMs * 1000000.f) {
+            break;
+        }
+
+        uPtr<ChunkVBOData> mesh = std::move(m_uploadQueue[next]);
+        next++;
+        Chunk* chunk = mesh->chunk;
+
+        // the Chunk may have been edited since the mesh was queued
+        if (mesh->epoch != chunk->getEditEpoch()) {
+            discardStaleMesh(std::move(mesh));
+            continue;
+        }
+
+        chunk->loadVBO(*mesh);
+        chunk->setState(ChunkState::UPLOADED);
+        addToDrawList(chunk);
+        MeshBufferPool::release(std::move(mesh));
+        uploaded++;
+    }
+
+    m_uploadQueue.erase(m_uploadQueue.begin(), m_uploadQueue.begin() + next);
+}
+
+void Terrain::setUploadBudget(float ms)
+{
+    m_uploadBudgetMs = ms;
+}
+
+std::size_t Terrain::uploadQueueDepth() const
+{
+    return m_uploadQueue.size();
+}
+
+const ChunkJobScheduler& Terrain::jobScheduler() const
+{
+    return m_jobScheduler;
+}
+
+StreamingController& Terrain::streaming()
+{
+    return m_streaming;
+}
+
+void Terrain::setMemoryBudget(std::size_t bytes)
+{
+    m_memoryBudget = bytes;
+}
+
+std::size_t Terrain::getMemoryBudget() const
+{
+    return m_memoryBudget;
+}
+
+std::size_t Terrain::memoryUsage() const
+{
+    return m_memoryUsage;
+}
+
+void Terrain::setDefaultMemoryBudget(std::size_t bytes)
+{
+    s_defaultMemoryBudget = bytes;
+}
+
+void Terrain::setDefaultWorldDirectory(const QString& directory)
+{
+    s_defaultWorldDirectory = directory;
+}
+
+uint32_t Terrain::getSeed() const
+{
+    return m_seed;
+}
+
+void Terrain::setDefaultSeed(uint32_t seed)
+{
+    s_defaultSeed = seed;
+}
+
+Pcg32 Terrain::mobRng(std::size_t mob) const
+{
+    return Pcg32(m_seed, mob + 1);
+}
+
+void Terrain::discardStaleMesh(uPtr<ChunkVBOData> mesh)
+{
+    Chunk* c = mesh->chunk;
+    // The sections it re-meshed were claimed when it started, and nothing else has meshed
+    // them since, so they go back to be meshed again
+    uint16_t meshed = mesh->meshed;
+    c->markSectionsDirty(meshed);
+    MeshBufferPool::release(std::move(mesh));
+
+    if (meshed == 0 && c->isUploadCurrent()) {
+        // createVBOdata has already uploaded an up to date mesh on the GL thread
+        c->setState(ChunkState::UPLOADED);
+    } else {
+        c->setState(c->isInDrawList ? ChunkState::DIRTY : ChunkState::GENERATED);
+        createVBOWorker(c);
+    }
+}
+
+void Terrain::addToDrawList(Chunk* c)
+{
+    if (!c->isInDrawList) {
+        c->isInDrawList = true;
+        m_drawList.push_back(c);
+    }
 }
 
 void Terrain::createBDWorker(long long zone)
@@ -219,14 +622,29 @@ void Terrain::createBDWorker(long long zone)
     int x = toCoords(zone).x;
     int z = toCoords(zone).y;
 
+    // A zone whose job was cancelled already has its Chunks
+    bool cancelled = m_cancelledZones.erase(zone) > 0;
+    m_generatedTerrain.insert(zone);
+
     for (int i = x; i < x + 64; i += 16) {
         for (int j = z; j < z + 64; j += 16) {
-            toDo.push_back(instantiateChunkAt(i, j));
+            Chunk* c = cancelled ? getChunkAt(i, j).get() : instantiateChunkAt(i, j);
+            c->setState(ChunkState::GENERATING);
+            toDo.push_back(c);
         }
     }
 
-    BDWorker* worker = new BDWorker(x, z, toDo, &m_blockDataChunks, &m_blockDataChunksLock);
-    QThreadPool::globalInstance()->start(worker);
+    m_jobScheduler.schedule(JobClass::BLOCK_DATA,
+                            zone,
+                            glm::ivec2(x, z),
+                            64,
+                            [worker = BDWorker(x,
+                                               z,
+                                               toDo,
+                                               m_seed,
+                                               &m_blockDataQueue,
+                                               m_regions.get(),
+                                               m_journal.get())]() mutable { worker.run(); });
 }
 
 void Terrain::createVBOWorkers(const std::unordered_set<Chunk*>& chunks)
@@ -238,8 +656,24 @@ void Terrain::createVBOWorkers(const std::unordered_set<Chunk*>& chunks)
 
 void Terrain::createVBOWorker(Chunk* chunk)
 {
-    VBOWorker* werk = new VBOWorker(chunk, &m_vboDataChunks, &m_VBODataChunksLock);
-    QThreadPool::globalInstance()->start(werk);
+    // Skip Chunks that have no blocks yet, and those whose mesh
+    // is already being made or is up to date
+    ChunkState state = chunk->getState();
+    if (state != ChunkState::GENERATED && state != ChunkState::DIRTY) {
+        return;
+    }
+
+    chunk->setState(ChunkState::MESHING);
+    glm::ivec2 pos = chunk->getWorldPos();
+    if (!m_jobScheduler.schedule(JobClass::MESH,
+                                 toKey(pos.x, pos.y),
+                                 pos,
+                                 16,
+                                 [worker = VBOWorker(chunk, &m_meshQueue)]() mutable {
+                                     worker.run();
+                                 })) {
+        chunk->setState(state);
+    }
 }
 
 void Terrain::setBlockAt(int x, int y, int z, BlockType t)
@@ -259,13 +693,27 @@ void Terrain::setBlockAt(int x, int y, int z, BlockType t)
 
 void Terrain::changeBlockAt(int x, int y, int z, BlockType bt)
 {
+    // Until its BDWorker is done, the Chunk's blocks are still to be written, over any edit
+    if (hasChunkAt(x, z)) {
+        ChunkState state = getChunkAt(x, z)->getState();
+        if (state == ChunkState::ALLOCATED || state == ChunkState::GENERATING) {
+            return;
+        }
+    }
+
     BlockType currBt = this->getBlockAt(glm::vec3(x, y, z));
     if (currBt != bt) {
         this->setBlockAt(x, y, z, bt);
         Chunk* c = this->getChunkAt(x, z).get();
-        c->destroyVBOdata();
-        c->generateVBOData();
-        c->loadVBO();
+        // An edit counts as a use of its zone
+        glm::ivec2 zone = StreamingController::zoneOf(glm::vec2(x, z));
+        m_zoneLastUsed[toKey(zone.x, zone.y)] = m_expansionTick;
+        if (m_journal) {
+            m_journal->record(x, y, z, bt);
+        }
+        // Re-meshes the dirty sections into their existing buffers
+        c->createVBOdata();
+        addToDrawList(c);
     }
 }
 
@@ -314,35 +762,95 @@ Chunk* Terrain::instantiateChunkAt(int xcoord, int zcoord)
     return cPtr;
 }
 
+// The six planes bounding what viewProj can see, each as (normal, distance) with the normal
+// pointing inward, taken from the sums and differences of the matrix's rows
+static std::array<glm::vec4, 6> frustumPlanes(const glm::mat4& viewProj)
+{
+    // glm matrices are column major
+    glm::vec4 row[4];
+    for (int i = 0; i < 4; i++) {
+        row[i] = glm::vec4(viewProj[0][i], viewProj[1][i], viewProj[2][i], viewProj[3][i]);
+    }
+    return {row[3] + row[0],
+            row[3] - row[0],
+            row[3] + row[1],
+            row[3] - row[1],
+            row[3] + row[2],
+            row[3] - row[2]};
+}
+
+// Whether any of the box from min to max might be inside the frustum. Only boxes entirely
+// outside one of its planes are ruled out, which is enough to skip most of what's unseen.
+static bool isBoxInFrustum(const std::array<glm::vec4, 6>& frustum, glm::vec3 min, glm::vec3 max)
+{
+    for (const glm::vec4& plane : frustum) {
+        // the corner of the box furthest along the plane's normal
+        glm::vec3 corner(plane.x >= 0.f ? max.x : min.x,
+                         plane.y >= 0.f ? max.y : min.y,
+                         plane.z >= 0.f ? max.z : min.z);
+        if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.f) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Terrain::draw(int minX,
                    int maxX,
                    int minZ,
                    int maxZ,
+                   const glm::mat4& viewProj,
                    ShaderProgram* shaderProgram,
                    std::vector<uPtr<Mob>>& currMobs)
 {
-    m_blockDataChunksLock.lock();
-    m_VBODataChunksLock.lock();
-    for (int x = minX; x < maxX; x += 16) {
-        for (int z = minZ; z < maxZ; z += 16) {
-            if (hasChunkAt(x, z)) {
-                const uPtr<Chunk>& currChunk = getChunkAt(x, z);
+    // Only the Chunks with uploaded meshes that fall within the bounding box
+    std::vector<Chunk*> visibleChunks;
+    for (Chunk* c : m_drawList) {
+        glm::ivec2 pos = c->getWorldPos();
+        if (pos.x >= minX && pos.x < maxX && pos.y >= minZ && pos.y < maxZ) {
+            visibleChunks.push_back(c);
+        }
+    }
 
-                if (currChunk->hasVBOData && currChunk->hasBinded) {
-                    shaderProgram->setModelMatrix(glm::translate(glm::mat4(), glm::vec3(x, 0, z)));
-                    shaderProgram->drawInterleavedO(*currChunk);
-                }
+    // Each section is drawn from its own buffers, as long as it has something to draw and
+    // some of it is in view. Bit s of each Chunk's mask is set if section s is drawn.
+    std::array<glm::vec4, 6> frustum = frustumPlanes(viewProj);
+    std::vector<std::pair<Chunk*, uint16_t>> drawnSections;
+    for (Chunk* c : visibleChunks) {
+        glm::ivec2 pos = c->getWorldPos();
+        glm::vec3 corner(pos.x, 0, pos.y);
+        if (!isBoxInFrustum(frustum, corner, corner + glm::vec3(16, 256, 16))) {
+            continue;
+        }
+
+        uint16_t sections = 0;
+        for (int s = 0; s < 16; s++) {
+            const ChunkSectionBuffers& buffers = c->getSectionBuffers(s);
+            glm::vec3 bottom = corner + glm::vec3(0, 16 * s, 0);
+            if ((buffers.oCount > 0 || buffers.tCount > 0)
+                && isBoxInFrustum(frustum, bottom, bottom + glm::vec3(16))) {
+                sections |= 1 << s;
             }
         }
+        if (sections != 0) {
+            drawnSections.push_back({c, sections});
+        }
     }
-    for (int x = minX; x < maxX; x += 16) {
-        for (int z = minZ; z < maxZ; z += 16) {
-            if (hasChunkAt(x, z)) {
-                const uPtr<Chunk>& currChunk = getChunkAt(x, z);
 
-                if (currChunk->hasVBOData && currChunk->hasBinded) {
-                    shaderProgram->setModelMatrix(glm::translate(glm::mat4(), glm::vec3(x, 0, z)));
-                    shaderProgram->drawInterleavedT(*currChunk);
+    for (bool transparent : {false, true}) {
+        for (const auto& drawn : drawnSections) {
+            glm::ivec2 pos = drawn.first->getWorldPos();
+            shaderProgram->setModelMatrix(
+                glm::translate(glm::mat4(), glm::vec3(pos.x, 0, pos.y)));
+            for (int s = 0; s < 16; s++) {
+                if (!((drawn.second >> s) & 1)) {
+                    continue;
+                }
+                const ChunkSectionBuffers& buffers = drawn.first->getSectionBuffers(s);
+                if (transparent) {
+                    shaderProgram->drawInterleaved(buffers.tVertData, buffers.tIdx, buffers.tCount);
+                } else {
+                    shaderProgram->drawInterleaved(buffers.oVertData, buffers.oIdx, buffers.oCount);
                 }
             }
         }
@@ -361,29 +869,20 @@ void Terrain::draw(int minX,
     if (mobsToRespawn.size() > 0) {
         std::vector<Chunk*> availableChunks;
 
-        for (int x = minX; x < maxX; x += 16) {
-            for (int z = minZ; z < maxZ; z += 16) {
-                if (hasChunkAt(x, z)) {
-                    const uPtr<Chunk>& currChunk = getChunkAt(x, z);
-
-                    if (currChunk->hasVBOData && currChunk->hasBinded
-                        && currChunk->viableSpawnBlocks.size() > 0) {
-                        availableChunks.push_back(currChunk.get());
-                    }
-                }
+        for (Chunk* c : visibleChunks) {
+            if (c->viableSpawnBlocks.size() > 0) {
+                availableChunks.push_back(c);
             }
         }
         if (availableChunks.size() > 0) {
             for (Mob* mob : mobsToRespawn) {
-                int randomChunk = Biome::getRandomIntInRange(0, availableChunks.size() - 1);
+                int randomChunk = m_spawnRng.nextInRange(0, availableChunks.size() - 1);
 
                 mob->respawn(availableChunks[randomChunk]);
             }
         }
     }
 
-    m_blockDataChunksLock.unlock();
-    m_VBODataChunksLock.unlock();
 }
 
 void Terrain::CreateTestScene()
@@ -391,10 +890,28 @@ void Terrain::CreateTestScene()
     // Create the Chunks that will
     // store the blocks for our
     // initial world space
+    // along with the player's edits, if the world has been saved before
+    RegionStore::ZonePayloads saved;
+    if (m_regions) {
+        m_regions->loadZone(0, 0, saved);
+    }
+
+    std::vector<Chunk*> chunks;
     for (int x = 0; x < 64; x += 16) {
         for (int z = 0; z < 64; z += 16) {
-            Chunk* c = instantiateChunkAt(x, z);
-            c->helperCreate(x, z);
+            chunks.push_back(instantiateChunkAt(x, z));
+        }
+    }
+    BDWorker::restoreOrGenerate(chunks, 0, 0, saved, m_seed, JobSystem::instance());
+    for (Chunk* c : chunks) {
+        c->setState(ChunkState::GENERATED);
+    }
+
+    if (m_journal) {
+        for (int x = 0; x < 64; x += 16) {
+            for (int z = 0; z < 64; z += 16) {
+                m_journal->replay(getChunkAt(x, z).get());
+            }
         }
     }
 
@@ -402,6 +919,7 @@ void Terrain::CreateTestScene()
         for (int z = 0; z < 64; z += 16) {
             Chunk* c = getChunkAt(x, z).get();
             c->createVBOdata();
+            addToDrawList(c);
         }
     }
     // Tell our existing terrain set that
@@ -422,6 +940,7 @@ void Terrain::loadNewChunks(glm::vec3 currPos)
 
             Chunk* newChunk = instantiateChunkAt(newChunkOrigin[0], newChunkOrigin[1]);
             newChunk->createVBOdata();
+            addToDrawList(newChunk);
         }
     }
 }
@@ -437,9 +956,9 @@ std::pair<float, BiomeEnum> Terrain::blendMultipleBiomes(glm::vec2 xz,
     BiomeEnum b;
     glm::vec4 biomeWts;
 
-    double elev = (Biome::perlin1(xz / 297.f) + 1.f)
+    double elev = (Biome::perlin1(xz / 297.f, m_seed) + 1.f)
                   / 2.f;  // remap perlin noise from (-1, 1) to (0, 1)
-    double temp = (Biome::perlin2(xz / 308.f) + 1.f) / 2.f;
+    double temp = (Biome::perlin2(xz / 308.f, m_seed) + 1.f) / 2.f;
     //    std::cout<<elev<<","<<temp<<std::endl;
 
     float LimE = 0.39;
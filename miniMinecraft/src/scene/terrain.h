@@ -1,12 +1,15 @@
 #pragma once
 #include "biome.h"
 #include "chunk.h"
+#include "chunkjobscheduler.h"
+#include "editjournal.h"
+#include "pcg32.h"
+#include "regionstore.h"
 #include "scene/mob.h"
 #include "shaderprogram.h"
 #include "smartpointerhelp.h"
+#include "streamingcontroller.h"
 #include "workers.h"
-#include <QMutex>
-#include <QThreadPool>
 #include <array>
 #include <unordered_map>
 #include <unordered_set>
@@ -29,12 +32,18 @@ glm::ivec2 toCoords(int64_t k);
 class Terrain
 {
 private:
-    // Set and mutex of chunks that have block data
-    std::unordered_set<Chunk*> m_blockDataChunks;
-    QMutex m_blockDataChunksLock;
-    // Vector and mutex of chunks that have VBO data
-    std::vector<Chunk*> m_vboDataChunks;
-    QMutex m_VBODataChunksLock;
+    // Chunks that BDWorkers have finished generating, waiting for VBOWorkers
+    BlockDataQueue m_blockDataQueue;
+    // Meshes finished by VBOWorkers, waiting to be uploaded
+    MeshQueue m_meshQueue;
+    // Meshes taken from m_meshQueue that haven't been uploaded yet.
+    // Only touched on the GL thread, so it needs no lock.
+    std::vector<uPtr<ChunkVBOData>> m_uploadQueue;
+    // How long checkThreadResults may spend uploading meshes each frame
+    float m_uploadBudgetMs = 4.f;
+    // Every Chunk whose mesh has been uploaded. Meshes are only uploaded on the GL thread,
+    // which is also the thread that draws, so draw reads this without any locks.
+    std::vector<Chunk*> m_drawList;
 
     // Stores every Chunk according to the location of its lower-left corner
     // in world space.
@@ -52,12 +61,47 @@ private:
     // of the world.
     // The world that exists when the base code is run consists of exactly
     // one 64 x 64 area with its lower-left corner at (0, 0).
-    // When milestone 1 has been implemented, the Player can move around the
-    // world to add more "terrain generation zone" IDs to this set.
-    // While only the 3 x 3 collection of terrain generation zones
-    // surrounding the Player should be rendered, the Chunks
-    // in the Terrain will never be deleted until the program is terminated.
+    // As the Player moves around the world, more "terrain generation zone"
+    // IDs are added to this set. Once the Chunks take up more memory than
+    // the memory budget allows, the least recently used zones are evicted,
+    // deleting their Chunks and removing them from this set again.
     std::unordered_set<int64_t> m_generatedTerrain;
+    // Zones packDistantZones has yet to get to in its current pass over m_generatedTerrain,
+    // so that a pass cut short by its time budget picks up where it left off
+    std::vector<int64_t> m_zonesToPack;
+    // Zones whose Chunks were instantiated, but whose block data job was cancelled
+    // before it started because the zone was no longer wanted
+    std::unordered_set<int64_t> m_cancelledZones;
+    // Decides which zones to generate, from where the player is heading
+    StreamingController m_streaming;
+
+    // The expansion tick each zone was last wanted by m_streaming or edited in.
+    // Zones evicted first are those used longest ago.
+    std::unordered_map<int64_t, uint64_t> m_zoneLastUsed;
+    uint64_t m_expansionTick = 0;
+    // Bytes the Chunks may use before zones are evicted
+    std::size_t m_memoryBudget;
+    // Bytes used by all Chunks, as of the last eviction pass
+    std::size_t m_memoryUsage = 0;
+    static std::size_t s_defaultMemoryBudget;
+
+    // What the world is generated from. A saved world keeps the seed it was created with.
+    uint32_t m_seed;
+    static uint32_t s_defaultSeed;
+    // Picks where mobs respawn. Stream 0 of the seed; mobRng hands out the others.
+    Pcg32 m_spawnRng;
+
+    // The saved world, both nullptr if the world isn't saved. Only the player's edits are
+    // saved, to m_journal; Chunks with many edits are snapshotted into m_regions instead.
+    uPtr<RegionStore> m_regions;
+    uPtr<EditJournal> m_journal;
+    float m_saveTimer = 0.f;
+    static QString s_defaultWorldDirectory;
+
+    // Runs the BDWorkers and VBOWorkers, nearest to the player first.
+    // Declared last so it's destroyed first, waiting for running workers
+    // before the Chunks and containers they write to are destroyed.
+    ChunkJobScheduler m_jobScheduler;
 
     // TODO: DELETE ALL REFERENCES TO m_geomCube AS YOU WILL NOT USE
     // IT IN YOUR FINAL PROGRAM!
@@ -79,14 +123,63 @@ public:
 
     float m_chunkTimer = 0.0f;
 
-    void multithreadedWork(glm::vec3, glm::vec3, float);
-
-    QSet<long long> borderingZone(glm::ivec2 coords, int radius, bool atEdge);
-    void tryExpansion(glm::vec3 pos, glm::vec3 prevPos);
+    void multithreadedWork(glm::vec3 currPlayerPos,
+                           glm::vec3 prevPlayerPos,
+                           glm::vec3 playerForward,
+                           float dt);
+
+    // Generates or meshes the zones m_streaming wants,
+    // and cancels pending jobs for the ones it no longer does
+    void tryExpansion();
+    // Packs the blocks of Chunks in zones far from playerPos (see Chunk::packBlocks)
+    // and unpacks those of the zone it's in, for a couple of milliseconds at most.
+    // Goes through the zones in turn across calls.
+    void packDistantZones(glm::vec3 playerPos);
+    // Evicts the least recently used zones, farthest from playerPos first among equals,
+    // until the Chunks fit in the memory budget. Zones m_streaming wants are never evicted,
+    // nor are zones whose Chunks, or their neighbors, a job or a queue may still reference.
+    void evictZones(glm::vec3 playerPos);
+    bool canEvictZone(int64_t zone) const;
+    // Frees the GPU buffers of the zone's Chunks, unlinks them from their neighbors
+    // and deletes them. Only call once canEvictZone has returned true.
+    void evictZone(int64_t zone);
+    // Snapshots the Chunks with so many edits that replaying them costs more than
+    // reading the Chunk back, drops their edits from the journal, and compacts it
+    void snapshotEditedChunks();
     void createVBOWorker(Chunk* chunk);
     void createVBOWorkers(const std::unordered_set<Chunk*>& chunks);
     void createBDWorker(long long zone);
-    void checkThreadResults();
+    // Starts VBOWorkers for newly generated Chunks and uploads finished meshes,
+    // nearest to playerPos first, within the per-frame upload budget
+    void checkThreadResults(glm::vec3 playerPos);
+
+    // Sets how many milliseconds per frame may be spent uploading meshes
+    void setUploadBudget(float ms);
+    // Number of finished meshes still waiting to be uploaded
+    std::size_t uploadQueueDepth() const;
+    // Pending job counts and queue latencies of the worker threads
+    const ChunkJobScheduler& jobScheduler() const;
+    // Streaming radius and lookahead, adjustable at runtime
+    StreamingController& streaming();
+    // Sets how many bytes the Chunks may use before zones are evicted
+    void setMemoryBudget(std::size_t bytes);
+    std::size_t getMemoryBudget() const;
+    // Bytes used by all Chunks, as of the last eviction pass
+    std::size_t memoryUsage() const;
+    // Sets the memory budget Terrains start with
+    static void setDefaultMemoryBudget(std::size_t bytes);
+    // Sets the directory Terrains save their region files in. An empty path turns saving off.
+    static void setDefaultWorldDirectory(const QString& directory);
+    uint32_t getSeed() const;
+    // Sets the seed new worlds are generated from (default: a random one)
+    static void setDefaultSeed(uint32_t seed);
+    // A random stream of its own for the world's mob-th mob
+    Pcg32 mobRng(std::size_t mob) const;
+    // Drops a mesh made before its Chunk's latest edit, and re-meshes the Chunk
+    // unless createVBOdata has already uploaded an up to date mesh
+    void discardStaleMesh(uPtr<ChunkVBOData> mesh);
+    // Makes draw include c. Call on the GL thread once c's mesh has been uploaded.
+    void addToDrawList(Chunk* c);
 
     // Instantiates a new Chunk and stores it in
     // our chunk map at the given coordinates.
@@ -118,17 +211,20 @@ public:
     // Given a world-space coordinate (which may have negative
     // values) set the block at that point in space to the
     // given type. Then reset the VBO data of the chunk of that block.
+    // Does nothing to a Chunk whose blocks haven't been generated yet.
     void changeBlockAt(int x, int y, int z, BlockType bt);
 
     void setBiomeAt(int x, int z, glm::vec4 b);
 
     // Draws every Chunk that falls within the bounding box
     // described by the min and max coords, using the provided
-    // ShaderProgram
+    // ShaderProgram. Of those, only the sections within the view
+    // frustum of viewProj are drawn.
     void draw(int minX,
               int maxX,
               int minZ,
               int maxZ,
+              const glm::mat4& viewProj,
               ShaderProgram* shaderProgram,
               std::vector<uPtr<Mob>>& currMobs);
 
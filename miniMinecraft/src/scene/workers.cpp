@@ -1,44 +1,77 @@
 #include "workers.h"
+#include "meshbufferpool.h"
 
 BDWorker::BDWorker(int x,
                    int z,
                    std::vector<Chunk*> toDo,
-                   std::unordered_set<Chunk*>* complete,
-                   QMutex* completedLock)
+                   uint32_t seed,
+                   BlockDataQueue* complete,
+                   const RegionStore* regions,
+                   const EditJournal* journal)
     : m_xCorner(x)
     , m_zCorner(z)
     , m_chunksToDo(toDo)
+    , m_seed(seed)
     , mp_chunksDone(complete)
-    , mp_chunksCompletedLock(completedLock)
+    , mp_regions(regions)
+    , mp_journal(journal)
 {}
 
+void BDWorker::restoreOrGenerate(const std::vector<Chunk*>& chunks,
+                                 int x,
+                                 int z,
+                                 const RegionStore::ZonePayloads& saved,
+                                 uint32_t seed,
+                                 JobSystem& jobs)
+{
+    // One task per Chunk
+    jobs.parallelFor(chunks.size(), [&](int i) {
+        Chunk* c = chunks[i];
+        glm::ivec2 pos = c->getWorldPos();
+        const std::vector<unsigned char>& snapshot
+            = saved[RegionStore::chunkIndex(x, z, pos.x, pos.y)];
+        if (snapshot.empty() || !c->deserialize(snapshot.data(), snapshot.size())) {
+            c->helperCreate(pos.x, pos.y, seed);
+            c->placeStructures();
+            // Generation is done, so shrink each section's palette down to what it actually holds
+            c->compactBlocks();
+        }
+    });
+}
+
 void BDWorker::run()
 {
-    // Construct chunks to do
-    for (Chunk* c : m_chunksToDo) {
-        c->helperCreate(c->getWorldPos().x, c->getWorldPos().y);
+    RegionStore::ZonePayloads saved;
+    if (mp_regions) {
+        mp_regions->loadZone(m_xCorner, m_zCorner, saved);
     }
 
-    mp_chunksCompletedLock->lock();
+    restoreOrGenerate(m_chunksToDo, m_xCorner, m_zCorner, saved, m_seed, JobSystem::instance());
 
-    for (Chunk* c : m_chunksToDo) {
-        mp_chunksDone->insert(c);
+    if (mp_journal) {
+        for (Chunk* c : m_chunksToDo) {
+            mp_journal->replay(c);
+        }
     }
 
-    mp_chunksCompletedLock->unlock();
+    // The GL thread moves them on to GENERATED once it receives them, so a Chunk is
+    // never GENERATED while this worker might still hold a pointer to it
+    for (Chunk* c : m_chunksToDo) {
+        mp_chunksDone->push(c);
+    }
 }
 
-VBOWorker::VBOWorker(Chunk* c, std::vector<Chunk*>* data, QMutex* dataLock)
+VBOWorker::VBOWorker(Chunk* c, MeshQueue* data)
     : mp_chunk(c)
     , mp_VBOsCompleted(data)
-    , mp_VBOsCompletedLock(dataLock)
 {}
 
 void VBOWorker::run()
 {
     // call function to build VBO Data
-    mp_chunk->generateVBOData();
-    mp_VBOsCompletedLock->lock();
-    mp_VBOsCompleted->push_back(mp_chunk);
-    mp_VBOsCompletedLock->unlock();
+    uPtr<ChunkVBOData> mesh = MeshBufferPool::acquire();
+    mp_chunk->generateVBOData(*mesh);
+    mp_chunk->transitionState(ChunkState::MESHING, ChunkState::MESH_READY);
+    // hand the mesh itself over, so the GL thread uploads it without copying it
+    mp_VBOsCompleted->push(std::move(mesh));
 }
@@ -1,34 +1,61 @@
 #pragma once
 #include "chunk.h"
-#include <QRunnable>
-#include <QMutex>
-#include <unordered_set>
+#include "jobsystem.h"
+#include "editjournal.h"
+#include "mpscqueue.h"
+#include "regionstore.h"
+#include "smartpointerhelp.h"
 
-class BDWorker : public QRunnable
+// Chunks whose block data a BDWorker has finished generating
+using BlockDataQueue = MPSCQueue<Chunk*, 1024>;
+// Meshes a VBOWorker has finished building
+using MeshQueue = MPSCQueue<uPtr<ChunkVBOData>, 1024>;
+
+// Fills in the block data of one zone's Chunks, split across the JobSystem's workers.
+// Chunks with a snapshot in the zone's region file are read back; the rest are generated
+// from the world's seed. Then the player's edits are replayed on top.
+class BDWorker
 {
 private:
     int m_xCorner, m_zCorner;
     std::vector<Chunk*> m_chunksToDo;
-    std::unordered_set<Chunk*>* mp_chunksDone;
-    QMutex* mp_chunksCompletedLock;
+    uint32_t m_seed;
+    BlockDataQueue* mp_chunksDone;
+    // Both nullptr if the world isn't saved
+    const RegionStore* mp_regions;
+    const EditJournal* mp_journal;
 
 public:
     BDWorker(int x,
              int z,
              std::vector<Chunk*> toDo,
-             std::unordered_set<Chunk*>* complete,
-             QMutex* completed);
-    void run() override;
+             uint32_t seed,
+             BlockDataQueue* complete,
+             const RegionStore* regions,
+             const EditJournal* journal);
+    void run();
+
+    // Reads chunks, the linked Chunks of the zone at (x, z), back from their snapshots in saved,
+    // and generates those whose snapshot is empty or corrupt from seed, on jobs.
+    // Each Chunk is generated on its own, writing to none of its neighbors, so its blocks
+    // depend on nothing but the seed and its position: not on the number of workers, the
+    // order the jobs ran in, or what's been generated around it.
+    static void restoreOrGenerate(const std::vector<Chunk*>& chunks,
+                                  int x,
+                                  int z,
+                                  const RegionStore::ZonePayloads& saved,
+                                  uint32_t seed,
+                                  JobSystem& jobs);
 };
 
-class VBOWorker : public QRunnable
+// Meshes one Chunk
+class VBOWorker
 {
 private:
     Chunk* mp_chunk;
-    std::vector<Chunk*>* mp_VBOsCompleted;
-    QMutex* mp_VBOsCompletedLock;
+    MeshQueue* mp_VBOsCompleted;
 
 public:
-    VBOWorker(Chunk* c, std::vector<Chunk*>* data, QMutex* lock);
-    void run() override;
+    VBOWorker(Chunk* c, MeshQueue* data);
+    void run();
 };
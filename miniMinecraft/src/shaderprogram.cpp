@@ -18,6 +18,7 @@ ShaderProgram::ShaderProgram(OpenGLContext* context)
     , attrUV(-1)
     , attrBT(-1)
     , attrBWts(-1)
+    , attrPacked(-1)
     , unifModel(-1)
     , unifModelInvTr(-1)
     , unifViewProj(-1)
@@ -88,6 +89,7 @@ void ShaderProgram::create(const char* vertfile, const char* fragfile)
     attrUV = context->glGetAttribLocation(prog, "vs_UV");
     attrBT = context->glGetAttribLocation(prog, "vs_BT");
     attrBWts = context->glGetAttribLocation(prog, "vs_BWts");
+    attrPacked = context->glGetAttribLocation(prog, "vs_Packed");
 
     if (attrCol == -1) {
         attrCol = context->glGetAttribLocation(prog, "vs_ColInstanced");
@@ -280,95 +282,52 @@ void ShaderProgram::drawInterleavedO(Drawable& d)
     }
 
     if (d.bindOVertData() && d.m_oCount > 0) {
-        if (attrPos != -1) {
-            context->glEnableVertexAttribArray(attrPos);
-            context->glVertexAttribPointer(attrPos,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)0);
-        }
-
-        if (attrNor != -1) {
-            context->glEnableVertexAttribArray(attrNor);
-            context->glVertexAttribPointer(attrNor,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)sizeof(glm::vec4));
-        }
-
-        if (attrCol != -1) {
-            context->glEnableVertexAttribArray(attrCol);
-            context->glVertexAttribPointer(attrCol,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)(2 * sizeof(glm::vec4)));
-        }
-
-        if (attrUV != -1) {
-            context->glEnableVertexAttribArray(attrUV);
-            context->glVertexAttribPointer(attrUV,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)(3 * sizeof(glm::vec4)));
-        }
-
-        if (attrBT != -1) {
-            context->glEnableVertexAttribArray(attrBT);
-            context->glVertexAttribPointer(attrBT,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)(4 * sizeof(glm::vec4)));
-        }
-
-        if (attrBWts != -1) {
-            context->glEnableVertexAttribArray(attrBWts);
-            context->glVertexAttribPointer(attrBWts,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)(5 * sizeof(glm::vec4)));
+        // Each vertex is a single uvec4 (see Vertex in chunk.h), unpacked in the vertex shader
+        if (attrPacked != -1) {
+            context->glEnableVertexAttribArray(attrPacked);
+            context->glVertexAttribIPointer(attrPacked,
+                                            4,
+                                            GL_UNSIGNED_INT,
+                                            4 * sizeof(GLuint),
+                                            (void*)0);
         }
 
         d.bindOIdx();
-        context->glDrawElements(d.drawMode(), d.elemCount(), GL_UNSIGNED_INT, 0);
-
-        if (attrPos != -1) {
-            context->glDisableVertexAttribArray(attrPos);
-        }
+        context->glDrawElements(d.drawMode(), d.m_oCount, GL_UNSIGNED_INT, 0);
 
-        if (attrNor != -1) {
-            context->glDisableVertexAttribArray(attrNor);
+        if (attrPacked != -1) {
+            context->glDisableVertexAttribArray(attrPacked);
         }
 
-        if (attrCol != -1) {
-            context->glDisableVertexAttribArray(attrCol);
-        }
+        context->printGLErrorLog();
+    }
+}
 
-        if (attrUV != -1) {
-            context->glDisableVertexAttribArray(attrUV);
-        }
+void ShaderProgram::drawInterleaved(GLuint vertData, GLuint idx, int count)
+{
+    if (count == 0) {
+        return;
+    }
+    useMe();
 
-        if (attrBT != -1) {
-            context->glDisableVertexAttribArray(attrBT);
-        }
+    context->glBindBuffer(GL_ARRAY_BUFFER, vertData);
+    if (attrPacked != -1) {
+        context->glEnableVertexAttribArray(attrPacked);
+        context->glVertexAttribIPointer(attrPacked,
+                                        4,
+                                        GL_UNSIGNED_INT,
+                                        4 * sizeof(GLuint),
+                                        (void*)0);
+    }
 
-        if (attrBWts != -1) {
-            context->glDisableVertexAttribArray(attrBWts);
-        }
+    context->glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, idx);
+    context->glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, 0);
 
-        context->printGLErrorLog();
+    if (attrPacked != -1) {
+        context->glDisableVertexAttribArray(attrPacked);
     }
+
+    context->printGLErrorLog();
 }
 
 void ShaderProgram::drawInterleavedT(Drawable& d)
@@ -381,91 +340,20 @@ void ShaderProgram::drawInterleavedT(Drawable& d)
     }
 
     if (d.bindTVertData() && d.m_tCount > 0) {
-        if (attrPos != -1) {
-            context->glEnableVertexAttribArray(attrPos);
-            context->glVertexAttribPointer(attrPos,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)0);
-        }
-
-        if (attrNor != -1) {
-            context->glEnableVertexAttribArray(attrNor);
-            context->glVertexAttribPointer(attrNor,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)sizeof(glm::vec4));
-        }
-
-        if (attrCol != -1) {
-            context->glEnableVertexAttribArray(attrCol);
-            context->glVertexAttribPointer(attrCol,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)(2 * sizeof(glm::vec4)));
-        }
-
-        if (attrUV != -1) {
-            context->glEnableVertexAttribArray(attrUV);
-            context->glVertexAttribPointer(attrUV,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)(3 * sizeof(glm::vec4)));
-        }
-
-        if (attrBT != -1) {
-            context->glEnableVertexAttribArray(attrBT);
-            context->glVertexAttribPointer(attrBT,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)(4 * sizeof(glm::vec4)));
-        }
-
-        if (attrBWts != -1) {
-            context->glEnableVertexAttribArray(attrBWts);
-            context->glVertexAttribPointer(attrBWts,
-                                           4,
-                                           GL_FLOAT,
-                                           false,
-                                           6 * sizeof(glm::vec4),
-                                           (void*)(5 * sizeof(glm::vec4)));
+        if (attrPacked != -1) {
+            context->glEnableVertexAttribArray(attrPacked);
+            context->glVertexAttribIPointer(attrPacked,
+                                            4,
+                                            GL_UNSIGNED_INT,
+                                            4 * sizeof(GLuint),
+                                            (void*)0);
         }
 
         d.bindTIdx();
-        context->glDrawElements(d.drawMode(), d.elemCount(), GL_UNSIGNED_INT, 0);
-
-        if (attrPos != -1) {
-            context->glDisableVertexAttribArray(attrPos);
-        }
-
-        if (attrNor != -1) {
-            context->glDisableVertexAttribArray(attrNor);
-        }
-
-        if (attrCol != -1) {
-            context->glDisableVertexAttribArray(attrCol);
-        }
-
-        if (attrUV != -1) {
-            context->glDisableVertexAttribArray(attrUV);
-        }
-
-        if (attrBT != -1) {
-            context->glDisableVertexAttribArray(attrBT);
-        }
+        context->glDrawElements(d.drawMode(), d.m_tCount, GL_UNSIGNED_INT, 0);
 
-        if (attrBWts != -1) {
-            context->glDisableVertexAttribArray(attrBWts);
+        if (attrPacked != -1) {
+            context->glDisableVertexAttribArray(attrPacked);
         }
     }
 
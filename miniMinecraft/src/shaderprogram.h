@@ -26,6 +26,7 @@ public:
     int attrUV;
     int attrBT;
     int attrBWts;
+    int attrPacked;     // A handle for the "in" uvec4 holding a whole packed chunk vertex
     int attrPosOffset;  // A handle for a vec3 used only in the instanced rendering shader
 
     int unifModel;  // A handle for the "uniform" mat4 representing model matrix in the vertex shader
@@ -62,9 +63,12 @@ public:
     void setCamPos(glm::vec3 pos);
     // Draw the given object to our screen using this ShaderProgram's shaders
     void draw(Drawable& d);
-    // Draw the given object to our screen multiple times using instanced rendering
+    // Draw the opaque or transparent mesh of a Chunk, whose vertices are packed into one uvec4
     void drawInterleavedO(Drawable& d);
     void drawInterleavedT(Drawable& d);
+    // Draw count indices from idx of a packed mesh in vertData, e.g. one Chunk section's.
+    // Draws nothing if count is 0.
+    void drawInterleaved(GLuint vertData, GLuint idx, int count);
     // Utility function used in create()
     char* textFileRead(const char* fileName);
     QString qTextFileRead(const char* fileName);
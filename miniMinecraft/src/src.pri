@@ -2,6 +2,7 @@ INCLUDEPATH += $$PWD
 DEPENDPATH += $$PWD
 
 SOURCES += \
+    $$PWD/benchmarks.cpp \
     $$PWD/framebuffer.cpp \
     $$PWD/inventorywindow.cpp \
     $$PWD/la.cpp \
@@ -11,11 +12,22 @@ SOURCES += \
     $$PWD/recipewindow.cpp \
     $$PWD/scene/InventoryManager.cpp \
     $$PWD/scene/biome.cpp \
+    $$PWD/scene/blockstorage.cpp \
+    $$PWD/scene/cavefield.cpp \
+    $$PWD/scene/chunkcodec.cpp \
+    $$PWD/scene/chunkjobscheduler.cpp \
+    $$PWD/scene/columnnoisecache.cpp \
+    $$PWD/scene/editjournal.cpp \
+    $$PWD/scene/faceculling.cpp \
     $$PWD/scene/geometry3d.cpp \
+    $$PWD/scene/jobsystem.cpp \
+    $$PWD/scene/meshbufferpool.cpp \
     $$PWD/scene/mob.cpp \
     $$PWD/scene/node.cpp \
     $$PWD/scene/patharrow.cpp \
     $$PWD/scene/quad.cpp \
+    $$PWD/scene/regionstore.cpp \
+    $$PWD/scene/streamingcontroller.cpp \
     $$PWD/scene/workers.cpp \
     $$PWD/shaderprogram.cpp \
     $$PWD/drawable.cpp \
@@ -31,6 +43,7 @@ SOURCES += \
     $$PWD/texture.cpp
 
 HEADERS += \
+    $$PWD/benchmarks.h \
     $$PWD/framebuffer.h \
     $$PWD/inventorywindow.h \
     $$PWD/la.h \
@@ -39,11 +52,29 @@ HEADERS += \
     $$PWD/recipewindow.h \
     $$PWD/scene/InventoryManager.h \
     $$PWD/scene/biome.h \
+    $$PWD/scene/blockstorage.h \
+    $$PWD/scene/blocktraits.h \
+    $$PWD/scene/blockuv.h \
+    $$PWD/scene/blocktype.h \
+    $$PWD/scene/cavefield.h \
+    $$PWD/scene/chunkcodec.h \
+    $$PWD/scene/chunkjobscheduler.h \
+    $$PWD/scene/columnnoisecache.h \
+    $$PWD/scene/editjournal.h \
+    $$PWD/scene/faceculling.h \
+    $$PWD/scene/floatlanes.h \
     $$PWD/scene/geometry3d.h \
+    $$PWD/scene/jobsystem.h \
+    $$PWD/scene/meshbufferpool.h \
+    $$PWD/scene/mpscqueue.h \
     $$PWD/scene/mob.h \
+    $$PWD/scene/noisehash.h \
     $$PWD/scene/node.h \
     $$PWD/scene/patharrow.h \
+    $$PWD/scene/pcg32.h \
     $$PWD/scene/quad.h \
+    $$PWD/scene/regionstore.h \
+    $$PWD/scene/streamingcontroller.h \
     $$PWD/scene/workers.h \
     $$PWD/shaderprogram.h \
     $$PWD/drawable.h \
@@ -58,4 +89,5 @@ HEADERS += \
     $$PWD/scene/camera.h \
     $$PWD/playerinfo.h \
     $$PWD/scene/chunk.h \
+    $$PWD/scene/chunksnapshot.h \
     $$PWD/texture.h